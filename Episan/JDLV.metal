@@ -10,59 +10,10 @@ using namespace metal;
 
 #include "RMDLMainRenderer_shared.h"
 
-kernel void JDLVCompute(device const uint* sourceGrid [[buffer(0)]],
-                        device uint* destGrid [[buffer(1)]],
-                        constant JDLVState& gameState [[buffer(2)]],
-                        uint2 gid [[thread_position_in_grid]])
-{
-    if (gid.x >= gameState.width || gid.y >= gameState.height)
-        return;
-
-    uint index = gid.y * gameState.width + gid.x;
-
-    uint liveNeighbors = 0;
-
-    for (int dy = -1; dy <= 1; ++dy)
-    {
-        for (int dx = -1; dx <= 1; ++dx)
-        {
-            if (dx == 0 && dy == 0)
-                continue;
-
-            int sx = int(gid.x) + dx;
-            int sy = int(gid.y) + dy;
-
-            if (sx >= 0 && sy >= 0 && sx < int(gameState.width) && sy < int(gameState.height))
-            {
-                uint nx = uint(sx);
-                uint ny = uint(sy);
-                uint neighborIndex = ny * gameState.width + nx;
-                if (sourceGrid[neighborIndex] > 0)
-                {
-                    liveNeighbors += 1;
-                }
-            }
-        }
-    }
-
-    uint currentState = sourceGrid[index];
-    uint newState = 0;
-
-    if (currentState == 1)
-    {
-        if (liveNeighbors == 2 || liveNeighbors == 3)
-            newState = 1;
-        else
-            newState = 0;
-    }
-    else
-    {
-        if (liveNeighbors == 3)
-            newState = 1;
-    }
-
-    destGrid[index] = newState;
-}
+// The rule's state count is baked in when the pipeline is built, for the
+// Generations fade. Default is two-state Life.
+constant uint kStateCountValue [[function_constant(JDLVFunctionConstantStateCount)]];
+constant uint kStateCount = is_function_constant_defined(kStateCountValue) ? kStateCountValue : 2;
 
 struct VertexOut
 {
@@ -96,7 +47,9 @@ vertex VertexOut JDLVVertex(constant uint* grid [[buffer(0)]],
 
 fragment float4 JDLVFragment(VertexOut in [[stage_in]],
                              constant uint* grid [[buffer(0)]],
-                             constant JDLVState& gameState [[buffer(1)]])
+                             constant JDLVState& gameState [[buffer(1)]],
+                             constant JDLVDensity& density [[buffer(2)]],
+                             device const uint* densityCounts [[buffer(3)]])
 {
     float fx = clamp(in.texCoord.x, 0.0f, 0.99999994f); // slightly less than 1.0f
     float fy = clamp(in.texCoord.y, 0.0f, 0.99999994f);
@@ -108,11 +61,33 @@ fragment float4 JDLVFragment(VertexOut in [[stage_in]],
     x = min(x, gameState.width  - 1);
     y = min(y, gameState.height - 1);
 
+    // More than one cell per pixel: read the pyramid level whose blocks are
+    // about a pixel wide instead, so the cost stays per pixel, not per cell.
+    // The pyramid counts state 1 only, so zoomed out a Generations board
+    // shows its live cells without the fading trail.
+    float2 cellsPerPixel = fwidth(in.texCoord * float2(gameState.width, gameState.height));
+    float footprint = max(cellsPerPixel.x, cellsPerPixel.y);
+    uint level = footprint >= 2.0f ? min(uint(floor(log2(footprint))), density.levelCount) : 0;
+    if (level > 0)
+    {
+        JDLVDensityLevel blocks = density.levels[level - 1];
+        uint bx = min(x >> level, blocks.width - 1);
+        uint by = min(y >> level, blocks.height - 1);
+        uint count = densityCounts[blocks.offset + by * blocks.width + bx];
+        // Blocks on the right and bottom edges are clipped to the board.
+        uint side = 1u << level;
+        float area = float(min(side, gameState.width - bx * side) * min(side, gameState.height - by * side));
+        float coverage = float(count) / area;
+        return (count > 0) ? float4(coverage, coverage, coverage, 1.0) : float4(0.0, 0.0, 0.0, 0.0);
+    }
+
     uint index = y * gameState.width + x;
 
     uint cellState = grid[index];
 
-    float4 color = (cellState > 0) ? float4(1.0, 1.0, 1.0, 1.0) : float4(0.0, 0.0, 0.0, 0.0);
+    // Generations: dying cells fade out with their age.
+    float fade = (cellState > 1) ? 1.0f - float(cellState - 1) / float(kStateCount) : 1.0f;
+    float4 color = (cellState > 0) ? float4(fade, fade, fade, 1.0) : float4(0.0, 0.0, 0.0, 0.0);
 
     return color;
 }
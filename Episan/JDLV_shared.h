@@ -0,0 +1,63 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: JDLV_shared.h                 +++     +++     **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 17/10/2026 18:52:05      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef JDLV_SHARED_H
+#define JDLV_SHARED_H
+
+// Shared between JDLV.metal and the headless CPU engines: no simd, no Metal.
+#ifndef __METAL_VERSION__
+# include <stdint.h>
+#endif
+
+// How neighbours past the grid edge are sampled.
+typedef enum JDLVTopology
+{
+    JDLVTopologyPlane       = 0,    // outside cells are dead
+    JDLVTopologyTorus       = 1,    // both axes wrap
+    JDLVTopologyKleinBottle = 2,    // x wraps, crossing the y edge also mirrors x
+    JDLVTopologyPadded      = 3     // outside cells hold paddingState
+}   JDLVTopology;
+
+struct JDLVState
+{
+    uint32_t width;
+    uint32_t height;
+    uint32_t topology;
+    uint32_t paddingState;
+};
+
+// Density pyramid (see LifeDensityPyramid): level k counts the live cells of
+// 2^k x 2^k blocks, k = 1 .. levelCount. The buffer holds this header, then
+// every level's counts row-major, one uint32_t each.
+#define JDLVDensityMaxLevels 16
+
+struct JDLVDensityLevel
+{
+    uint32_t width;     // blocks across
+    uint32_t height;
+    uint32_t offset;    // first count, in uint32_t after the header
+    uint32_t reserved;
+};
+
+struct JDLVDensity
+{
+    uint32_t levelCount;
+    uint32_t reserved[3];
+    struct JDLVDensityLevel levels[JDLVDensityMaxLevels];   // levels[k - 1] is level k
+};
+
+// JDLVFragment is specialised per rule with function constants: only the
+// state count, for the Generations fade. The board is stepped on the CPU.
+typedef enum JDLVFunctionConstant
+{
+    JDLVFunctionConstantStateCount  = 0
+}   JDLVFunctionConstant;
+
+#endif /* JDLV_SHARED_H */
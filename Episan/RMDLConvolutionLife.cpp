@@ -0,0 +1,492 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: RMDLConvolutionLife.cpp         +++     +++   **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 19/10/2026 14:22:15      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdio>
+
+#include "RMDLConvolutionLife.hpp"
+#include "RMDLWorkStealingPool.hpp"
+
+// Conway's Life as a Larger than Life rule; fits any board, unlike Bosco's.
+static const LargerThanLifeRule kDefaultRule = { 1, 2, false, 2, 3, 3, 3, LargerThanLifeRule::Shape::Box };
+
+static bool parseNumber(const std::string& text, size_t& pos, uint32_t& value)
+{
+    const size_t start = pos;
+    value = 0;
+    while (pos < text.size() && isdigit((unsigned char)text[pos]) && pos - start < 6)
+        value = value * 10 + (uint32_t)(text[pos++] - '0');
+    return (pos > start);
+}
+
+static bool parseRange(const std::string& field, uint32_t& low, uint32_t& high)
+{
+    size_t pos = 1;
+    if (!parseNumber(field, pos, low))
+        return (false);
+    high = low;
+    if (pos == field.size())
+        return (true);
+    if (field.compare(pos, 2, "..") != 0)
+        return (false);
+    pos += 2;
+    return (parseNumber(field, pos, high) && pos == field.size() && low <= high);
+}
+
+bool LargerThanLifeRule::parse(const std::string& text, LargerThanLifeRule& rule)
+{
+    std::vector<std::string> fields(1);
+    for (char c : text)
+    {
+        if (c == ',')
+            fields.emplace_back();
+        else if (!isspace((unsigned char)c))
+            fields.back() += (char)toupper((unsigned char)c);
+    }
+
+    LargerThanLifeRule out = { 1, 2, false, 0, 0, 0, 0, Shape::Box };
+    bool seen[6] = {};      // R C M S B N
+    for (const std::string& field : fields)
+    {
+        if (field.empty())
+            return (false);
+        size_t pos = 1;
+        uint32_t value;
+        switch (field[0])
+        {
+            case 'R':
+                if (!parseNumber(field, pos, value) || pos != field.size() || value < 1 || value > 500)
+                    return (false);
+                out.radius = value;
+                seen[0] = true;
+                break;
+            case 'C':
+                if (!parseNumber(field, pos, value) || pos != field.size() || value > 256)
+                    return (false);
+                out.states = std::max<uint32_t>(value, 2);
+                seen[1] = true;
+                break;
+            case 'M':
+                if (field != "M0" && field != "M1")
+                    return (false);
+                out.countCentre = field == "M1";
+                seen[2] = true;
+                break;
+            case 'S':
+                if (!parseRange(field, out.surviveMin, out.surviveMax))
+                    return (false);
+                seen[3] = true;
+                break;
+            case 'B':
+                if (!parseRange(field, out.birthMin, out.birthMax))
+                    return (false);
+                seen[4] = true;
+                break;
+            case 'N':
+                if (field == "NM")
+                    out.shape = Shape::Box;
+                else if (field == "NN")
+                    out.shape = Shape::Diamond;
+                else if (field == "NC")
+                    out.shape = Shape::Circle;
+                else
+                    return (false);
+                seen[5] = true;
+                break;
+            default:
+                return (false);
+        }
+    }
+    // Births with no live neighbours would fill the halo-free plane at once.
+    if (!seen[0] || !seen[3] || !seen[4] || out.birthMin == 0)
+        return (false);
+    rule = out;
+    return (true);
+}
+
+std::string LargerThanLifeRule::toString() const
+{
+    static const char* const kShapes[] = { "NM", "NN", "NC" };
+    char text[96];
+    snprintf(text, sizeof(text), "R%u,C%u,M%u,S%u..%u,B%u..%u,%s", radius, states == 2 ? 0 : states,
+             countCentre ? 1 : 0, surviveMin, surviveMax, birthMin, birthMax, kShapes[(int)shape]);
+    return (text);
+}
+
+ConvolutionLife::ConvolutionLife(const JDLVState& state, WorkStealingPool* pool)
+    : _state(state)
+    , _pool(pool)
+    , _lenia(false)
+    , _lifeRule(kDefaultRule)
+    , _leniaRule(LeniaRule::orbium())
+    , _method(Method::Auto)
+    , _generation(0)
+    , _halo(0)
+{
+    const size_t cells = (size_t)state.width * state.height;
+    _cells.assign(cells, 0);
+    _values.assign(cells, 0.f);
+    _live.assign(cells, 0.f);
+    _sums.assign(cells, 0.f);
+    prepare();
+}
+
+ConvolutionLife::~ConvolutionLife()
+{
+}
+
+void ConvolutionLife::setTopology(JDLVTopology topology, uint32_t paddingState)
+{
+    _state.topology = topology;
+    _state.paddingState = paddingState;
+    prepare();
+}
+
+bool ConvolutionLife::fits(uint32_t radius) const
+{
+    if (2 * radius + 1 <= std::min(_state.width, _state.height))
+        return (true);
+    printf("ConvolutionLife: radius %u does not fit a %ux%u board\n", radius, _state.width, _state.height);
+    return (false);
+}
+
+bool ConvolutionLife::setRule(const LargerThanLifeRule& rule)
+{
+    if (!fits(rule.radius))
+        return (false);
+    if (_lenia)
+        for (size_t i = 0; i < _cells.size(); ++i)
+            _cells[i] = _values[i] >= 0.5f;
+    const uint32_t states = std::max<uint32_t>(rule.states, 2);
+    for (uint8_t& cell : _cells)
+        if (cell >= states)
+            cell = 0;
+    _lifeRule = rule;
+    _lenia = false;
+    prepare();
+    return (true);
+}
+
+bool ConvolutionLife::setRule(const LeniaRule& rule)
+{
+    if (!fits(rule.radius) || rule.peaks.empty() || rule.sigma <= 0)
+        return (false);
+    if (!_lenia)
+        for (size_t i = 0; i < _cells.size(); ++i)
+            _values[i] = _cells[i] == 1 ? 1.f : 0.f;
+    _leniaRule = rule;
+    _lenia = true;
+    prepare();
+    return (true);
+}
+
+bool ConvolutionLife::setMethod(Method method)
+{
+    if (method == Method::SummedArea && (_lenia || _lifeRule.shape != LargerThanLifeRule::Shape::Box))
+        return (false);
+    _method = method;
+    prepare();
+    return (true);
+}
+
+ConvolutionLife::Method ConvolutionLife::method() const
+{
+    const bool box = !_lenia && _lifeRule.shape == LargerThanLifeRule::Shape::Box;
+    if (_method == Method::Auto || (_method == Method::SummedArea && !box))
+        return (box ? Method::SummedArea : Method::FFT);
+    return (_method);
+}
+
+// Builds the convolution grid and, for the FFT, the kernel's spectrum.
+void ConvolutionLife::prepare()
+{
+    const uint32_t radius = _lenia ? _leniaRule.radius : _lifeRule.radius;
+    const uint32_t width = _state.width, height = _state.height;
+    _halo = radius;
+
+    if (method() == Method::SummedArea)
+    {
+        _fft.reset();
+        _extended.clear();
+        _spectrum.clear();
+        _kernelSpectrum.clear();
+        _summedArea.assign(((size_t)width + 2 * radius + 1) * ((size_t)height + 2 * radius + 1), 0);
+        return;
+    }
+    _summedArea.clear();
+
+    uint32_t extendedWidth, extendedHeight;
+    const bool deadOutside = _state.topology == JDLVTopologyPlane
+        || (_state.topology == JDLVTopologyPadded && _state.paddingState != 1);
+    if (_state.topology == JDLVTopologyTorus && FFT2D::isPowerOfTwo(width) && FFT2D::isPowerOfTwo(height))
+    {
+        // The circular convolution is the torus.
+        _halo = 0;
+        extendedWidth = width;
+        extendedHeight = height;
+    }
+    else if (deadOutside)
+    {
+        // Nothing to store in the halo: R zero cells past each edge keep the wrap out.
+        _halo = 0;
+        extendedWidth = FFT2D::nextPowerOfTwo(width + radius);
+        extendedHeight = FFT2D::nextPowerOfTwo(height + radius);
+    }
+    else
+    {
+        extendedWidth = FFT2D::nextPowerOfTwo(width + 2 * radius);
+        extendedHeight = FFT2D::nextPowerOfTwo(height + 2 * radius);
+    }
+    _fft.reset(new FFT2D(extendedWidth, extendedHeight));
+    const size_t extended = (size_t)extendedWidth * extendedHeight;
+    _extended.assign(extended, 0.f);
+    _spectrum.resize(extended);
+    _kernelSpectrum.resize(extended);
+
+    // Kernel centred on (0, 0), negative offsets wrapped to the far side.
+    std::vector<float> kernel(extended, 0.f);
+    double total = 0;
+    const int32_t r = (int32_t)radius;
+    for (int32_t dy = -r; dy <= r; ++dy)
+    {
+        for (int32_t dx = -r; dx <= r; ++dx)
+        {
+            float weight = 0;
+            if (_lenia)
+            {
+                const double distance = sqrt((double)(dx * dx + dy * dy)) / radius;
+                const uint32_t rings = (uint32_t)_leniaRule.peaks.size();
+                if (distance < 1)
+                {
+                    const double ring = distance * rings;
+                    const uint32_t index = std::min((uint32_t)ring, rings - 1);
+                    const double q = ring - index;
+                    if (q > 0 && q < 1)
+                        weight = (float)(_leniaRule.peaks[index] * exp(4.0 - 1.0 / (q * (1 - q))));
+                }
+            }
+            else if (dx == 0 && dy == 0)
+                weight = _lifeRule.countCentre ? 1.f : 0.f;
+            else if (_lifeRule.shape == LargerThanLifeRule::Shape::Box)
+                weight = 1;
+            else if (_lifeRule.shape == LargerThanLifeRule::Shape::Diamond)
+                weight = std::abs(dx) + std::abs(dy) <= r ? 1.f : 0.f;
+            else
+                weight = dx * dx + dy * dy <= r * r + r ? 1.f : 0.f;
+            kernel[(size_t)((dy + (int32_t)extendedHeight) % (int32_t)extendedHeight) * extendedWidth
+                   + (uint32_t)((dx + (int32_t)extendedWidth) % (int32_t)extendedWidth)] += weight;
+            total += weight;
+        }
+    }
+    if (_lenia && total > 0)
+        for (float& weight : kernel)
+            weight = (float)(weight / total);
+    _fft->forward(kernel.data(), _kernelSpectrum.data(), _pool);
+}
+
+void ConvolutionLife::clear()
+{
+    std::fill(_cells.begin(), _cells.end(), 0);
+    std::fill(_values.begin(), _values.end(), 0.f);
+    _generation = 0;
+}
+
+void ConvolutionLife::setCell(uint32_t x, uint32_t y, uint8_t state)
+{
+    _cells[(size_t)y * _state.width + x] = state < std::max<uint32_t>(_lifeRule.states, 2) ? state : 0;
+}
+
+void ConvolutionLife::setValue(uint32_t x, uint32_t y, float value)
+{
+    _values[(size_t)y * _state.width + x] = std::min(std::max(value, 0.f), 1.f);
+}
+
+void ConvolutionLife::importGrid(const uint32_t* grid)
+{
+    const uint32_t states = std::max<uint32_t>(_lifeRule.states, 2);
+    for (size_t i = 0; i < _cells.size(); ++i)
+    {
+        _cells[i] = grid[i] < states ? (uint8_t)grid[i] : 0;
+        _values[i] = std::min<uint32_t>(grid[i], 255) / 255.f;
+    }
+}
+
+void ConvolutionLife::exportGrid(uint32_t* grid) const
+{
+    for (size_t i = 0; i < _cells.size(); ++i)
+        grid[i] = _lenia ? (uint32_t)lrintf(_values[i] * 255.f) : _cells[i];
+}
+
+// JDLVSample on the summed quantity; a padding cell counts as live when its state is 1.
+float ConvolutionLife::sample(const float* source, int32_t x, int32_t y) const
+{
+    const int32_t width = (int32_t)_state.width;
+    const int32_t height = (int32_t)_state.height;
+    const bool outside = x < 0 || y < 0 || x >= width || y >= height;
+
+    switch (_state.topology)
+    {
+        case JDLVTopologyTorus:
+            break;
+        case JDLVTopologyKleinBottle:
+            if (y < 0 || y >= height)
+                x = width - 1 - x;
+            break;
+        case JDLVTopologyPadded:
+            if (outside)
+                return (_state.paddingState == 1 ? 1.f : 0.f);
+            break;
+        default:
+            if (outside)
+                return (0.f);
+            break;
+    }
+    x = (x + width) % width;
+    y = (y + height) % height;
+    return (source[(size_t)y * _state.width + (uint32_t)x]);
+}
+
+// Cell (x, y) lands at (x, y) mod the grid size; the halo sits in the wrapped margin.
+void ConvolutionLife::fillExtended(const float* source, uint32_t halo, uint32_t extendedWidth, uint32_t extendedHeight)
+{
+    const int32_t width = (int32_t)_state.width, height = (int32_t)_state.height;
+    const int32_t r = (int32_t)halo;
+    if (extendedWidth == _state.width && extendedHeight == _state.height)
+    {
+        std::copy(source, source + _live.size(), _extended.begin());
+        return;
+    }
+    std::fill(_extended.begin(), _extended.end(), 0.f);
+    for (int32_t y = -r; y < height + r; ++y)
+    {
+        float* row = &_extended[(size_t)((y + (int32_t)extendedHeight) % (int32_t)extendedHeight) * extendedWidth];
+        if (y >= 0 && y < height)
+            std::copy(source + (size_t)y * width, source + (size_t)(y + 1) * width, row);
+        else
+            for (int32_t x = 0; x < width; ++x)
+                row[x] = sample(source, x, y);
+        for (int32_t x = 1; x <= r; ++x)
+        {
+            row[extendedWidth - x] = sample(source, -x, y);
+            row[width - 1 + x] = sample(source, width - 1 + x, y);
+        }
+    }
+}
+
+void ConvolutionLife::sumsByFFT()
+{
+    const float* source = _lenia ? _values.data() : _live.data();
+    const uint32_t extendedWidth = _fft->width();
+    fillExtended(source, _halo, extendedWidth, _fft->height());
+    _fft->forward(_extended.data(), _spectrum.data(), _pool);
+    for (size_t i = 0; i < _spectrum.size(); ++i)
+    {
+        const FFT2D::Complex a = _spectrum[i], b = _kernelSpectrum[i];
+        _spectrum[i] = FFT2D::Complex(a.real() * b.real() - a.imag() * b.imag(), a.real() * b.imag() + a.imag() * b.real());
+    }
+    _fft->inverse(_spectrum.data(), _extended.data(), _pool);
+    for (uint32_t y = 0; y < _state.height; ++y)
+        std::copy(&_extended[(size_t)y * extendedWidth], &_extended[(size_t)y * extendedWidth] + _state.width,
+                  &_sums[(size_t)y * _state.width]);
+}
+
+// Exact box counts: table[j][i] holds the live cells above and left of extended cell (i, j).
+void ConvolutionLife::sumsBySummedArea()
+{
+    const int32_t width = (int32_t)_state.width, height = (int32_t)_state.height;
+    const int32_t r = (int32_t)_halo;
+    const size_t pitch = (size_t)width + 2 * r + 1;
+    uint32_t* table = _summedArea.data();
+
+    for (int32_t j = 0; j < height + 2 * r; ++j)
+    {
+        const int32_t y = j - r;
+        uint32_t* above = table + (size_t)j * pitch;
+        uint32_t* row = above + pitch;
+        uint32_t running = 0;
+        for (int32_t i = 0; i < width + 2 * r; ++i)
+        {
+            const int32_t x = i - r;
+            const bool inside = x >= 0 && x < width && y >= 0 && y < height;
+            running += (inside ? _live[(size_t)y * width + x] : sample(_live.data(), x, y)) != 0;
+            row[i + 1] = above[i + 1] + running;
+        }
+    }
+
+    const uint32_t side = 2 * _halo + 1;
+    const float centre = _lifeRule.countCentre ? 0.f : 1.f;
+    for (int32_t y = 0; y < height; ++y)
+    {
+        const uint32_t* top = table + (size_t)y * pitch;
+        const uint32_t* bottom = top + side * pitch;
+        for (int32_t x = 0; x < width; ++x)
+        {
+            const uint32_t count = bottom[x + side] - bottom[x] - top[x + side] + top[x];
+            _sums[(size_t)y * width + x] = (float)count - centre * _live[(size_t)y * width + x];
+        }
+    }
+}
+
+void ConvolutionLife::step()
+{
+    const size_t cells = _cells.size();
+    if (!_lenia)
+        for (size_t i = 0; i < cells; ++i)
+            _live[i] = _cells[i] == 1 ? 1.f : 0.f;
+
+    if (method() == Method::SummedArea)
+        sumsBySummedArea();
+    else
+        sumsByFFT();
+
+    const auto update = [this](uint32_t begin, uint32_t end)
+    {
+        const size_t first = (size_t)begin * _state.width, last = (size_t)end * _state.width;
+        if (_lenia)
+        {
+            const LeniaRule& rule = _leniaRule;
+            const float spread = 2 * rule.sigma * rule.sigma;
+            for (size_t i = first; i < last; ++i)
+            {
+                const float offset = _sums[i] - rule.mu;
+                const float growth = 2.f * expf(-offset * offset / spread) - 1.f;
+                _values[i] = std::min(std::max(_values[i] + rule.dt * growth, 0.f), 1.f);
+            }
+            return;
+        }
+        const LargerThanLifeRule& rule = _lifeRule;
+        const uint32_t states = std::max<uint32_t>(rule.states, 2);
+        for (size_t i = first; i < last; ++i)
+        {
+            // The FFT sums are integers up to rounding.
+            const uint32_t count = (uint32_t)std::max(lrintf(_sums[i]), 0l);
+            const uint8_t state = _cells[i];
+            if (state == 0)
+                _cells[i] = count >= rule.birthMin && count <= rule.birthMax;
+            else if (state == 1)
+                _cells[i] = count >= rule.surviveMin && count <= rule.surviveMax ? 1 : states > 2 ? 2 : 0;
+            else
+                _cells[i] = (uint8_t)((state + 1) % states);
+        }
+    };
+    if (_pool)
+        _pool->parallelFor(_state.height, update);
+    else
+        update(0, _state.height);
+    ++_generation;
+}
+
+void ConvolutionLife::step(uint64_t generations)
+{
+    while (generations--)
+        step();
+}
@@ -0,0 +1,152 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: RMDLConvolutionLife.hpp         +++     +++   **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 19/10/2026 14:22:09      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef RMDLCONVOLUTIONLIFE_HPP
+# define RMDLCONVOLUTIONLIFE_HPP
+
+# include <cstdint>
+# include <memory>
+# include <string>
+# include <vector>
+
+# include "JDLV_shared.h"
+# include "NonCopyable.h"
+# include "RMDLFFT.hpp"
+
+class WorkStealingPool;
+
+/// Larger than Life in Golly's notation, e.g. Bosco's rule
+/// "R5,C0,M1,S34..58,B34..45,NM": range R, C states (0 and 2 are two-state;
+/// more decay like Generations), M1 counts the cell itself, survival and
+/// birth count ranges, and a box (NM), diamond (NN) or circular (NC, cells
+/// within R + 1/2) neighbourhood. Only state 1 counts.
+struct LargerThanLifeRule
+{
+    enum class Shape
+    {
+        Box,
+        Diamond,
+        Circle
+    };
+
+    uint32_t    radius;
+    uint32_t    states;
+    bool        countCentre;
+    uint32_t    surviveMin;
+    uint32_t    surviveMax;
+    uint32_t    birthMin;
+    uint32_t    birthMax;
+    Shape       shape;
+
+    static LargerThanLifeRule bosco() { return { 5, 2, true, 34, 58, 34, 45, Shape::Box }; }
+
+    static bool parse(const std::string& text, LargerThanLifeRule& rule);
+    std::string toString() const;
+};
+
+/// Lenia (Chan 2019) on values in [0, 1]: A += dt * G(K * A), clipped, with
+/// K a ring kernel of radius R made of bumps exp(4 - 1 / (r (1 - r))) scaled
+/// by `peaks`, normalised to 1, and G(u) = 2 exp(-(u - mu)^2 / 2 sigma^2) - 1.
+/// One peak with a Gaussian growth is also the usual smooth stand-in for SmoothLife.
+struct LeniaRule
+{
+    uint32_t            radius;
+    float               mu;
+    float               sigma;
+    float               dt;
+    std::vector<float>  peaks;
+
+    static LeniaRule orbium() { return { 13, 0.15f, 0.015f, 0.1f, { 1.f } }; }
+};
+
+/// Large-radius rules on the JDLV board, with the neighbourhood sum taken
+/// by convolution: FFT of the board times the kernel's spectrum (computed
+/// once per rule), so a step costs O(log n) per cell whatever the radius.
+/// The board is embedded in a power-of-two grid with an R-cell halo filled
+/// from the topology, large enough that the circular convolution never
+/// wraps onto itself; a power-of-two torus needs no halo at all, and dead
+/// surroundings only R zero cells of margin. Box
+/// neighbourhoods take a summed-area table instead: exact integer counts,
+/// O(1) per cell.
+class ConvolutionLife : public NonCopyable
+{
+public:
+    enum class Method
+    {
+        Auto,           // summed-area table for Larger than Life box rules, FFT otherwise
+        SummedArea,
+        FFT
+    };
+
+    explicit ConvolutionLife(const JDLVState& state, WorkStealingPool* pool = nullptr);
+    ~ConvolutionLife();
+
+    const JDLVState&    state() const       { return _state; }
+    uint32_t            width() const       { return _state.width; }
+    uint32_t            height() const      { return _state.height; }
+    void                setTopology(JDLVTopology topology, uint32_t paddingState = 0);
+    uint64_t            generation() const  { return _generation; }
+    void                setGeneration(uint64_t generation) { _generation = generation; }
+
+    /// False (board unchanged) when 2R + 1 does not fit in the board.
+    bool                setRule(const LargerThanLifeRule& rule);
+    bool                setRule(const LeniaRule& rule);
+    bool                isLenia() const     { return (_lenia); }
+    /// SummedArea only applies to Larger than Life box rules; false otherwise.
+    bool                setMethod(Method method);
+    /// The method step() actually uses.
+    Method              method() const;
+
+    void                clear();
+    /// Larger than Life states, width * height.
+    const std::vector<uint8_t>& cells() const   { return _cells; }
+    /// Lenia values in [0, 1], width * height.
+    const std::vector<float>&   values() const  { return _values; }
+    void                setCell(uint32_t x, uint32_t y, uint8_t state);
+    void                setValue(uint32_t x, uint32_t y, float value);
+
+    /// JDLV layout. Lenia values read and write as 0..255.
+    void                importGrid(const uint32_t* grid);
+    void                exportGrid(uint32_t* grid) const;
+
+    void                step();
+    void                step(uint64_t generations);
+
+private:
+    bool                fits(uint32_t radius) const;
+    void                prepare();
+    float               sample(const float* source, int32_t x, int32_t y) const;
+    void                fillExtended(const float* source, uint32_t halo, uint32_t extendedWidth, uint32_t extendedHeight);
+    void                sumsByFFT();
+    void                sumsBySummedArea();
+
+    JDLVState               _state;
+    WorkStealingPool*       _pool;
+    bool                    _lenia;
+    LargerThanLifeRule      _lifeRule;
+    LeniaRule               _leniaRule;
+    Method                  _method;
+    uint64_t                _generation;
+
+    std::vector<uint8_t>    _cells;
+    std::vector<float>      _values;
+    std::vector<float>      _live;          // what the kernel sums: state 1, or the Lenia value
+    std::vector<float>      _sums;          // neighbourhood sum per cell
+
+    // Convolution grid, halo included.
+    std::unique_ptr<FFT2D>  _fft;
+    uint32_t                _halo;
+    std::vector<float>      _extended;
+    std::vector<FFT2D::Complex> _spectrum;
+    std::vector<FFT2D::Complex> _kernelSpectrum;
+    std::vector<uint32_t>   _summedArea;
+};
+
+#endif /* RMDLCONVOLUTIONLIFE_HPP */
@@ -0,0 +1,104 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: RMDLDirtyRangeTracker.cpp     +++     +++     **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 19/10/2026 17:31:18      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+#include "RMDLDirtyRangeTracker.hpp"
+
+DirtyRangeTracker::DirtyRangeTracker(size_t gapThreshold)
+    : _gapThreshold(gapThreshold)
+    , _sorted(true)
+{
+}
+
+void DirtyRangeTracker::add(size_t offset, size_t length)
+{
+    if (length == 0)
+        return;
+    // Runs written in order (rows of tiles) extend the last range without a sort.
+    if (_sorted && !_ranges.empty())
+    {
+        Range& last = _ranges.back();
+        const size_t end = last.offset + last.length;
+        if (offset >= last.offset && offset <= end + _gapThreshold)
+        {
+            last.length = std::max(end, offset + length) - last.offset;
+            return;
+        }
+        if (offset < last.offset)
+            _sorted = false;
+    }
+    _ranges.push_back({ offset, length });
+}
+
+void DirtyRangeTracker::clear()
+{
+    _ranges.clear();
+    _sorted = true;
+}
+
+void DirtyRangeTracker::coalesce()
+{
+    if (_sorted)
+        return;
+    std::sort(_ranges.begin(), _ranges.end(), [](const Range& a, const Range& b) { return (a.offset < b.offset); });
+    size_t kept = 0;
+    for (size_t i = 1; i < _ranges.size(); ++i)
+    {
+        Range& last = _ranges[kept];
+        const size_t end = last.offset + last.length;
+        if (_ranges[i].offset <= end + _gapThreshold)
+            last.length = std::max(end, _ranges[i].offset + _ranges[i].length) - last.offset;
+        else
+            _ranges[++kept] = _ranges[i];
+    }
+    _ranges.resize(_ranges.empty() ? 0 : kept + 1);
+    _sorted = true;
+}
+
+const std::vector<DirtyRangeTracker::Range>& DirtyRangeTracker::ranges()
+{
+    coalesce();
+    return (_ranges);
+}
+
+size_t DirtyRangeTracker::bytes()
+{
+    coalesce();
+    size_t total = 0;
+    for (const Range& range : _ranges)
+        total += range.length;
+    return (total);
+}
+
+size_t DirtyRangeTracker::flush(const void* source, UploadTarget& target)
+{
+    coalesce();
+    const uint8_t* from = static_cast<const uint8_t*>(source);
+    uint8_t* to = target.contents();
+    const size_t size = target.length();
+    size_t total = 0;
+    for (const Range& range : _ranges)
+    {
+        if (range.offset >= size)
+            break;
+        const size_t length = std::min(range.length, size - range.offset);
+        if (length < range.length)
+            printf("DirtyRangeTracker: range [%zu, %zu) runs past a %zu byte buffer\n",
+                   range.offset, range.offset + range.length, size);
+        memcpy(to + range.offset, from + range.offset, length);
+        target.didModifyRange(range.offset, length);
+        total += length;
+    }
+    clear();
+    return (total);
+}
@@ -0,0 +1,73 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: RMDLDirtyRangeTracker.hpp     +++     +++     **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 19/10/2026 17:31:12      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef RMDLDIRTYRANGETRACKER_HPP
+# define RMDLDIRTYRANGETRACKER_HPP
+
+# include <cstddef>
+# include <cstdint>
+# include <vector>
+
+# include "NonCopyable.h"
+
+/// A CPU-written buffer the GPU reads: a managed MTL::Buffer in the app,
+/// anything that records the calls elsewhere.
+class UploadTarget
+{
+public:
+    virtual ~UploadTarget() {}
+
+    virtual uint8_t*    contents() = 0;
+    virtual size_t      length() const = 0;
+    virtual void        didModifyRange(size_t offset, size_t length) = 0;
+};
+
+/// Collects the byte ranges written since the last flush. Ranges may come
+/// in any order and overlap; flush() sorts them, merges any two separated
+/// by at most gapThreshold() bytes (one call costs more than re-sending a
+/// short gap), copies what is left and flags each range once.
+class DirtyRangeTracker : public NonCopyable
+{
+public:
+    struct Range
+    {
+        size_t  offset;
+        size_t  length;
+    };
+
+    static constexpr size_t kDefaultGapThreshold = 1024;
+
+    explicit DirtyRangeTracker(size_t gapThreshold = kDefaultGapThreshold);
+
+    size_t      gapThreshold() const            { return _gapThreshold; }
+    void        setGapThreshold(size_t bytes)   { _gapThreshold = bytes; _sorted = false; }
+
+    void        add(size_t offset, size_t length);
+    void        clear();
+    bool        empty() const                   { return _ranges.empty(); }
+
+    /// The merged ranges flush() would upload.
+    const std::vector<Range>& ranges();
+    /// Bytes those ranges cover.
+    size_t      bytes();
+
+    /// Copies each merged range from `source` (laid out like the target)
+    /// into the target, flags it, and clears. Returns the bytes uploaded.
+    size_t      flush(const void* source, UploadTarget& target);
+
+private:
+    void        coalesce();
+
+    std::vector<Range>  _ranges;
+    size_t              _gapThreshold;
+    bool                _sorted;        // _ranges is merged under the current threshold
+};
+
+#endif /* RMDLDIRTYRANGETRACKER_HPP */
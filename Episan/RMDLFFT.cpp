@@ -0,0 +1,189 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: RMDLFFT.cpp                     +++     +++   **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 19/10/2026 13:40:31      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include <algorithm>
+#include <cmath>
+
+#include "RMDLFFT.hpp"
+#include "RMDLWorkStealingPool.hpp"
+
+typedef FFT2D::Complex Complex;
+
+static constexpr uint32_t kColumnBlock = 8;
+
+// std::complex's operator* checks for infinities on every product.
+static inline Complex multiply(Complex a, Complex b)
+{
+    return (Complex(a.real() * b.real() - a.imag() * b.imag(), a.real() * b.imag() + a.imag() * b.real()));
+}
+
+uint32_t FFT2D::nextPowerOfTwo(uint32_t n)
+{
+    uint32_t p = 1;
+    while (p < n)
+        p <<= 1;
+    return (p);
+}
+
+FFT2D::FFT2D(uint32_t width, uint32_t height)
+{
+    makePlan(_rows, width);
+    makePlan(_columns, height);
+}
+
+void FFT2D::makePlan(Plan& plan, uint32_t n)
+{
+    plan.n = n;
+    uint32_t bits = 0;
+    while ((1u << bits) < n)
+        ++bits;
+    plan.reversed.resize(n);
+    for (uint32_t i = 0; i < n; ++i)
+    {
+        uint32_t r = 0;
+        for (uint32_t b = 0; b < bits; ++b)
+            r |= ((i >> b) & 1) << (bits - 1 - b);
+        plan.reversed[i] = r;
+    }
+    plan.twiddles.resize(n / 2);
+    for (uint32_t k = 0; k < n / 2; ++k)
+    {
+        const double angle = -2.0 * M_PI * k / n;
+        plan.twiddles[k] = Complex((float)cos(angle), (float)sin(angle));
+    }
+}
+
+void FFT2D::transform(const Plan& plan, Complex* data, bool inverse)
+{
+    const uint32_t n = plan.n;
+    for (uint32_t i = 0; i < n; ++i)
+        if (i < plan.reversed[i])
+            std::swap(data[i], data[plan.reversed[i]]);
+
+    for (uint32_t len = 2; len <= n; len <<= 1)
+    {
+        const uint32_t half = len / 2, step = n / len;
+        for (uint32_t i = 0; i < n; i += len)
+        {
+            for (uint32_t k = 0; k < half; ++k)
+            {
+                const Complex w = inverse ? std::conj(plan.twiddles[k * step]) : plan.twiddles[k * step];
+                const Complex t = multiply(w, data[i + k + half]);
+                data[i + k + half] = data[i + k] - t;
+                data[i + k] += t;
+            }
+        }
+    }
+}
+
+// Rows 2p and 2p + 1 ride as one complex row z = a + ib; with Z its transform,
+// A[k] = (Z[k] + conj Z[-k]) / 2 and B[k] = (Z[k] - conj Z[-k]) / 2i.
+void FFT2D::rowPairs(const float* real, Complex* spectrum, uint32_t begin, uint32_t end) const
+{
+    const uint32_t n = _rows.n, rows = _columns.n;
+    for (uint32_t pair = begin; pair < end; ++pair)
+    {
+        const uint32_t y = pair * 2;
+        const float* a = real + (size_t)y * n;
+        const float* b = y + 1 < rows ? a + n : nullptr;
+        Complex* z = spectrum + (size_t)y * n;
+        for (uint32_t x = 0; x < n; ++x)
+            z[x] = Complex(a[x], b ? b[x] : 0.f);
+        transform(_rows, z, false);
+        if (!b)
+            continue;
+
+        Complex* second = z + n;
+        for (uint32_t k = 0; k <= n / 2; ++k)
+        {
+            const uint32_t mirror = (n - k) % n;
+            const Complex zk = z[k], zm = std::conj(z[mirror]);
+            const Complex first = (zk + zm) * 0.5f;
+            const Complex other = multiply(Complex(0.f, -0.5f), zk - zm);
+            z[k] = first;
+            z[mirror] = std::conj(first);
+            second[k] = other;
+            second[mirror] = std::conj(other);
+        }
+    }
+}
+
+// Both rows of a pair have real inverses, so x + iy comes back from one transform.
+void FFT2D::inverseRowPairs(Complex* spectrum, float* real, uint32_t begin, uint32_t end) const
+{
+    const uint32_t n = _rows.n, rows = _columns.n;
+    const float scale = 1.f / ((float)n * rows);
+    for (uint32_t pair = begin; pair < end; ++pair)
+    {
+        const uint32_t y = pair * 2;
+        Complex* z = spectrum + (size_t)y * n;
+        const bool both = y + 1 < rows;
+        if (both)
+        {
+            const Complex* second = z + n;
+            for (uint32_t x = 0; x < n; ++x)
+                z[x] += Complex(-second[x].imag(), second[x].real());
+        }
+        transform(_rows, z, true);
+        float* a = real + (size_t)y * n;
+        for (uint32_t x = 0; x < n; ++x)
+            a[x] = z[x].real() * scale;
+        if (both)
+            for (uint32_t x = 0; x < n; ++x)
+                a[n + x] = z[x].imag() * scale;
+    }
+}
+
+void FFT2D::columns(Complex* spectrum, uint32_t begin, uint32_t end, bool inverse) const
+{
+    const uint32_t width = _rows.n, height = _columns.n;
+    std::vector<Complex> block((size_t)kColumnBlock * height);
+    for (uint32_t b = begin; b < end; ++b)
+    {
+        const uint32_t x0 = b * kColumnBlock;
+        const uint32_t count = std::min(kColumnBlock, width - x0);
+        for (uint32_t y = 0; y < height; ++y)
+            for (uint32_t i = 0; i < count; ++i)
+                block[(size_t)i * height + y] = spectrum[(size_t)y * width + x0 + i];
+        for (uint32_t i = 0; i < count; ++i)
+            transform(_columns, &block[(size_t)i * height], inverse);
+        for (uint32_t y = 0; y < height; ++y)
+            for (uint32_t i = 0; i < count; ++i)
+                spectrum[(size_t)y * width + x0 + i] = block[(size_t)i * height + y];
+    }
+}
+
+void FFT2D::forward(const float* real, Complex* spectrum, WorkStealingPool* pool) const
+{
+    const uint32_t pairs = (_columns.n + 1) / 2;
+    const uint32_t blocks = (_rows.n + kColumnBlock - 1) / kColumnBlock;
+    if (!pool)
+    {
+        rowPairs(real, spectrum, 0, pairs);
+        columns(spectrum, 0, blocks, false);
+        return;
+    }
+    pool->parallelFor(pairs, [&](uint32_t begin, uint32_t end) { rowPairs(real, spectrum, begin, end); });
+    pool->parallelFor(blocks, [&](uint32_t begin, uint32_t end) { columns(spectrum, begin, end, false); });
+}
+
+void FFT2D::inverse(Complex* spectrum, float* real, WorkStealingPool* pool) const
+{
+    const uint32_t pairs = (_columns.n + 1) / 2;
+    const uint32_t blocks = (_rows.n + kColumnBlock - 1) / kColumnBlock;
+    if (!pool)
+    {
+        columns(spectrum, 0, blocks, true);
+        inverseRowPairs(spectrum, real, 0, pairs);
+        return;
+    }
+    pool->parallelFor(blocks, [&](uint32_t begin, uint32_t end) { columns(spectrum, begin, end, true); });
+    pool->parallelFor(pairs, [&](uint32_t begin, uint32_t end) { inverseRowPairs(spectrum, real, begin, end); });
+}
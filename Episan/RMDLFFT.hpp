@@ -0,0 +1,63 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: RMDLFFT.hpp                     +++     +++   **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 19/10/2026 13:40:26      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef RMDLFFT_HPP
+# define RMDLFFT_HPP
+
+# include <complex>
+# include <cstdint>
+# include <vector>
+
+# include "NonCopyable.h"
+
+class WorkStealingPool;
+
+/// Radix-2 2D FFT of real float grids (width and height powers of two).
+/// Real rows go through the complex transform two at a time, as the real
+/// and imaginary parts of one row, and are split apart afterwards; columns
+/// are transformed in blocks of eight so each row read fills a cache line.
+/// Row and column passes are spread over the pool when one is given.
+class FFT2D : public NonCopyable
+{
+public:
+    typedef std::complex<float> Complex;
+
+    FFT2D(uint32_t width, uint32_t height);
+
+    static bool         isPowerOfTwo(uint32_t n)    { return (n && !(n & (n - 1))); }
+    static uint32_t     nextPowerOfTwo(uint32_t n);
+
+    uint32_t            width() const   { return _rows.n; }
+    uint32_t            height() const  { return _columns.n; }
+
+    /// `real` is width * height floats, row-major; `spectrum` the full width * height spectrum.
+    void                forward(const float* real, Complex* spectrum, WorkStealingPool* pool = nullptr) const;
+    /// Real part of the inverse, divided by width * height. Destroys `spectrum`.
+    void                inverse(Complex* spectrum, float* real, WorkStealingPool* pool = nullptr) const;
+
+private:
+    struct Plan
+    {
+        uint32_t                n;
+        std::vector<uint32_t>   reversed;   // bit-reversal permutation
+        std::vector<Complex>    twiddles;   // exp(-2 pi i k / n), k < n / 2
+    };
+
+    static void         makePlan(Plan& plan, uint32_t n);
+    static void         transform(const Plan& plan, Complex* data, bool inverse);
+    void                rowPairs(const float* real, Complex* spectrum, uint32_t begin, uint32_t end) const;
+    void                inverseRowPairs(Complex* spectrum, float* real, uint32_t begin, uint32_t end) const;
+    void                columns(Complex* spectrum, uint32_t begin, uint32_t end, bool inverse) const;
+
+    Plan                _rows;
+    Plan                _columns;
+};
+
+#endif /* RMDLFFT_HPP */
@@ -0,0 +1,170 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: RMDLFrameTelemetry.cpp        +++     +++     **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 18/10/2026 11:40:24      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+#include "RMDLFrameTelemetry.hpp"
+
+static uint64_t steadyClock()
+{
+    return ((uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+FrameTelemetry::FrameTelemetry(uint32_t capacity, Clock clock)
+    : _mask(0)
+    , _clock(clock ? clock : steadyClock)
+    , _frame()
+    , _published(0)
+{
+    uint32_t size = 1;
+    while (size < capacity)
+        size <<= 1;
+    _mask = size - 1;
+    _slots.reset(new Slot[size]);
+    for (uint32_t i = 0; i < size; ++i)
+    {
+        _slots[i].sequence.store(0, std::memory_order_relaxed);
+        for (size_t w = 0; w < kRecordWords; ++w)
+            _slots[i].words[w].store(0, std::memory_order_relaxed);
+    }
+}
+
+FrameTelemetry::~FrameTelemetry()
+{
+}
+
+const char* FrameTelemetry::stageName(FrameStage stage)
+{
+    switch (stage)
+    {
+        case FrameStage::Triangle:      return ("Triangle");
+        case FrameStage::GridUpload:    return ("Grid Upload");
+        case FrameStage::GridRender:    return ("Grid Render");
+        case FrameStage::Text:          return ("Text");
+        default:                        return ("?");
+    }
+}
+
+void FrameTelemetry::beginFrame(uint64_t frameIndex)
+{
+    memset(&_frame, 0, sizeof(_frame));
+    _frame.frameIndex = frameIndex;
+    _frame.frameBegin = _clock();
+}
+
+void FrameTelemetry::endFrame()
+{
+    _frame.frameEnd = _clock();
+    _frame.serial = _published.load(std::memory_order_relaxed);
+
+    uint64_t words[kRecordWords];
+    memcpy(words, &_frame, sizeof(words));
+
+    Slot& slot = _slots[_frame.serial & _mask];
+    const uint64_t sequence = slot.sequence.load(std::memory_order_relaxed);
+    slot.sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    for (size_t w = 0; w < kRecordWords; ++w)
+        slot.words[w].store(words[w], std::memory_order_relaxed);
+    slot.sequence.store(sequence + 2, std::memory_order_release);
+
+    _published.store(_frame.serial + 1, std::memory_order_release);
+}
+
+bool FrameTelemetry::read(uint64_t serial, FrameRecord& record) const
+{
+    const Slot& slot = _slots[serial & _mask];
+    uint64_t words[kRecordWords];
+    for (int attempt = 0; attempt < 16; ++attempt)
+    {
+        const uint64_t before = slot.sequence.load(std::memory_order_acquire);
+        if (before & 1)
+            continue;
+        for (size_t w = 0; w < kRecordWords; ++w)
+            words[w] = slot.words[w].load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.sequence.load(std::memory_order_relaxed) != before)
+            continue;
+        memcpy(&record, words, sizeof(record));
+        // The writer lapped us: the slot already holds a newer frame.
+        return (record.serial == serial);
+    }
+    return (false);
+}
+
+void FrameTelemetry::snapshot(std::vector<FrameRecord>& frames, uint32_t maxFrames) const
+{
+    frames.clear();
+    const uint64_t end = framesRecorded();
+    const uint64_t count = std::min<uint64_t>({ end, (uint64_t)_mask + 1, maxFrames });
+    frames.reserve(count);
+    for (uint64_t serial = end - count; serial < end; ++serial)
+    {
+        FrameRecord record;
+        if (read(serial, record))
+            frames.push_back(record);
+    }
+}
+
+static void writeCompleteEvent(FILE* file, bool& first, const char* name, const char* category,
+                               uint32_t tid, uint64_t begin, uint64_t end, uint64_t frameIndex)
+{
+    if (begin == 0 || end < begin)
+        return;
+    fprintf(file, "%s\n{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,"
+                  "\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"frame\":%llu}}",
+            first ? "" : ",", name, category, tid, begin / 1000.0, (end - begin) / 1000.0,
+            (unsigned long long)frameIndex);
+    first = false;
+}
+
+bool FrameTelemetry::writeChromeTrace(FILE* file) const
+{
+    std::vector<FrameRecord> frames;
+    snapshot(frames);
+
+    // Two tracks: whole frames on top, the wait and the encodes below them.
+    fprintf(file, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+    fprintf(file, "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"Frame\"}}");
+    fprintf(file, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":2,\"args\":{\"name\":\"Encode\"}}");
+    bool first = false;
+
+    for (const FrameRecord& frame : frames)
+    {
+        char name[32];
+        snprintf(name, sizeof(name), "Frame %llu", (unsigned long long)frame.frameIndex);
+        writeCompleteEvent(file, first, name, "frame", 1, frame.frameBegin, frame.frameEnd, frame.frameIndex);
+        writeCompleteEvent(file, first, "Wait in-flight", "wait", 2, frame.waitBegin, frame.waitEnd, frame.frameIndex);
+        for (size_t s = 0; s < (size_t)FrameStage::Count; ++s)
+            writeCompleteEvent(file, first, stageName((FrameStage)s), "encode", 2,
+                               frame.stageBegin[s], frame.stageEnd[s], frame.frameIndex);
+        fprintf(file, ",\n{\"name\":\"Allocations\",\"ph\":\"C\",\"pid\":1,\"ts\":%.3f,"
+                      "\"args\":{\"count\":%llu,\"bytes\":%llu}}",
+                frame.frameBegin / 1000.0, (unsigned long long)frame.allocations,
+                (unsigned long long)frame.allocatedBytes);
+    }
+    fprintf(file, "\n]}\n");
+    return (!ferror(file));
+}
+
+bool FrameTelemetry::writeChromeTrace(const std::string& path) const
+{
+    FILE* file = fopen(path.c_str(), "w");
+    if (!file)
+    {
+        printf("Cannot write frame trace %s\n", path.c_str());
+        return (false);
+    }
+    const bool written = writeChromeTrace(file);
+    return (fclose(file) == 0 && written);
+}
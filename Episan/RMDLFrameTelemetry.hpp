@@ -0,0 +1,134 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: RMDLFrameTelemetry.hpp        +++     +++     **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 18/10/2026 11:40:18      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef RMDLFRAMETELEMETRY_HPP
+# define RMDLFRAMETELEMETRY_HPP
+
+# include <atomic>
+# include <cstdint>
+# include <cstdio>
+# include <memory>
+# include <string>
+# include <vector>
+
+# include "NonCopyable.h"
+
+// Recording is on in Debug builds (Xcode defines DEBUG=1) and can be forced either way.
+# ifndef RMDL_FRAME_TELEMETRY
+#  if defined(DEBUG) && DEBUG
+#   define RMDL_FRAME_TELEMETRY 1
+#  else
+#   define RMDL_FRAME_TELEMETRY 0
+#  endif
+# endif
+
+/// Statements wrapped in RMDL_TELEMETRY vanish when RMDL_FRAME_TELEMETRY is 0.
+# if RMDL_FRAME_TELEMETRY
+#  define RMDL_TELEMETRY(statement) statement
+# else
+#  define RMDL_TELEMETRY(statement) ((void)0)
+# endif
+
+/// CPU work GameCoordinator::draw does per frame, one per command buffer plus the grid upload.
+enum class FrameStage : uint32_t
+{
+    Triangle = 0,
+    GridUpload,
+    GridRender,
+    Text,
+    Count
+};
+
+/// Everything recorded for one frame, clock ticks in nanoseconds. 0 means "not recorded".
+struct FrameRecord
+{
+    uint64_t    serial;             // position in the stream of recorded frames
+    uint64_t    frameIndex;
+    uint64_t    frameBegin;
+    uint64_t    frameEnd;
+    uint64_t    waitBegin;          // blocked on the in-flight shared event
+    uint64_t    waitEnd;
+    uint64_t    stageBegin[(size_t)FrameStage::Count];
+    uint64_t    stageEnd[(size_t)FrameStage::Count];
+    uint64_t    allocations;
+    uint64_t    allocatedBytes;
+
+    uint64_t    waitTime() const                { return waitEnd - waitBegin; }
+    uint64_t    stageTime(FrameStage stage) const { return stageEnd[(size_t)stage] - stageBegin[(size_t)stage]; }
+};
+
+/// Per-frame ring buffer written by the render thread and read from any thread.
+/// Single producer; each slot is a seqlock, so readers never block the writer
+/// and simply retry (or skip) a slot that is being overwritten.
+class FrameTelemetry : public NonCopyable
+{
+public:
+    typedef uint64_t (*Clock)();
+
+    /// `capacity` is rounded up to a power of two; a null clock is std::chrono::steady_clock.
+    explicit FrameTelemetry(uint32_t capacity = 256, Clock clock = nullptr);
+    ~FrameTelemetry();
+
+    static const char*  stageName(FrameStage stage);
+
+    uint64_t    now() const { return _clock(); }
+
+    void        beginFrame(uint64_t frameIndex);
+    void        endFrame();
+    void        beginWait()                     { _frame.waitBegin = _clock(); }
+    void        endWait()                       { _frame.waitEnd = _clock(); }
+    void        beginStage(FrameStage stage)    { _frame.stageBegin[(size_t)stage] = _clock(); }
+    void        endStage(FrameStage stage)      { _frame.stageEnd[(size_t)stage] = _clock(); }
+    void        countAllocation(uint64_t bytes) { ++_frame.allocations; _frame.allocatedBytes += bytes; }
+
+    uint32_t    capacity() const                { return _mask + 1; }
+    /// Frames published since construction, including those the ring has dropped.
+    uint64_t    framesRecorded() const          { return _published.load(std::memory_order_acquire); }
+
+    /// The last `maxFrames` published frames still in the ring, oldest first.
+    void        snapshot(std::vector<FrameRecord>& frames, uint32_t maxFrames = UINT32_MAX) const;
+
+    /// Chrome trace event format (chrome://tracing, Perfetto): one complete event per
+    /// frame, wait and stage, plus allocation counters.
+    bool        writeChromeTrace(FILE* file) const;
+    bool        writeChromeTrace(const std::string& path) const;
+
+private:
+    static constexpr size_t kRecordWords = sizeof(FrameRecord) / sizeof(uint64_t);
+    static_assert(sizeof(FrameRecord) % sizeof(uint64_t) == 0, "FrameRecord is copied word by word");
+
+    struct alignas(64) Slot
+    {
+        std::atomic<uint64_t>   sequence;   // odd while being written
+        std::atomic<uint64_t>   words[kRecordWords];
+    };
+
+    bool        read(uint64_t serial, FrameRecord& record) const;
+
+    std::unique_ptr<Slot[]>     _slots;
+    uint32_t                    _mask;
+    Clock                       _clock;
+    FrameRecord                 _frame;     // producer-private frame in progress
+    std::atomic<uint64_t>       _published;
+};
+
+/// Times one stage for the lifetime of the scope.
+class FrameStageScope : public NonCopyable
+{
+public:
+    FrameStageScope(FrameTelemetry& telemetry, FrameStage stage) : _telemetry(telemetry), _stage(stage) { _telemetry.beginStage(stage); }
+    ~FrameStageScope() { _telemetry.endStage(_stage); }
+
+private:
+    FrameTelemetry& _telemetry;
+    FrameStage      _stage;
+};
+
+#endif /* RMDLFRAMETELEMETRY_HPP */
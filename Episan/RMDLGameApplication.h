@@ -40,4 +40,6 @@
 
 - (void)rotateCameraYaw:(float)yaw Pitch:(float)pitch;
 
+- (void)recordKey:(unichar)key;
+
 @end
@@ -24,6 +24,7 @@
     NSString *chars = [event charactersIgnoringModifiers];
     if (chars.length == 0) { return; }
     unichar character = [chars characterAtIndex:0];
+    [self.gameCoordinator recordKey : character];
     float moveSpeed = 0.065f;
     switch (character)
     {
@@ -229,6 +230,11 @@
     _pGameCoordinator->rotateCamera(yaw, pitch);
 }
 
+- (void)recordKey:(unichar)key
+{
+    _pGameCoordinator->recordKey(key);
+}
+
 - (void)setBrightnessValue:(float)brightness
 {
     _pGameCoordinator->setBrightness(brightness);
@@ -34,6 +34,9 @@
 #include <string.h>
 
 #include "RMDLGameCoordinator.hpp"
+#include "RMDLPatternIO.hpp"
+#include "RMDLLifeCheckpoint.hpp"
+#include "RMDLLifePatterns.hpp"
 
 #define kMaxFramesInFlight 3
 
@@ -56,6 +59,20 @@ enum BufferIndexJDLV
     BufferIndexTriangle = 4
 };
 
+// A managed MTL::Buffer as DirtyRangeTracker's upload target.
+class ManagedBufferTarget : public UploadTarget
+{
+public:
+    explicit ManagedBufferTarget(MTL::Buffer* buffer) : _buffer(buffer) {}
+
+    uint8_t*    contents() override { return (static_cast<uint8_t*>(_buffer->contents())); }
+    size_t      length() const override { return ((size_t)_buffer->length()); }
+    void        didModifyRange(size_t offset, size_t length) override { _buffer->didModifyRange( NS::Range(offset, length) ); }
+
+private:
+    MTL::Buffer*    _buffer;
+};
+
 // Version améliorée de buildTextVertices avec support de viewport
 void buildTextVerticesC(const std::string& text,
                        const FontAtlas& font,
@@ -218,8 +235,12 @@ GameCoordinator::GameCoordinator(MTL::Device* pDevice,
     , _frameNumber(0)
     , _pViewportSizeBuffer(nullptr)
     , _pJDLVRenderPSO(nullptr)
-    , _pJDLVComputePSO(nullptr)
-    , _useBufferAAsSource(true)
+    , _gridSerial{0}
+    , _rule(LifeRule::conway())
+    , _ruleTable(false)
+    , _topology(JDLVTopologyPlane)
+    , _paddingState(0)
+    , _simulation({ kGridWidth, kGridHeight, JDLVTopologyPlane, 0 })
     , _pDepthStencilStateJDLV(nullptr)
 {
     printf("GameCoordinator constructor called\n");
@@ -237,6 +258,8 @@ GameCoordinator::GameCoordinator(MTL::Device* pDevice,
     _pShaderLibrary = _pDevice->newDefaultLibrary(); // MTL::Library* MTL::Device::newDefaultLibrary(const NS::Bundle*, NS::Error**)
 
     size_t gridSize = kGridWidth * kGridHeight * sizeof(uint32_t);
+    LifeDensityPyramid emptyDensity;
+    emptyDensity.reset({ kGridWidth, kGridHeight, JDLVTopologyPlane, 0 });
 
     for (uint8_t i = 0; i < kMaxFramesInFlight; i++)
     {
@@ -247,12 +270,12 @@ GameCoordinator::GameCoordinator(MTL::Device* pDevice,
         _pCommandAllocator[i] = _pDevice->newCommandAllocator();
 
         _pJDLVStateBuffer[i] = _pDevice->newBuffer( sizeof(JDLVState), MTL::ResourceStorageModeManaged );
-        _pGridBuffer_A[i] = _pDevice->newBuffer( gridSize, MTL::ResourceStorageModeManaged );
-        _pGridBuffer_B[i] = _pDevice->newBuffer( gridSize, MTL::ResourceStorageModeManaged );
-        ft_memset(_pGridBuffer_A[i]->contents(), 0, gridSize);
-        ft_memset(_pGridBuffer_B[i]->contents(), 0, gridSize);
-        _pGridBuffer_A[i]->didModifyRange( NS::Range(0, gridSize) );
-        _pGridBuffer_B[i]->didModifyRange( NS::Range(0, gridSize) );
+        _pGridBuffer[i] = _pDevice->newBuffer( gridSize, MTL::ResourceStorageModeManaged );
+        ft_memset(_pGridBuffer[i]->contents(), 0, gridSize);
+        _pGridBuffer[i]->didModifyRange( NS::Range(0, gridSize) );
+        _pDensityBuffer[i] = _pDevice->newBuffer( emptyDensity.bytes(), MTL::ResourceStorageModeManaged );
+        ft_memcpy(_pDensityBuffer[i]->contents(), emptyDensity.data(), emptyDensity.bytes());
+        _pDensityBuffer[i]->didModifyRange( NS::Range(0, emptyDensity.bytes()) );
 
         _pTextBuffer[i] = _pDevice->newBuffer(sizeof(TextVertex), MTL::ResourceStorageModeShared);
         //    auto vbuf = _pDevice->newBuffer(textVertices.data(), textVertices.size() * sizeof(TextVertex),
@@ -262,6 +285,7 @@ GameCoordinator::GameCoordinator(MTL::Device* pDevice,
     _textureAssets["fontAtlas"] = font.texture;
 
     initGrid();
+    _simulation.start();
     buildJDLVPipelines();
     buildDepthStencilStates( width, height );
 
@@ -288,16 +312,16 @@ GameCoordinator::GameCoordinator(MTL::Device* pDevice,
 
 GameCoordinator::~GameCoordinator()
 {
+    _simulation.stop();
     for (uint8_t i = 0; i < kMaxFramesInFlight; ++i)
     {
         _pTriangleDataBuffer[i]->release();
         _pCommandAllocator[i]->release();
         _pInstanceDataBuffer[i]->release();
         _pJDLVStateBuffer[i]->release();
-        _pGridBuffer_A[i]->release();
-        _pGridBuffer_B[i]->release();
+        _pGridBuffer[i]->release();
+        _pDensityBuffer[i]->release();
     }
-    _pJDLVComputePSO->release();
     _pJDLVRenderPSO->release();
     _pTexture->release();
     _pDepthStencilState->release();
@@ -369,43 +393,94 @@ void GameCoordinator::buildDepthStencilStates( NS::UInteger width, NS::UInteger
 
 void GameCoordinator::initGrid()
 {
-    uint32_t* gridData = static_cast<uint32_t*>(_pGridBuffer_A[0]->contents());
-
-    int gunPattern[36][9] = {
-            {1,0,1,0,1,0,1,1,1},
-            {1,0,1,0,0,0,1,0,0},
-            {1,0,1,0,1,0,0,1,0},
-            {0,1,0,0,1,1,1,0,0},
-            {1,0,0,0,0,0,1,1,0},
-            {1,1,0,0,0,1,1,0,1},
-            {0,1,1,0,0,0,0,1,0},
-            {1,0,0,1,1,1,1,1,1},
-            {0,1,1,1,1,1,1,1,1},
-            {0,0,1,1,1,0,0,1,1},
-            {0,0,0,1,1,1,0,1,0},
-            {0,0,0,1,0,1,1,1,0},
-            {0,0,0,1,0,1,1,0,1},
-            {0,0,0,1,1,1,1,1,0},
-            {0,0,0,0,0,1,1,1,0},
-            {1,1,0,1,0,1,1,1,0},
-            {1,1,0,1,1,1,1,0,1} };
-
-    int startX = kGridWidth / 2 - 4;
-    int startY = kGridHeight / 2 - 8;
-    
-    for (int y = 0; y < 17; y++)
+    std::vector<uint32_t> grid(kGridWidth * kGridHeight, 0);
+
+    life_patterns::seedGun({ kGridWidth, kGridHeight, JDLVTopologyPlane, 0 }, grid.data());
+    _simulation.loadGrid(grid.data());
+}
+
+bool GameCoordinator::loadPattern(const std::string& path)
+{
+    const JDLVState state = { kGridWidth, kGridHeight, (uint32_t)_topology, _paddingState };
+    std::vector<uint32_t> grid(kGridWidth * kGridHeight, 0);
+
+    pattern_io::GridSink sink(state, grid.data(), true);
+    pattern_io::PatternInfo info;
+    if (!pattern_io::loadPattern(path.c_str(), sink, info))
+        return (false);
+    // Cells laid out for one rule mean nothing under another: refuse the file rather than run it wrong.
+    if (info.hasRule && !setRule(info.rule))
     {
-        for (int x = 0; x < 9; x++)
-        {
-            int gridX = startX + x;
-            int gridY = startY + y;
-            if (gridX >= 0 && gridX < kGridWidth && gridY >= 0 && gridY < kGridHeight)
-            {
-                gridData[gridY * kGridWidth + gridX] = gunPattern[y][x];
-            }
-        }
+        printf("JDLV: %s needs rule %s, pattern not loaded\n", path.c_str(), info.rule.toString().c_str());
+        return (false);
     }
-    _pGridBuffer_A[0]->didModifyRange( NS::Range(0, kGridWidth * kGridHeight * sizeof(uint32_t)) );
+    _simulation.loadGrid(grid.data(), info.generation);
+    return (true);
+}
+
+bool GameCoordinator::loadRuleTable(const std::string& path)
+{
+    RuleTable table;
+    if (!RuleTable::load(path.c_str(), table))
+        return (false);
+    _simulation.setRuleTable(table);
+
+    // Only the state count reaches the GPU, for JDLVFragment's fade.
+    _sharedEvent->waitUntilSignaledValue(_currentFrameIndex, DISPATCH_TIME_FOREVER);
+    _rule = { 0, 0, table.states() };
+    _ruleTable = true;
+    _pJDLVRenderPSO->release();
+    buildJDLVRulePipelines();
+    return (true);
+}
+
+bool GameCoordinator::restoreCheckpoint(const std::string& path)
+{
+    LifeCheckpointHeader header;
+    if (!LifeCheckpoint::readHeader(path.c_str(), header) || header.width != kGridWidth || header.height != kGridHeight)
+        return (false);
+
+    // The file maps straight into a packed engine; the simulation takes a copy of the board.
+    LifeEngine engine({ kGridWidth, kGridHeight, header.topology, header.paddingState });
+    if (!LifeCheckpoint::restore(path.c_str(), engine))
+        return (false);
+    std::vector<uint32_t> grid(kGridWidth * kGridHeight, 0);
+    engine.exportGrid(grid.data());
+
+    setRule(engine.rule());
+    setTopology(engine.topology(), engine.state().paddingState);
+    _simulation.loadGrid(grid.data(), engine.generation());
+    return (true);
+}
+
+bool GameCoordinator::startEventLog(const std::string& path)
+{
+    std::shared_ptr<LifeEventLog> log = std::make_shared<LifeEventLog>();
+    if (!log->open(path.c_str(), kGridWidth, kGridHeight))
+        return (false);
+    _eventLog = log;
+    _simulation.setEventLog(log);
+    return (true);
+}
+
+void GameCoordinator::stopEventLog()
+{
+    // The simulation writes the End event and drops its reference; the file closes with the last one.
+    _simulation.setEventLog(nullptr);
+    _eventLog.reset();
+}
+
+void GameCoordinator::recordKey(uint32_t key)
+{
+    if (_eventLog)
+        _eventLog->key(_simulation.generation(), key);
+}
+
+void GameCoordinator::setTopology(JDLVTopology topology, uint32_t paddingState)
+{
+    _topology = topology;
+    _paddingState = paddingState;
+    _simulation.setTopology(topology, paddingState);
 }
 
 void GameCoordinator::createTextPipeline()
@@ -461,15 +536,35 @@ void GameCoordinator::createTextPipeline()
 }
 
 
-void GameCoordinator::buildJDLVPipelines()
+bool GameCoordinator::setRule(const LifeRule& rule)
+{
+    if (rule.states < 2 || rule.bornFromNothing())
+    {
+        printf("JDLV: rule %s is not supported on the GPU\n", rule.toString().c_str());
+        return (false);
+    }
+    if (rule == _rule && !_ruleTable)
+        return (true);
+    _simulation.setRule(rule);
+    _ruleTable = false;
+
+    // Frames in flight still reference the old pipelines.
+    _sharedEvent->waitUntilSignaledValue(_currentFrameIndex, DISPATCH_TIME_FOREVER);
+    _rule = rule;
+    _pJDLVRenderPSO->release();
+    buildJDLVRulePipelines();
+    return (true);
+}
+
+void GameCoordinator::buildJDLVRulePipelines()
 {
     NS::Error* pError = nullptr;
 
-    MTL::Function* computeFunction = _pShaderLibrary->newFunction(MTLSTR("JDLVCompute"));
-    _pJDLVComputePSO = _pDevice->newComputePipelineState(computeFunction, &pError);
-    computeFunction->release();
-//    MTL4::ComputePipelineDescriptor* computeDescriptor = MTL4::ComputePipelineDescriptor::alloc()->init();
-//    computeDescriptor->setComputeFunctionDescriptor(computeFunction);
+    // JDLVFragment only needs the state count; the simulation thread steps the board on the CPU.
+    const uint32_t stateCount = _rule.states;
+    MTL::FunctionConstantValues* constants = MTL::FunctionConstantValues::alloc()->init();
+    constants->setConstantValue(&stateCount, MTL::DataTypeUInt, JDLVFunctionConstantStateCount);
+
     MTL4::RenderPipelineDescriptor* renderDescriptor = MTL4::RenderPipelineDescriptor::alloc()->init();
     renderDescriptor->setLabel(MTLSTR("JDLV Pipeline"));
     renderDescriptor->colorAttachments()->object(0)->setPixelFormat( MTL::PixelFormatRGBA16Float );
@@ -490,13 +585,30 @@ void GameCoordinator::buildJDLVPipelines()
     MTL4::LibraryFunctionDescriptor* fragmentFunction = MTL4::LibraryFunctionDescriptor::alloc()->init();
     fragmentFunction->setName(MTLSTR("JDLVFragment"));
     fragmentFunction->setLibrary(_pShaderLibrary);
-    renderDescriptor->setFragmentFunctionDescriptor(fragmentFunction);
+    MTL4::SpecializedFunctionDescriptor* specializedFragment = MTL4::SpecializedFunctionDescriptor::alloc()->init();
+    specializedFragment->setFunctionDescriptor(fragmentFunction);
+    specializedFragment->setConstantValues(constants);
+    renderDescriptor->setFragmentFunctionDescriptor(specializedFragment);
 
     MTL4::Compiler* compiler = _pDevice->newCompiler( MTL4::CompilerDescriptor::alloc()->init(), &pError );
     _pJDLVRenderPSO = compiler->newRenderPipelineState(renderDescriptor, nullptr, &pError);
 
+    compiler->release();
+    specializedFragment->release();
+    fragmentFunction->release();
+    vertexFunction->release();
+    renderDescriptor->release();
+    constants->release();
+}
+
+void GameCoordinator::buildJDLVPipelines()
+{
+    NS::Error* pError = nullptr;
+
+    buildJDLVRulePipelines();
+
     MTL4::ArgumentTableDescriptor* computeArgumentTable = MTL4::ArgumentTableDescriptor::alloc()->init();
-    computeArgumentTable->setMaxBufferBindCount(3);
+    computeArgumentTable->setMaxBufferBindCount(4);
     computeArgumentTable->setLabel( NS::String::string( "p argument table descriptor JDLV", NS::ASCIIStringEncoding ) );
 
     _pArgumentTableJDLV = _pDevice->newArgumentTable(computeArgumentTable, &pError);
@@ -510,8 +622,8 @@ void GameCoordinator::buildJDLVPipelines()
     for (uint8_t i = 0u; i < kMaxFramesInFlight; ++i)
     {
         _pResidencySet->addAllocation(_pJDLVStateBuffer[i]);
-        _pResidencySet->addAllocation(_pGridBuffer_A[i]);
-        _pResidencySet->addAllocation(_pGridBuffer_B[i]);
+        _pResidencySet->addAllocation(_pGridBuffer[i]);
+        _pResidencySet->addAllocation(_pDensityBuffer[i]);
     }
     _pResidencySet->commit();
 
@@ -618,10 +730,14 @@ void GameCoordinator::buildRenderTextures(NS::UInteger nativeWidth, NS::UInteger
 
 void GameCoordinator::moveCamera( simd::float3 translation )
 {
+    if (_eventLog)
+        _eventLog->moveCamera(_simulation.generation(), translation.x, translation.y, translation.z);
 }
 
 void GameCoordinator::rotateCamera(float deltaYaw, float deltaPitch)
 {
+    if (_eventLog)
+        _eventLog->rotateCamera(_simulation.generation(), deltaYaw, deltaPitch);
 }
 
 void GameCoordinator::setCameraAspectRatio(float aspectRatio)
@@ -633,6 +749,7 @@ void GameCoordinator::draw( MTK::View* _pView )
     NS::AutoreleasePool *pPool = NS::AutoreleasePool::alloc()->init();
 
     _currentFrameIndex += 1;
+    RMDL_TELEMETRY(_telemetry.beginFrame(_currentFrameIndex));
 
     const uint32_t frameIndex = _currentFrameIndex % kMaxFramesInFlight;
     std::string label = "Frame: " + std::to_string(_currentFrameIndex);
@@ -640,7 +757,9 @@ void GameCoordinator::draw( MTK::View* _pView )
     if (_currentFrameIndex > kMaxFramesInFlight)
     {
         uint64_t const timeStampToWait = _currentFrameIndex - kMaxFramesInFlight;
+        RMDL_TELEMETRY(_telemetry.beginWait());
         _sharedEvent->waitUntilSignaledValue(timeStampToWait, DISPATCH_TIME_FOREVER);
+        RMDL_TELEMETRY(_telemetry.endWait());
     }
 
     viewPort.originX = 0.0;
@@ -660,7 +779,9 @@ void GameCoordinator::draw( MTK::View* _pView )
 
     _pCommandAllocator[frameIndex]->reset();
 
+    RMDL_TELEMETRY(_telemetry.beginStage(FrameStage::Triangle));
     _pCommandBuffer[0] = _pDevice->newCommandBuffer();
+    RMDL_TELEMETRY(_telemetry.countAllocation(0));
     _pCommandBuffer[0]->beginCommandBuffer(_pCommandAllocator[frameIndex]);
     _pCommandBuffer[0]->setLabel( NS::String::string( label.c_str(), NS::ASCIIStringEncoding ) );
 
@@ -690,68 +811,71 @@ void GameCoordinator::draw( MTK::View* _pView )
     renderPassEncoder->drawPrimitives( MTL::PrimitiveTypeTriangle, NS::UInteger(0), NS::UInteger(3) );
     renderPassEncoder->endEncoding();
     _pCommandBuffer[0]->endCommandBuffer();
+    RMDL_TELEMETRY(_telemetry.endStage(FrameStage::Triangle));
 
-    _pCommandBuffer[1] = _pDevice->newCommandBuffer();
-    _pCommandBuffer[1]->beginCommandBuffer(_pCommandAllocator[frameIndex]);
-
-    JDLVState* jdlvState = static_cast<JDLVState*>(_pJDLVStateBuffer[frameIndex]->contents());
-    jdlvState->width = kGridWidth;
-    jdlvState->height = kGridHeight;
-    _pJDLVStateBuffer[frameIndex]->didModifyRange( NS::Range(0, sizeof(JDLVState)) );
-    MTL::Buffer* sourceGrid = _useBufferAAsSource ? _pGridBuffer_A[frameIndex] : _pGridBuffer_B[frameIndex];
-    MTL::Buffer* destGrid = _useBufferAAsSource ? _pGridBuffer_B[frameIndex] : _pGridBuffer_A[frameIndex];
-
-    _pArgumentTableJDLV->setAddress(sourceGrid->gpuAddress(), 0);
-    _pArgumentTableJDLV->setAddress(destGrid->gpuAddress(), 1);
-    _pArgumentTableJDLV->setAddress(_pJDLVStateBuffer[frameIndex]->gpuAddress(), 2);
-//    renderPassEncoder->setArgumentTable(_pArgumentTableJDLV, MTL::RenderStageVertex);
-
-    MTL4::ComputeCommandEncoder* computeEncoder = _pCommandBuffer[1]->computeCommandEncoder();
-    computeEncoder->setLabel(MTLSTR("JDLV Compute"));
-
-    computeEncoder->setComputePipelineState(_pJDLVComputePSO);
-
-    computeEncoder->setArgumentTable(_pArgumentTableJDLV);
-
-    MTL::Size gridSize = MTL::Size(kGridWidth, kGridHeight, 1);
-    MTL::Size threadgroupSize = MTL::Size(16, 16, 1);
-    MTL::Size threadgroups = MTL::Size((gridSize.width + threadgroupSize.width - 1) / threadgroupSize.width, (gridSize.height + threadgroupSize.height - 1) / threadgroupSize.height, 1);
+    // The board is stepped by _simulation; this slot only needs its latest generation.
+    RMDL_TELEMETRY(_telemetry.beginStage(FrameStage::GridUpload));
+    _simulation.acquireFrame();
+    const LifeFrame& lifeFrame = _simulation.frame();
+    if (_gridSerial[frameIndex] != lifeFrame.serial)
+    {
+        // Only the tiles published since this slot was last written are copied.
+        lifeFrame.dirtyRanges(_gridSerial[frameIndex], _gridRanges);
+        for (const LifeGridRange& range : _gridRanges)
+            _uploadTracker.add(range.offset, range.length);
+        ManagedBufferTarget grid(_pGridBuffer[frameIndex]);
+        _uploadTracker.flush(lifeFrame.grid.data(), grid);
+        // The pyramid levels above those tiles, a few words each once past the tile level.
+        lifeFrame.density.dirtyRanges(lifeFrame.tileSerial, _gridSerial[frameIndex], _uploadTracker);
+        ManagedBufferTarget density(_pDensityBuffer[frameIndex]);
+        _uploadTracker.flush(lifeFrame.density.data(), density);
+        _gridSerial[frameIndex] = lifeFrame.serial;
+    }
 
-    computeEncoder->dispatchThreadgroups(threadgroups, threadgroupSize);
-    computeEncoder->endEncoding();
+    if (memcmp(_pJDLVStateBuffer[frameIndex]->contents(), &lifeFrame.state, sizeof(JDLVState)) != 0)
+    {
+        ManagedBufferTarget state(_pJDLVStateBuffer[frameIndex]);
+        _uploadTracker.add(0, sizeof(JDLVState));
+        _uploadTracker.flush(&lifeFrame.state, state);
+    }
+    RMDL_TELEMETRY(_telemetry.endStage(FrameStage::GridUpload));
 
-    _pCommandBuffer[1]->endCommandBuffer();
-    _pCommandBuffer[2] = _pDevice->newCommandBuffer();
-    _pCommandBuffer[2]->beginCommandBuffer(_pCommandAllocator[frameIndex]);
+    RMDL_TELEMETRY(_telemetry.beginStage(FrameStage::GridRender));
+    _pCommandBuffer[1] = _pDevice->newCommandBuffer();
+    RMDL_TELEMETRY(_telemetry.countAllocation(0));
+    _pCommandBuffer[1]->beginCommandBuffer(_pCommandAllocator[frameIndex]);
 
     color0->setLoadAction(MTL::LoadActionLoad);
     pRenderPassDescriptor->depthAttachment()->setLoadAction(MTL::LoadActionLoad);
 
-    MTL4::RenderCommandEncoder* gridRenderPassEncoder = _pCommandBuffer[2]->renderCommandEncoder(pRenderPassDescriptor);
+    MTL4::RenderCommandEncoder* gridRenderPassEncoder = _pCommandBuffer[1]->renderCommandEncoder(pRenderPassDescriptor);
 
     gridRenderPassEncoder->setRenderPipelineState(_pJDLVRenderPSO);
     gridRenderPassEncoder->setDepthStencilState( _pDepthStencilStateJDLV );
     gridRenderPassEncoder->setViewport(viewPort);
 
-    _pArgumentTableJDLV->setAddress(destGrid->gpuAddress(), 0);
+    _pArgumentTableJDLV->setAddress(_pGridBuffer[frameIndex]->gpuAddress(), 0);
     _pArgumentTableJDLV->setAddress(_pJDLVStateBuffer[frameIndex]->gpuAddress(), 1);
+    _pArgumentTableJDLV->setAddress(_pDensityBuffer[frameIndex]->gpuAddress(), 2);
+    _pArgumentTableJDLV->setAddress(_pDensityBuffer[frameIndex]->gpuAddress() + sizeof(JDLVDensity), 3);
     gridRenderPassEncoder->setArgumentTable( _pArgumentTableJDLV, MTL::RenderStageVertex );
     gridRenderPassEncoder->setArgumentTable( _pArgumentTableJDLV, MTL::RenderStageFragment );
 
     gridRenderPassEncoder->drawPrimitives( MTL::PrimitiveTypeTriangle, NS::UInteger(0), NS::UInteger(6) );
     gridRenderPassEncoder->endEncoding();
 
-    _pCommandBuffer[2]->endCommandBuffer();
-
-    _useBufferAAsSource = !_useBufferAAsSource;
+    _pCommandBuffer[1]->endCommandBuffer();
+    RMDL_TELEMETRY(_telemetry.endStage(FrameStage::GridRender));
 
-    _pCommandBuffer[3] = _pDevice->newCommandBuffer();
-    _pCommandBuffer[3]->beginCommandBuffer(_pCommandAllocator[frameIndex]);
+    RMDL_TELEMETRY(_telemetry.beginStage(FrameStage::Text));
+    _pCommandBuffer[2] = _pDevice->newCommandBuffer();
+    RMDL_TELEMETRY(_telemetry.countAllocation(0));
+    _pCommandBuffer[2]->beginCommandBuffer(_pCommandAllocator[frameIndex]);
 
     color0->setLoadAction(MTL::LoadActionLoad);
     pRenderPassDescriptor->depthAttachment()->setLoadAction(MTL::LoadActionLoad);
 
-    MTL4::RenderCommandEncoder* textRenderPassEncoder = _pCommandBuffer[3]->renderCommandEncoder(pRenderPassDescriptor);
+    MTL4::RenderCommandEncoder* textRenderPassEncoder = _pCommandBuffer[2]->renderCommandEncoder(pRenderPassDescriptor);
     textRenderPassEncoder->setRenderPipelineState(_pTextPSO);
     textRenderPassEncoder->setViewport(viewPort);
 
@@ -770,6 +894,7 @@ void GameCoordinator::draw( MTK::View* _pView )
             textVerts.size() * sizeof(TextVertex),
             MTL::ResourceStorageModeShared
         );
+    RMDL_TELEMETRY(_telemetry.countAllocation(textVerts.size() * sizeof(TextVertex)));
     _pArgumentTableText->setAddress(textVertexBuffer->gpuAddress(), 0);
     _pArgumentTableText->setTexture(font.texture->gpuResourceID(), 0);
 //    _pArgumentTableText->setTexture(_pFontTexture->gpuResourceID(), 0);
@@ -779,7 +904,8 @@ void GameCoordinator::draw( MTK::View* _pView )
 
     textRenderPassEncoder->drawPrimitives( MTL::PrimitiveTypeTriangle, NS::UInteger(0), NS::UInteger(textVerts.size()) );
     textRenderPassEncoder->endEncoding();
-    _pCommandBuffer[3]->endCommandBuffer();
+    _pCommandBuffer[2]->endCommandBuffer();
+    RMDL_TELEMETRY(_telemetry.endStage(FrameStage::Text));
 
     currentDrawable = _pView->currentDrawable();
     _pCommandQueue->wait(currentDrawable);
@@ -787,5 +913,6 @@ void GameCoordinator::draw( MTK::View* _pView )
     _pCommandQueue->signalDrawable(currentDrawable);
     _pCommandQueue->signalEvent(_sharedEvent, _currentFrameIndex);
     currentDrawable->present();
+    RMDL_TELEMETRY(_telemetry.endFrame());
     pPool->release();
 }
@@ -22,6 +22,10 @@
 #include "RMDLMeshUtils.hpp"
 #include "BumpAllocator.hpp"
 #include "RMDLMathUtils.hpp"
+#include "RMDLLifeRule.hpp"
+#include "RMDLFrameTelemetry.hpp"
+#include "RMDLDirtyRangeTracker.hpp"
+#include "RMDLLifeSimulation.hpp"
 
 #define kMaxBuffersInFlight 3
 static const uint32_t NumLights = 256;
@@ -96,10 +100,37 @@ public:
 
     void updateViewportSize(NS::UInteger, NS::UInteger);
 
+    /// Rebuilds the JDLV pipelines for another B/S or Generations rule.
+    bool setRule(const LifeRule& rule);
+    const LifeRule& rule() const { return _rule; }
+    /// Replaces the board with an RLE or Macrocell file, centred, under its rule.
+    /// False, board untouched, when the file carries a rule setRule() refuses.
+    bool loadPattern(const std::string& path);
+    /// Runs a Golly .rule or .table file on the simulation thread; the grid shades its
+    /// states past 1 like Generations ones, and rule() only carries its state count.
+    bool loadRuleTable(const std::string& path);
+    /// Board, rule and topology from a LifeCheckpoint file of the grid's size.
+    bool restoreCheckpoint(const std::string& path);
+    /// Applied by the simulation thread before its next generation.
+    void setTopology(JDLVTopology topology, uint32_t paddingState = 0);
+    /// The board steps on its own thread; 0 generations per second is as fast as it goes.
+    void setGenerationsPerSecond(double generationsPerSecond) { _simulation.setGenerationsPerSecond(generationsPerSecond); }
+    void setPaused(bool paused) { _simulation.setPaused(paused); }
+    /// Brush strokes, stamps and clears in grid cells; lands between generations without stalling the stepper.
+    void editBoard(LifeEdit edit) { _simulation.edit(std::move(edit)); }
+    /// Logs board changes, keys and camera moves to `path`; LifeReplay plays the board part back.
+    bool startEventLog(const std::string& path);
+    void stopEventLog();
+    void recordKey(uint32_t key);
+
+    /// Per-frame encode/wait timings; empty unless RMDL_FRAME_TELEMETRY is on.
+    const FrameTelemetry& frameTelemetry() const { return _telemetry; }
+    bool dumpFrameTrace(const std::string& path) const { return _telemetry.writeChromeTrace(path); }
+
 private:
     MTL::PixelFormat                    _pPixelFormat;
     MTL4::CommandQueue*                 _pCommandQueue;
-    MTL4::CommandBuffer*                _pCommandBuffer[4];
+    MTL4::CommandBuffer*                _pCommandBuffer[3];    // scene, grid, text
     MTL4::CommandAllocator*             _pCommandAllocator[kMaxBuffersInFlight];
     MTL4::ArgumentTable*                _pArgumentTable;
     MTL::ResidencySet*                  _pResidencySet;
@@ -134,20 +165,29 @@ private:
 //    UIRenderData _renderData;
 
     MTL::Buffer* _pJDLVStateBuffer[kMaxBuffersInFlight];
-    MTL::Buffer* _pGridBuffer_A[kMaxBuffersInFlight];
-    MTL::Buffer*            _pGridBuffer_B[kMaxBuffersInFlight];
+    MTL::Buffer* _pGridBuffer[kMaxBuffersInFlight];
+    MTL::Buffer* _pDensityBuffer[kMaxBuffersInFlight];             // LifeFrame::density, same serial as the grid
+    uint64_t                _gridSerial[kMaxBuffersInFlight];   // LifeFrame::serial each slot holds
+    std::vector<LifeGridRange> _gridRanges;
+    DirtyRangeTracker       _uploadTracker;
+    std::shared_ptr<LifeEventLog> _eventLog;
     MTL::Buffer*            _pTextBuffer[kMaxBuffersInFlight];
-    MTL::ComputePipelineState*  _pJDLVComputePSO;
     MTL::RenderPipelineState*   _pJDLVRenderPSO;
     MTL::RenderPipelineState*   _pTextPSO;
     MTL4::ArgumentTable*                _pArgumentTableJDLV;
     MTL4::ArgumentTable*                _pArgumentTableText;
-    bool _useBufferAAsSource;
     MTL4::RenderPassDescriptor*         _gBufferPassDesc;
     MTL4::RenderPassDescriptor*         _shadowPassDesc;
     MTL::Texture* _pFontTexture;
     void initGrid();
     void buildJDLVPipelines();
+    void buildJDLVRulePipelines();
+    LifeRule _rule;
+    bool _ruleTable;                // a RuleTable runs; _rule only holds its state count
+    JDLVTopology _topology;
+    uint32_t _paddingState;
+    FrameTelemetry _telemetry;
+    LifeSimulation _simulation;
 
 //    simd::float4x4                      _presentOrtho;
 //    NS::SharedPtr<MTL::Texture>         _pBackbuffer;
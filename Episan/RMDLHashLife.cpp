@@ -0,0 +1,461 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: RMDLHashLife.cpp            +++     +++       **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 17/10/2026 13:05:52      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include <algorithm>
+#include <cassert>
+
+#include "RMDLHashLife.hpp"
+
+HashLife::HashLife()
+    : _root(kNil)
+    , _generation(0)
+    , _maxNodes(size_t(1) << 23)
+    , _rule(LifeRule::conway())
+{
+    buildBaseTable();
+    clear();
+}
+
+HashLife::~HashLife()
+{
+}
+
+void HashLife::buildBaseTable()
+{
+    // 4x4 block, bit (y * 4 + x) -> inner 2x2 after one generation, bit (y - 1) * 2 + (x - 1).
+    _baseTable.assign(1 << 16, 0);
+    for (uint32_t bits = 0; bits < (1u << 16); ++bits)
+    {
+        uint8_t out = 0;
+        for (int y = 1; y <= 2; ++y)
+        {
+            for (int x = 1; x <= 2; ++x)
+            {
+                int n = 0;
+                for (int dy = -1; dy <= 1; ++dy)
+                    for (int dx = -1; dx <= 1; ++dx)
+                        if (dx || dy)
+                            n += (bits >> ((y + dy) * 4 + (x + dx))) & 1;
+                const bool alive = (bits >> (y * 4 + x)) & 1;
+                if ((alive ? _rule.survive : _rule.birth) & (1 << n))
+                    out |= 1 << ((y - 1) * 2 + (x - 1));
+            }
+        }
+        _baseTable[bits] = out;
+    }
+}
+
+bool HashLife::setRule(const LifeRule& rule)
+{
+    if (!rule.isTwoState() || rule.bornFromNothing())
+        return (false);
+    _rule = rule;
+    buildBaseTable();
+    for (Node& n : _nodes)
+        n.result = kNil;
+    return (true);
+}
+
+void HashLife::clear()
+{
+    _nodes.clear();
+    _freeList.clear();
+    _empty.clear();
+    // Ids 0 and 1 are the dead and live cells; they are never hashed.
+    _nodes.push_back({ kNil, kNil, kNil, kNil, kNil, kNil, 0, 0, 0, 0 });
+    _nodes.push_back({ kNil, kNil, kNil, kNil, kNil, kNil, 1, 0, 0, 0 });
+    _buckets.assign(1 << 16, kNil);
+    _root = empty(3);
+    _generation = 0;
+}
+
+size_t HashLife::bucketOf(uint32_t nw, uint32_t ne, uint32_t sw, uint32_t se) const
+{
+    uint64_t h = nw;
+    h = h * 0x9E3779B97F4A7C15ull + ne;
+    h = h * 0x9E3779B97F4A7C15ull + sw;
+    h = h * 0x9E3779B97F4A7C15ull + se;
+    h ^= h >> 29;
+    return ((size_t)h & (_buckets.size() - 1));
+}
+
+void HashLife::rehash(size_t buckets)
+{
+    _buckets.assign(buckets, kNil);
+    for (uint32_t id = 2; id < (uint32_t)_nodes.size(); ++id)
+    {
+        Node& n = _nodes[id];
+        if (n.level == 0xFF)
+            continue;
+        const size_t b = bucketOf(n.nw, n.ne, n.sw, n.se);
+        n.next = _buckets[b];
+        _buckets[b] = id;
+    }
+}
+
+uint32_t HashLife::join(uint32_t nw, uint32_t ne, uint32_t sw, uint32_t se)
+{
+    size_t b = bucketOf(nw, ne, sw, se);
+    for (uint32_t id = _buckets[b]; id != kNil; id = _nodes[id].next)
+    {
+        const Node& n = _nodes[id];
+        if (n.nw == nw && n.ne == ne && n.sw == sw && n.se == se)
+            return (id);
+    }
+
+    Node n;
+    n.nw = nw;
+    n.ne = ne;
+    n.sw = sw;
+    n.se = se;
+    n.result = kNil;
+    n.population = _nodes[nw].population + _nodes[ne].population + _nodes[sw].population + _nodes[se].population;
+    n.level = _nodes[nw].level + 1;
+    n.resultLog = 0;
+    n.mark = 0;
+
+    uint32_t id;
+    if (!_freeList.empty())
+    {
+        id = _freeList.back();
+        _freeList.pop_back();
+        _nodes[id] = n;
+    }
+    else
+    {
+        id = (uint32_t)_nodes.size();
+        _nodes.push_back(n);
+    }
+
+    if (nodeCount() > _buckets.size() - (_buckets.size() >> 2))
+    {
+        rehash(_buckets.size() * 2);
+        return (id);
+    }
+    _nodes[id].next = _buckets[b];
+    _buckets[b] = id;
+    return (id);
+}
+
+uint32_t HashLife::empty(uint32_t level)
+{
+    if (_empty.empty())
+        _empty.push_back(0);
+    while (_empty.size() <= level)
+    {
+        const uint32_t e = _empty.back();
+        _empty.push_back(join(e, e, e, e));
+    }
+    return (_empty[level]);
+}
+
+uint32_t HashLife::centre(uint32_t id)
+{
+    const Node n = _nodes[id];
+    return (join(_nodes[n.nw].se, _nodes[n.ne].sw, _nodes[n.sw].ne, _nodes[n.se].nw));
+}
+
+uint32_t HashLife::expand(uint32_t id)
+{
+    const Node n = _nodes[id];
+    const uint32_t e = empty(n.level - 1);
+    return (join(join(e, e, e, n.nw),
+                 join(e, e, n.ne, e),
+                 join(e, n.sw, e, e),
+                 join(n.se, e, e, e)));
+}
+
+bool HashLife::isPadded(uint32_t id) const
+{
+    // Everything lives in the centre half: only the inner grandchildren are populated.
+    const Node& n = _nodes[id];
+    return (_nodes[n.nw].population == _nodes[_nodes[n.nw].se].population &&
+            _nodes[n.ne].population == _nodes[_nodes[n.ne].sw].population &&
+            _nodes[n.sw].population == _nodes[_nodes[n.sw].ne].population &&
+            _nodes[n.se].population == _nodes[_nodes[n.se].nw].population);
+}
+
+uint32_t HashLife::successorBase(uint32_t id)
+{
+    const Node& n = _nodes[id];
+    const uint32_t quads[4] = { n.nw, n.ne, n.sw, n.se };
+    uint32_t bits = 0;
+    for (int q = 0; q < 4; ++q)
+    {
+        const Node& c = _nodes[quads[q]];
+        const int ox = (q & 1) * 2;
+        const int oy = (q >> 1) * 2;
+        bits |= c.nw << ((oy + 0) * 4 + ox + 0);
+        bits |= c.ne << ((oy + 0) * 4 + ox + 1);
+        bits |= c.sw << ((oy + 1) * 4 + ox + 0);
+        bits |= c.se << ((oy + 1) * 4 + ox + 1);
+    }
+    const uint8_t r = _baseTable[bits];
+    return (join(r & 1, (r >> 1) & 1, (r >> 2) & 1, (r >> 3) & 1));
+}
+
+uint32_t HashLife::successor(uint32_t id, uint32_t stepLog)
+{
+    const Node n = _nodes[id];
+    const uint32_t level = n.level;
+    const uint32_t log = std::min<uint32_t>(stepLog, level - 2);
+
+    if (n.population == 0)
+        return (empty(level - 1));
+    if (n.result != kNil && n.resultLog == log)
+        return (n.result);
+
+    uint32_t result;
+    if (level == 2)
+    {
+        result = successorBase(id);
+    }
+    else
+    {
+        const Node nw = _nodes[n.nw], ne = _nodes[n.ne], sw = _nodes[n.sw], se = _nodes[n.se];
+
+        // Nine overlapping level-1 subsquares.
+        uint32_t sub[9] =
+        {
+            n.nw,                             join(nw.ne, ne.nw, nw.se, ne.sw), n.ne,
+            join(nw.sw, nw.se, sw.nw, sw.ne), join(nw.se, ne.sw, sw.ne, se.nw), join(ne.sw, ne.se, se.nw, se.ne),
+            n.sw,                             join(sw.ne, se.nw, sw.se, se.sw), n.se
+        };
+
+        // Full speed advances twice by 2^(level-3); slower steps only advance in the second half.
+        for (int i = 0; i < 9; ++i)
+            sub[i] = (log == level - 2) ? successor(sub[i], stepLog) : centre(sub[i]);
+
+        const uint32_t q0 = successor(join(sub[0], sub[1], sub[3], sub[4]), stepLog);
+        const uint32_t q1 = successor(join(sub[1], sub[2], sub[4], sub[5]), stepLog);
+        const uint32_t q2 = successor(join(sub[3], sub[4], sub[6], sub[7]), stepLog);
+        const uint32_t q3 = successor(join(sub[4], sub[5], sub[7], sub[8]), stepLog);
+        result = join(q0, q1, q2, q3);
+    }
+
+    _nodes[id].result = result;
+    _nodes[id].resultLog = (uint8_t)log;
+    return (result);
+}
+
+void HashLife::advancePow2(uint32_t k)
+{
+    assert(k + 3 <= kMaxLevel);
+    if (nodeCount() > _maxNodes)
+        collectGarbage();
+
+    // Pattern in the centre quarter and level >= k + 3: nothing can reach the
+    // edge of the RESULT square within 2^k generations at light speed.
+    while (_nodes[_root].level < 3 || !isPadded(_root))
+        _root = expand(_root);
+    _root = expand(_root);
+    while (_nodes[_root].level < k + 3)
+        _root = expand(_root);
+
+    _root = successor(_root, k);
+    _generation += uint64_t(1) << k;
+}
+
+void HashLife::advance(uint64_t generations)
+{
+    for (uint32_t k = 63; generations; --k)
+    {
+        if (generations & (uint64_t(1) << k))
+        {
+            advancePow2(k);
+            generations &= ~(uint64_t(1) << k);
+        }
+    }
+}
+
+uint64_t HashLife::population() const
+{
+    return (_nodes[_root].population);
+}
+
+uint32_t HashLife::rootLevel() const
+{
+    return (_nodes[_root].level);
+}
+
+void HashLife::setRoot(uint32_t id, uint64_t generation)
+{
+    assert(_nodes[id].level >= 1 && _nodes[id].level != 0xFF);
+    _root = id;
+    while (_nodes[_root].level < 3)
+        _root = expand(_root);
+    _generation = generation;
+}
+
+void HashLife::nodeChildren(uint32_t id, uint32_t children[4]) const
+{
+    const Node& n = _nodes[id];
+    children[0] = n.nw;
+    children[1] = n.ne;
+    children[2] = n.sw;
+    children[3] = n.se;
+}
+
+uint32_t HashLife::setCell(uint32_t id, int64_t x, int64_t y, bool alive)
+{
+    const Node n = _nodes[id];
+    if (n.level == 0)
+        return (alive ? 1 : 0);
+    const int64_t half = int64_t(1) << (n.level - 1);
+    if (y < half)
+    {
+        if (x < half)
+            return (join(setCell(n.nw, x, y, alive), n.ne, n.sw, n.se));
+        return (join(n.nw, setCell(n.ne, x - half, y, alive), n.sw, n.se));
+    }
+    if (x < half)
+        return (join(n.nw, n.ne, setCell(n.sw, x, y - half, alive), n.se));
+    return (join(n.nw, n.ne, n.sw, setCell(n.se, x - half, y - half, alive)));
+}
+
+void HashLife::setCell(int64_t x, int64_t y, bool alive)
+{
+    for (;;)
+    {
+        const int64_t half = int64_t(1) << (_nodes[_root].level - 1);
+        if (x >= -half && x < half && y >= -half && y < half)
+        {
+            _root = setCell(_root, x + half, y + half, alive);
+            return;
+        }
+        _root = expand(_root);
+    }
+}
+
+bool HashLife::cell(int64_t x, int64_t y) const
+{
+    uint32_t id = _root;
+    int64_t half = int64_t(1) << (_nodes[id].level - 1);
+    if (x < -half || x >= half || y < -half || y >= half)
+        return (false);
+    x += half;
+    y += half;
+    while (_nodes[id].level > 0)
+    {
+        const Node& n = _nodes[id];
+        if (n.population == 0)
+            return (false);
+        half = int64_t(1) << (n.level - 1);
+        const bool east = x >= half;
+        const bool south = y >= half;
+        id = south ? (east ? n.se : n.sw) : (east ? n.ne : n.nw);
+        x -= east ? half : 0;
+        y -= south ? half : 0;
+    }
+    return (id == 1);
+}
+
+uint32_t HashLife::build(const JDLVState& state, const uint32_t* grid, uint32_t level, int64_t x, int64_t y)
+{
+    const int64_t size = int64_t(1) << level;
+    if (x >= (int64_t)state.width || y >= (int64_t)state.height || x + size <= 0 || y + size <= 0)
+        return (empty(level));
+    if (level == 0)
+        return (grid[(size_t)y * state.width + (size_t)x] > 0 ? 1 : 0);
+    const int64_t half = size >> 1;
+    const uint32_t nw = build(state, grid, level - 1, x, y);
+    const uint32_t ne = build(state, grid, level - 1, x + half, y);
+    const uint32_t sw = build(state, grid, level - 1, x, y + half);
+    const uint32_t se = build(state, grid, level - 1, x + half, y + half);
+    return (join(nw, ne, sw, se));
+}
+
+void HashLife::importGrid(const JDLVState& state, const uint32_t* grid, int64_t originX, int64_t originY)
+{
+    clear();
+    uint32_t level = 3;
+    for (;; ++level)
+    {
+        const int64_t half = int64_t(1) << (level - 1);
+        if (originX >= -half && originY >= -half &&
+            originX + (int64_t)state.width <= half && originY + (int64_t)state.height <= half)
+            break;
+    }
+    const int64_t half = int64_t(1) << (level - 1);
+    _root = build(state, grid, level, -half - originX, -half - originY);
+}
+
+void HashLife::fill(uint32_t id, int64_t x, int64_t y, int64_t x0, int64_t y0, const JDLVState& window, uint32_t* grid) const
+{
+    const Node& n = _nodes[id];
+    const int64_t size = int64_t(1) << n.level;
+    if (n.population == 0 ||
+        x >= x0 + (int64_t)window.width || y >= y0 + (int64_t)window.height ||
+        x + size <= x0 || y + size <= y0)
+        return;
+    if (n.level == 0)
+    {
+        grid[(size_t)(y - y0) * window.width + (size_t)(x - x0)] = 1;
+        return;
+    }
+    const int64_t half = size >> 1;
+    fill(n.nw, x, y, x0, y0, window, grid);
+    fill(n.ne, x + half, y, x0, y0, window, grid);
+    fill(n.sw, x, y + half, x0, y0, window, grid);
+    fill(n.se, x + half, y + half, x0, y0, window, grid);
+}
+
+void HashLife::exportWindow(int64_t x0, int64_t y0, const JDLVState& window, uint32_t* grid) const
+{
+    std::fill(grid, grid + (size_t)window.width * window.height, 0u);
+    const int64_t half = int64_t(1) << (_nodes[_root].level - 1);
+    fill(_root, -half, -half, x0, y0, window, grid);
+}
+
+void HashLife::mark(uint32_t id)
+{
+    Node& n = _nodes[id];
+    if (n.mark)
+        return;
+    n.mark = 1;
+    if (n.level == 0)
+        return;
+    mark(n.nw);
+    mark(n.ne);
+    mark(n.sw);
+    mark(n.se);
+}
+
+void HashLife::collectGarbage()
+{
+    for (Node& n : _nodes)
+        n.mark = 0;
+    mark(0);
+    mark(1);
+    for (uint32_t e : _empty)
+        mark(e);
+    mark(_root);
+
+    _freeList.clear();
+    for (uint32_t id = 2; id < (uint32_t)_nodes.size(); ++id)
+    {
+        Node& n = _nodes[id];
+        if (!n.mark)
+        {
+            n.level = 0xFF;
+            n.result = kNil;
+            _freeList.push_back(id);
+        }
+    }
+    // Memoised results survive only if the node they point at does.
+    for (Node& n : _nodes)
+        if (n.level != 0xFF && n.result != kNil && !_nodes[n.result].mark)
+            n.result = kNil;
+
+    size_t buckets = 1 << 16;
+    while (buckets - (buckets >> 2) < nodeCount())
+        buckets <<= 1;
+    rehash(buckets);
+}
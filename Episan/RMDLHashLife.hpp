@@ -0,0 +1,111 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: RMDLHashLife.hpp            +++     +++       **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 17/10/2026 13:05:47      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef RMDLHASHLIFE_HPP
+# define RMDLHASHLIFE_HPP
+
+# include <cstddef>
+# include <cstdint>
+# include <vector>
+
+# include "JDLV_shared.h"
+# include "RMDLLifeRule.hpp"
+
+/// Gosper's HashLife: a hash-consed quadtree where every node memoises its
+/// RESULT (the centre, advanced in time). The universe is unbounded and
+/// centred on (0, 0); a root of level L covers [-2^(L-1), 2^(L-1)) on both axes.
+class HashLife
+{
+public:
+    HashLife();
+    ~HashLife();
+
+    void        clear();
+    void        setCell(int64_t x, int64_t y, bool alive);
+    bool        cell(int64_t x, int64_t y) const;
+
+    /// Replaces the universe with a JDLV grid whose (0, 0) cell lands on (originX, originY).
+    void        importGrid(const JDLVState& state, const uint32_t* grid, int64_t originX = 0, int64_t originY = 0);
+    /// Writes the window starting at (x0, y0) into the flat uint32_t layout read by JDLVFragment.
+    void        exportWindow(int64_t x0, int64_t y0, const JDLVState& window, uint32_t* grid) const;
+
+    /// Advances 2^k generations in one call.
+    void        advancePow2(uint32_t k);
+    /// Advances any count by splitting it into powers of two.
+    void        advance(uint64_t generations);
+
+    const LifeRule& rule() const    { return _rule; }
+    /// Two-state rules without B0. Drops every memoised RESULT.
+    bool        setRule(const LifeRule& rule);
+
+    uint64_t    generation() const  { return _generation; }
+    uint64_t    population() const;
+    uint32_t    rootLevel() const;
+    size_t      nodeCount() const   { return _nodes.size() - _freeList.size(); }
+
+    /// Node-level access for the Macrocell loader and saver. Ids 0 and 1 are
+    /// the dead and live cells, children come in nw, ne, sw, se order.
+    uint32_t    root() const                        { return _root; }
+    /// Root of level >= 1, centred on (0, 0) like the current one.
+    void        setRoot(uint32_t id, uint64_t generation);
+    uint32_t    makeNode(uint32_t nw, uint32_t ne, uint32_t sw, uint32_t se) { return (join(nw, ne, sw, se)); }
+    uint32_t    emptyNode(uint32_t level)           { return (empty(level)); }
+    uint32_t    nodeLevel(uint32_t id) const        { return _nodes[id].level; }
+    uint64_t    nodePopulation(uint32_t id) const   { return _nodes[id].population; }
+    void        nodeChildren(uint32_t id, uint32_t children[4]) const;
+    /// Every node id is below this; sized for per-node side tables.
+    size_t      nodeIdLimit() const                 { return _nodes.size(); }
+
+    /// Collection happens between powers of two once the live node count passes this.
+    void        setMaxNodes(size_t maxNodes) { _maxNodes = maxNodes; }
+    void        collectGarbage();
+
+private:
+    static constexpr uint32_t kNil = UINT32_MAX;
+    static constexpr uint32_t kMaxLevel = 62;
+
+    struct Node
+    {
+        uint32_t    nw, ne, sw, se;
+        uint32_t    result;
+        uint32_t    next;           // hash chain
+        uint64_t    population;
+        uint8_t     level;
+        uint8_t     resultLog;      // log2 of the step `result` was computed for
+        uint8_t     mark;
+    };
+
+    void        buildBaseTable();
+    uint32_t    join(uint32_t nw, uint32_t ne, uint32_t sw, uint32_t se);
+    uint32_t    empty(uint32_t level);
+    uint32_t    centre(uint32_t id);
+    uint32_t    expand(uint32_t id);
+    bool        isPadded(uint32_t id) const;
+    uint32_t    successor(uint32_t id, uint32_t stepLog);
+    uint32_t    successorBase(uint32_t id);
+    uint32_t    setCell(uint32_t id, int64_t x, int64_t y, bool alive);
+    uint32_t    build(const JDLVState& state, const uint32_t* grid, uint32_t level, int64_t x, int64_t y);
+    void        fill(uint32_t id, int64_t x, int64_t y, int64_t x0, int64_t y0, const JDLVState& window, uint32_t* grid) const;
+    void        mark(uint32_t id);
+    void        rehash(size_t buckets);
+    size_t      bucketOf(uint32_t nw, uint32_t ne, uint32_t sw, uint32_t se) const;
+
+    std::vector<Node>       _nodes;
+    std::vector<uint32_t>   _buckets;
+    std::vector<uint32_t>   _freeList;
+    std::vector<uint32_t>   _empty;
+    std::vector<uint8_t>    _baseTable;     // 4x4 -> 2x2 after one generation
+    uint32_t                _root;
+    uint64_t                _generation;
+    size_t                  _maxNodes;
+    LifeRule                _rule;
+};
+
+#endif /* RMDLHASHLIFE_HPP */
@@ -0,0 +1,90 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: RMDLJDLVReference.cpp         +++     +++     **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 18/10/2026 10:31:11      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include <algorithm>
+
+#include "RMDLJDLVReference.hpp"
+
+JDLVReference::JDLVReference(const JDLVState& state)
+    : _state(state)
+    , _rule(LifeRule::conway())
+    , _current(0)
+    , _generation(0)
+{
+    _grid[0].assign((size_t)state.width * state.height, 0);
+    _grid[1].assign((size_t)state.width * state.height, 0);
+}
+
+void JDLVReference::importGrid(const uint32_t* grid)
+{
+    std::copy(grid, grid + _grid[0].size(), _grid[_current].begin());
+}
+
+// The cell at (x, y), at most one cell outside the grid, under the board's topology.
+uint32_t JDLVReference::sample(const uint32_t* grid, int32_t x, int32_t y) const
+{
+    const int32_t width = (int32_t)_state.width;
+    const int32_t height = (int32_t)_state.height;
+    const bool outside = x < 0 || y < 0 || x >= width || y >= height;
+
+    switch (_state.topology)
+    {
+        case JDLVTopologyTorus:
+            break;
+        case JDLVTopologyKleinBottle:
+            if (y < 0 || y >= height)
+                x = width - 1 - x;
+            break;
+        case JDLVTopologyPadded:
+            if (outside)
+                return (_state.paddingState);
+            break;
+        default:
+            if (outside)
+                return (0);
+            break;
+    }
+    x = (x + width) % width;
+    y = (y + height) % height;
+    return (grid[(size_t)y * _state.width + (uint32_t)x]);
+}
+
+void JDLVReference::step()
+{
+    const uint32_t* src = _grid[_current].data();
+    uint32_t* dst = _grid[_current ^ 1].data();
+    const uint32_t states = std::max<uint32_t>(_rule.states, 2);
+
+    for (uint32_t y = 0; y < _state.height; ++y)
+    {
+        for (uint32_t x = 0; x < _state.width; ++x)
+        {
+            uint32_t liveNeighbors = 0;
+            for (int32_t dy = -1; dy <= 1; ++dy)
+                for (int32_t dx = -1; dx <= 1; ++dx)
+                    if (dx != 0 || dy != 0)
+                        liveNeighbors += sample(src, (int32_t)x + dx, (int32_t)y + dy) == 1;
+
+            const uint32_t currentState = src[(size_t)y * _state.width + x];
+            const uint32_t mask = currentState == 1 ? _rule.survive : _rule.birth;
+            const bool alive = ((mask >> liveNeighbors) & 1) != 0 && currentState <= 1;
+            const uint32_t aged = currentState == 0 ? 0 : (currentState + 1) % states;
+            dst[(size_t)y * _state.width + x] = alive ? 1 : aged;
+        }
+    }
+    _current ^= 1;
+    ++_generation;
+}
+
+void JDLVReference::step(uint64_t generations)
+{
+    while (generations--)
+        step();
+}
@@ -0,0 +1,52 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: RMDLJDLVReference.hpp         +++     +++     **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 18/10/2026 10:31:05      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef RMDLJDLVREFERENCE_HPP
+# define RMDLJDLVREFERENCE_HPP
+
+# include <cstdint>
+# include <vector>
+
+# include "JDLV_shared.h"
+# include "NonCopyable.h"
+# include "RMDLLifeRule.hpp"
+
+/// Line-for-line scalar port of the JDLVCompute kernel the GPU once stepped
+/// the board with: one uint32_t per cell, eight sample() calls per cell. Slow on purpose; it is the ground truth the
+/// packed, SIMD and threaded steppers are checked against.
+class JDLVReference : public NonCopyable
+{
+public:
+    explicit JDLVReference(const JDLVState& state);
+
+    const JDLVState&    state() const       { return _state; }
+    const LifeRule&     rule() const        { return _rule; }
+    void                setRule(const LifeRule& rule) { _rule = rule; }
+    uint64_t            generation() const  { return _generation; }
+    void                setGeneration(uint64_t generation) { _generation = generation; }
+    void                setTopology(JDLVTopology topology, uint32_t paddingState = 0) { _state.topology = topology; _state.paddingState = paddingState; }
+
+    void                importGrid(const uint32_t* grid);
+    const uint32_t*     grid() const        { return _grid[_current].data(); }
+
+    void                step();
+    void                step(uint64_t generations);
+
+private:
+    uint32_t            sample(const uint32_t* grid, int32_t x, int32_t y) const;
+
+    JDLVState               _state;
+    LifeRule                _rule;
+    std::vector<uint32_t>   _grid[2];
+    uint8_t                 _current;
+    uint64_t                _generation;
+};
+
+#endif /* RMDLJDLVREFERENCE_HPP */
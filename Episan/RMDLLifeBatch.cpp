@@ -0,0 +1,373 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: RMDLLifeBatch.cpp             +++     +++     **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 19/10/2026 21:36:14      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include <algorithm>
+#include <cstdio>
+
+#include "RMDLLifeBatch.hpp"
+#include "RMDLLifeTopology.hpp"
+#include "RMDLWorkStealingPool.hpp"
+
+#if defined(__AVX2__)
+# define RMDL_BATCH_HAS_AVX2 1
+# include <immintrin.h>
+#endif
+
+#if defined(__ARM_NEON)
+# define RMDL_BATCH_HAS_NEON 1
+# include <arm_neon.h>
+#endif
+
+namespace
+{
+
+constexpr uint32_t kLanes = LifeBatch::kLanes;
+
+// What the left and right edges see: the row itself wrapped round, or a constant padding bit.
+struct Edges
+{
+    uint64_t    wrap;       // 1 when x wraps
+    uint64_t    padWest;    // bit 0: the cell left of x = 0
+    uint64_t    padEast;    // bit width - 1: the cell right of the last one
+    uint64_t    widthMask;
+    int         last;       // width - 1
+};
+
+struct ScalarLanes
+{
+    typedef uint64_t V;
+    static constexpr uint32_t kWidth = 1;
+
+    static inline V     load(const uint64_t* p)     { return (*p); }
+    static inline void  store(uint64_t* p, V v)     { *p = v; }
+    static inline V     set(uint64_t v)             { return (v); }
+    static inline V     shl(V v, int n)             { return (v << n); }
+    static inline V     shr(V v, int n)             { return (v >> n); }
+};
+
+#if RMDL_BATCH_HAS_AVX2
+
+struct AVX2Lanes
+{
+    typedef __m256i V;
+    static constexpr uint32_t kWidth = 4;
+
+    static inline V     load(const uint64_t* p)     { return (_mm256_loadu_si256((const __m256i*)p)); }
+    static inline void  store(uint64_t* p, V v)     { _mm256_storeu_si256((__m256i*)p, v); }
+    static inline V     set(uint64_t v)             { return (_mm256_set1_epi64x((long long)v)); }
+    static inline V     shl(V v, int n)             { return (_mm256_sll_epi64(v, _mm_cvtsi32_si128(n))); }
+    static inline V     shr(V v, int n)             { return (_mm256_srl_epi64(v, _mm_cvtsi32_si128(n))); }
+};
+
+#else
+
+typedef ScalarLanes AVX2Lanes;
+
+#endif
+
+#if RMDL_BATCH_HAS_NEON
+
+struct NEONLanes
+{
+    typedef uint64x2_t V;
+    static constexpr uint32_t kWidth = 2;
+
+    static inline V     load(const uint64_t* p)     { return (vld1q_u64(p)); }
+    static inline void  store(uint64_t* p, V v)     { vst1q_u64(p, v); }
+    static inline V     set(uint64_t v)             { return (vdupq_n_u64(v)); }
+    static inline V     shl(V v, int n)             { return (vshlq_u64(v, vdupq_n_s64(n))); }
+    static inline V     shr(V v, int n)             { return (vshlq_u64(v, vdupq_n_s64(-n))); }
+};
+
+#else
+
+typedef ScalarLanes NEONLanes;
+
+#endif
+
+// m ? b : a, lane by lane.
+template <typename V>
+inline V select(V a, V b, V m)
+{
+    return (a ^ ((a ^ b) & m));
+}
+
+/// Per-lane rule: the count's bit-planes walk a select tree over the nine
+/// masks of each table, about half the gates of nine countIs tests.
+struct LaneRule
+{
+    template <typename V>
+    static inline V lookup(const V* t, V s0, V s1, V s2, V s3)
+    {
+        const V a = select(t[0], t[1], s0);
+        const V b = select(t[2], t[3], s0);
+        const V c = select(t[4], t[5], s0);
+        const V d = select(t[6], t[7], s0);
+        const V e = select(a, b, s1);
+        const V f = select(c, d, s1);
+        // A count of 8 sets s3 alone, which left the tree on t[0].
+        return (select(select(e, f, s2), t[8], s3));
+    }
+
+    template <typename V>
+    static inline V apply(V nw, V n, V ne, V w, V c, V e, V sw, V s, V se, const life_kernels::RuleMasks<V>* masks)
+    {
+        V s0, s1, s2, s3;
+        life_kernels::countPlanes(nw, n, ne, w, e, sw, s, se, s0, s1, s2, s3);
+        return (select(lookup(masks->birth, s0, s1, s2, s3), lookup(masks->survive, s0, s1, s2, s3), c));
+    }
+};
+
+typedef life_kernels::FixedRule<(1 << 3), (1 << 2) | (1 << 3)> ConwayRule;
+
+// One generation of one group: src and dst point at its top halo row.
+template <class Lanes, class Rule>
+void stepGroup(const uint64_t* src, uint64_t* dst, uint32_t height, const Edges& edges, const uint64_t* masks)
+{
+    typedef typename Lanes::V V;
+    const V wrap = Lanes::set(edges.wrap);
+    const V padWest = Lanes::set(edges.padWest);
+    const V padEast = Lanes::set(edges.padEast);
+    const V widthMask = Lanes::set(edges.widthMask);
+    const int last = edges.last;
+
+    auto west = [&](V v) { return (Lanes::shl(v, 1) | (Lanes::shr(v, last) & wrap) | padWest); };
+    auto east = [&](V v) { return (Lanes::shr(v, 1) | Lanes::shl(v & wrap, last) | padEast); };
+
+    for (uint32_t lane = 0; lane < kLanes; lane += Lanes::kWidth)
+    {
+        auto rule = life_kernels::ruleMasksFor(Lanes::set(0));
+        if (masks)
+        {
+            for (int k = 0; k <= 8; ++k)
+            {
+                rule.birth[k] = Lanes::load(masks + k * kLanes + lane);
+                rule.survive[k] = Lanes::load(masks + (9 + k) * kLanes + lane);
+            }
+        }
+
+        // Sliding window of three rows, each shifted once.
+        const uint64_t* in = src + lane;
+        V n = Lanes::load(in);
+        V c = Lanes::load(in + kLanes);
+        V nw = west(n), ne = east(n), w = west(c), e = east(c);
+        for (uint32_t y = 0; y < height; ++y)
+        {
+            const V s = Lanes::load(in + (size_t)(y + 2) * kLanes);
+            const V sw = west(s), se = east(s);
+            Lanes::store(dst + (size_t)(y + 1) * kLanes + lane,
+                         Rule::apply(nw, n, ne, w, c, e, sw, s, se, &rule) & widthMask);
+            n = c; nw = w; ne = e;
+            c = s; w = sw; e = se;
+        }
+    }
+}
+
+typedef void (*GroupFn)(const uint64_t*, uint64_t*, uint32_t, const Edges&, const uint64_t*);
+
+// Indexed by LifeKernel, then 0 for per-lane rules and 1 for an all-Conway group.
+const GroupFn kGroupFunctions[3][2] =
+{
+    { &stepGroup<ScalarLanes, LaneRule>, &stepGroup<ScalarLanes, ConwayRule> },
+    { &stepGroup<AVX2Lanes, LaneRule>,   &stepGroup<AVX2Lanes, ConwayRule> },
+    { &stepGroup<NEONLanes, LaneRule>,   &stepGroup<NEONLanes, ConwayRule> }
+};
+
+}
+
+LifeBatch::LifeBatch(const JDLVState& state, uint32_t boards)
+    : _state(state)
+    , _boards(boards)
+    , _current(0)
+    , _generation(0)
+    , _kernel(life_kernels::best())
+{
+    if (state.width < 1 || state.width > kMaxSize || state.height < 1 || state.height > kMaxSize)
+        printf("LifeBatch: %ux%u boards clamped to %u cells a side\n", state.width, state.height, kMaxSize);
+    _state.width = std::clamp<uint32_t>(state.width, 1, kMaxSize);
+    _state.height = std::clamp<uint32_t>(state.height, 1, kMaxSize);
+    _widthMask = _state.width == 64 ? ~uint64_t(0) : (uint64_t(1) << _state.width) - 1;
+
+    _cells[0].assign(groups() * groupWords(), 0);
+    _cells[1].assign(groups() * groupWords(), 0);
+    // Lanes past the last board run B3/S23 on nothing.
+    _rules.assign((size_t)groups() * kLanes, LifeRule::conway());
+    _masks.assign((size_t)groups() * 18 * kLanes, 0);
+    _conway.assign(groups(), 1);
+    for (uint32_t group = 0; group < groups(); ++group)
+        updateMasks(group);
+}
+
+LifeBatch::~LifeBatch()
+{
+}
+
+void LifeBatch::setTopology(JDLVTopology topology, uint32_t paddingState)
+{
+    _state.topology = topology;
+    _state.paddingState = paddingState;
+}
+
+bool LifeBatch::setKernel(LifeKernel kernel)
+{
+    if (!life_kernels::available(kernel))
+        return (false);
+    _kernel = kernel;
+    return (true);
+}
+
+void LifeBatch::updateMasks(uint32_t group)
+{
+    uint64_t* masks = &_masks[(size_t)group * 18 * kLanes];
+    bool conway = true;
+    for (uint32_t lane = 0; lane < kLanes; ++lane)
+    {
+        const LifeRule& rule = _rules[(size_t)group * kLanes + lane];
+        for (int k = 0; k <= 8; ++k)
+        {
+            masks[k * kLanes + lane] = (rule.birth >> k) & 1 ? ~uint64_t(0) : 0;
+            masks[(9 + k) * kLanes + lane] = (rule.survive >> k) & 1 ? ~uint64_t(0) : 0;
+        }
+        conway = conway && rule == LifeRule::conway();
+    }
+    _conway[group] = conway;
+}
+
+bool LifeBatch::setRule(uint32_t board, const LifeRule& rule)
+{
+    if (board >= _boards || !rule.isTwoState())
+        return (false);
+    _rules[board] = rule;
+    updateMasks(board / kLanes);
+    return (true);
+}
+
+bool LifeBatch::setRules(const LifeRule& rule)
+{
+    if (!rule.isTwoState())
+        return (false);
+    std::fill(_rules.begin(), _rules.begin() + _boards, rule);
+    for (uint32_t group = 0; group < groups(); ++group)
+        updateMasks(group);
+    return (true);
+}
+
+void LifeBatch::clear()
+{
+    std::fill(_cells[_current].begin(), _cells[_current].end(), 0);
+}
+
+void LifeBatch::clear(uint32_t board)
+{
+    for (uint32_t y = 0; y < _state.height; ++y)
+        *slot(board, y, _current) = 0;
+}
+
+bool LifeBatch::cell(uint32_t board, uint32_t x, uint32_t y) const
+{
+    return ((*slot(board, y, _current) >> x) & 1);
+}
+
+void LifeBatch::setCell(uint32_t board, uint32_t x, uint32_t y, bool alive)
+{
+    uint64_t& word = *slot(board, y, _current);
+    const uint64_t bit = uint64_t(1) << x;
+    word = alive ? (word | bit) : (word & ~bit);
+}
+
+uint64_t LifeBatch::row(uint32_t board, uint32_t y) const
+{
+    return (*slot(board, y, _current));
+}
+
+void LifeBatch::setRow(uint32_t board, uint32_t y, uint64_t bits)
+{
+    *slot(board, y, _current) = bits & _widthMask;
+}
+
+void LifeBatch::importGrid(uint32_t board, const uint32_t* grid)
+{
+    for (uint32_t y = 0; y < _state.height; ++y)
+    {
+        uint64_t word = 0;
+        for (uint32_t x = 0; x < _state.width; ++x)
+            word |= (uint64_t)(grid[(size_t)y * _state.width + x] == 1) << x;
+        *slot(board, y, _current) = word;
+    }
+}
+
+void LifeBatch::exportGrid(uint32_t board, uint32_t* grid) const
+{
+    for (uint32_t y = 0; y < _state.height; ++y)
+    {
+        const uint64_t word = *slot(board, y, _current);
+        for (uint32_t x = 0; x < _state.width; ++x)
+            grid[(size_t)y * _state.width + x] = (word >> x) & 1;
+    }
+}
+
+uint32_t LifeBatch::population(uint32_t board) const
+{
+    uint32_t count = 0;
+    for (uint32_t y = 0; y < _state.height; ++y)
+        count += (uint32_t)__builtin_popcountll(*slot(board, y, _current));
+    return (count);
+}
+
+void LifeBatch::stepGroups(uint32_t begin, uint32_t end, uint64_t generations)
+{
+    const bool wraps = _state.topology == JDLVTopologyTorus || _state.topology == JDLVTopologyKleinBottle;
+    const bool padded = _state.topology == JDLVTopologyPadded && _state.paddingState == 1;
+    const Edges edges = { wraps ? 1u : 0u, padded ? 1u : 0u, padded ? uint64_t(1) << (_state.width - 1) : 0,
+                          _widthMask, (int)_state.width - 1 };
+    const uint32_t height = _state.height;
+    const size_t words = groupWords();
+    const GroupFn* functions = kGroupFunctions[(int)_kernel];
+
+    for (uint32_t group = begin; group < end; ++group)
+    {
+        uint64_t* buffers[2] = { &_cells[0][group * words], &_cells[1][group * words] };
+        const GroupFn fn = functions[_conway[group] ? 1 : 0];
+        const uint64_t* masks = _conway[group] ? nullptr : &_masks[(size_t)group * 18 * kLanes];
+        uint8_t current = _current;
+        for (uint64_t g = 0; g < generations; ++g)
+        {
+            uint64_t* cells = buffers[current];
+            uint64_t* top = cells;
+            uint64_t* bottom = cells + (size_t)(height + 1) * kLanes;
+            for (uint32_t lane = 0; lane < kLanes; ++lane)
+            {
+                life_topology::fillEdgeRow(&top[lane], &cells[(size_t)height * kLanes + lane], 1, _state);
+                life_topology::fillEdgeRow(&bottom[lane], &cells[kLanes + lane], 1, _state);
+                top[lane] &= _widthMask;
+                bottom[lane] &= _widthMask;
+            }
+            fn(cells, buffers[current ^ 1], height, edges, masks);
+            current ^= 1;
+        }
+    }
+}
+
+void LifeBatch::step()
+{
+    step(1);
+}
+
+void LifeBatch::step(uint64_t generations, WorkStealingPool* pool)
+{
+    if (generations == 0)
+        return;
+    if (pool && groups() > 1)
+        pool->parallelFor(groups(), [&](uint32_t begin, uint32_t end) { stepGroups(begin, end, generations); });
+    else
+        stepGroups(0, groups(), generations);
+    _current ^= (uint8_t)(generations & 1);
+    _generation += generations;
+}
@@ -0,0 +1,108 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: RMDLLifeBatch.hpp             +++     +++     **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 19/10/2026 21:36:08      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef RMDLLIFEBATCH_HPP
+# define RMDLLIFEBATCH_HPP
+
+# include <cstddef>
+# include <cstdint>
+# include <vector>
+
+# include "JDLV_shared.h"
+# include "NonCopyable.h"
+# include "RMDLLifeKernels.hpp"
+# include "RMDLLifeRule.hpp"
+
+class WorkStealingPool;
+
+/// Many small two-state boards of one size, for rule sweeps and soup
+/// searches. A board is at most 64x64, so each of its rows is one word;
+/// boards are interleaved by groups of kLanes, row y of every board of a
+/// group in one cache line, and a kernel vector steps the same row of 2
+/// (NEON) or 4 (AVX2) boards at once, the scalar kernel one board a word,
+/// each with its own rule. A lane is a whole 64-cell row rather than 16 or
+/// 32 narrower boards packed in 8-16 per vector: the west and east shifts
+/// then stay inside a lane like LifeEngine's, where narrower lanes would
+/// need a mask per shift to keep cells from crossing into the next board,
+/// and boards up to 64 wide still fit.
+/// Per-board rules are looked up from the neighbour count bit-planes with
+/// a select tree over per-lane masks; groups whose boards all run B3/S23
+/// take the hand-reduced adder instead. step(n) runs all n generations on
+/// one group (both buffers, about 8 KB) before moving to the next, so the
+/// boards never leave L1.
+class LifeBatch : public NonCopyable
+{
+public:
+    static constexpr uint32_t kMaxSize = 64;
+    static constexpr uint32_t kLanes = 8;
+
+    /// Width and height are clamped to [1, kMaxSize]; every board starts empty, on B3/S23.
+    LifeBatch(const JDLVState& state, uint32_t boards);
+    ~LifeBatch();
+
+    const JDLVState&    state() const       { return _state; }
+    uint32_t            width() const       { return _state.width; }
+    uint32_t            height() const      { return _state.height; }
+    uint32_t            boards() const      { return _boards; }
+    JDLVTopology        topology() const    { return (JDLVTopology)_state.topology; }
+    void                setTopology(JDLVTopology topology, uint32_t paddingState = 0);
+    uint64_t            generation() const  { return _generation; }
+    void                setGeneration(uint64_t generation) { _generation = generation; }
+    LifeKernel          kernel() const      { return _kernel; }
+    bool                setKernel(LifeKernel kernel);
+
+    /// Two-state rules only, as for LifeEngine.
+    bool                setRule(uint32_t board, const LifeRule& rule);
+    bool                setRules(const LifeRule& rule);
+    const LifeRule&     rule(uint32_t board) const  { return _rules[board]; }
+
+    void                clear();
+    void                clear(uint32_t board);
+    bool                cell(uint32_t board, uint32_t x, uint32_t y) const;
+    void                setCell(uint32_t board, uint32_t x, uint32_t y, bool alive);
+    /// Row y of a board, bit x is cell x.
+    uint64_t            row(uint32_t board, uint32_t y) const;
+    void                setRow(uint32_t board, uint32_t y, uint64_t bits);
+
+    /// JDLV layout, width * height cells of one board.
+    void                importGrid(uint32_t board, const uint32_t* grid);
+    void                exportGrid(uint32_t board, uint32_t* grid) const;
+
+    uint32_t            population(uint32_t board) const;
+
+    void                step();
+    /// Groups are independent, so a pool takes them a chunk each.
+    void                step(uint64_t generations, WorkStealingPool* pool = nullptr);
+
+private:
+    uint32_t            groups() const      { return (_boards + kLanes - 1) / kLanes; }
+    size_t              groupWords() const  { return ((size_t)_state.height + 2) * kLanes; }
+    uint64_t*           slot(uint32_t board, uint32_t y, uint8_t buffer)
+    { return &_cells[buffer][(board / kLanes) * groupWords() + ((size_t)y + 1) * kLanes + board % kLanes]; }
+    const uint64_t*     slot(uint32_t board, uint32_t y, uint8_t buffer) const
+    { return &_cells[buffer][(board / kLanes) * groupWords() + ((size_t)y + 1) * kLanes + board % kLanes]; }
+    void                updateMasks(uint32_t group);
+    void                stepGroups(uint32_t begin, uint32_t end, uint64_t generations);
+
+    JDLVState               _state;
+    uint32_t                _boards;
+    uint64_t                _widthMask;
+    std::vector<uint64_t>   _cells[2];      // per group: halo row, height rows, halo row; kLanes words each
+    uint8_t                 _current;
+    uint64_t                _generation;
+    LifeKernel              _kernel;
+
+    std::vector<LifeRule>   _rules;
+    // Per group: birth[9][kLanes] then survive[9][kLanes], all ones where the board's rule has the count.
+    std::vector<uint64_t>   _masks;
+    std::vector<uint8_t>    _conway;        // per group: every lane runs B3/S23
+};
+
+#endif /* RMDLLIFEBATCH_HPP */
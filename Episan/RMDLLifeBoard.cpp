@@ -0,0 +1,96 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: RMDLLifeBoard.cpp             +++     +++     **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 17/10/2026 20:31:12      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include <algorithm>
+#include <vector>
+
+#include "RMDLLifeBoard.hpp"
+
+namespace life_board
+{
+
+void applyRule(LifeEngine& engine, std::unique_ptr<RuleTableEngine>& multiState, const LifeRule& rule)
+{
+    if (!rule.isTwoState())
+    {
+        RuleTable table;
+        if (RuleTable::fromLifeRule(rule, table))
+            applyRuleTable(engine, multiState, table);
+        return;
+    }
+    if (multiState)
+    {
+        // Dying cells are dead to a two-state rule.
+        std::vector<uint32_t> grid((size_t)engine.width() * engine.height());
+        multiState->exportGrid(grid.data());
+        for (uint32_t& cell : grid)
+            cell = cell == 1;
+        engine.importGrid(grid.data());
+        engine.setGeneration(multiState->generation());
+        multiState.reset();
+    }
+    engine.setRule(rule);
+}
+
+void applyRuleTable(LifeEngine& engine, std::unique_ptr<RuleTableEngine>& multiState, const RuleTable& table)
+{
+    if (multiState)
+    {
+        multiState->setTable(table);
+        return;
+    }
+    std::vector<uint32_t> grid((size_t)engine.width() * engine.height());
+    engine.exportGrid(grid.data());
+    multiState.reset(new RuleTableEngine(engine.state(), table));
+    multiState->importGrid(grid.data());
+    multiState->setGeneration(engine.generation());
+}
+
+void setTopology(LifeEngine& engine, RuleTableEngine* multiState, JDLVTopology topology, uint32_t paddingState)
+{
+    engine.setTopology(topology, paddingState);
+    if (multiState)
+        multiState->setTopology(topology, paddingState);
+}
+
+void importGrid(LifeEngine& engine, RuleTableEngine* multiState, const uint32_t* grid, uint64_t generation)
+{
+    if (multiState)
+    {
+        multiState->importGrid(grid);
+        multiState->setGeneration(generation);
+    }
+    else
+    {
+        engine.importGrid(grid);
+        engine.setGeneration(generation);
+    }
+}
+
+void exportGrid(const LifeEngine& engine, const RuleTableEngine* multiState, uint32_t* grid)
+{
+    if (multiState)
+        multiState->exportGrid(grid);
+    else
+        engine.exportGrid(grid);
+}
+
+void fillSpan(LifeEngine& engine, RuleTableEngine* multiState, uint32_t y, uint32_t x0, uint32_t x1, uint32_t state)
+{
+    if (multiState)
+    {
+        for (uint32_t x = x0; x < x1; ++x)
+            multiState->setCell(x, y, (uint8_t)std::min<uint32_t>(state, 255));
+    }
+    else
+        engine.fillSpan(y, x0, x1, state > 0);  // stamps write cell runs: a state > 0 run is one span
+}
+
+}
@@ -0,0 +1,37 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: RMDLLifeBoard.hpp             +++     +++     **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 17/10/2026 20:31:07      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef RMDLLIFEBOARD_HPP
+# define RMDLLIFEBOARD_HPP
+
+# include <cstdint>
+# include <memory>
+
+# include "RMDLLifeEngine.hpp"
+# include "RMDLRuleTableEngine.hpp"
+
+/// The board LifeSimulation steps and LifeReplay plays back: a packed
+/// LifeEngine for two-state rules, plus a RuleTableEngine built from it
+/// while a Generations rule or a rule table runs. Both go through these
+/// switches, so a replay changes engines exactly where the live run did.
+namespace life_board
+{
+    /// Two-state rules run packed (dying cells become dead), the rest on the byte engine.
+    void    applyRule(LifeEngine& engine, std::unique_ptr<RuleTableEngine>& multiState, const LifeRule& rule);
+    void    applyRuleTable(LifeEngine& engine, std::unique_ptr<RuleTableEngine>& multiState, const RuleTable& table);
+    void    setTopology(LifeEngine& engine, RuleTableEngine* multiState, JDLVTopology topology, uint32_t paddingState);
+    /// Replaces the cells of whichever engine runs (JDLV layout) and its generation.
+    void    importGrid(LifeEngine& engine, RuleTableEngine* multiState, const uint32_t* grid, uint64_t generation);
+    void    exportGrid(const LifeEngine& engine, const RuleTableEngine* multiState, uint32_t* grid);
+    /// Cells [x0, x1) of row y; the packed engine only keeps alive or dead.
+    void    fillSpan(LifeEngine& engine, RuleTableEngine* multiState, uint32_t y, uint32_t x0, uint32_t x1, uint32_t state);
+}
+
+#endif /* RMDLLIFEBOARD_HPP */
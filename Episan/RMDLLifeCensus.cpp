@@ -0,0 +1,641 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: RMDLLifeCensus.cpp              +++     +++   **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 18/10/2026 19:05:10      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <memory>
+
+#include "RMDLLifeCensus.hpp"
+#include "RMDLLifeEngine.hpp"
+#include "RMDLLifePatterns.hpp"
+#include "RMDLLifeUniverse.hpp"
+#include "RMDLWorkStealingPool.hpp"
+
+using Cell = LifeCensus::Cell;
+
+static constexpr uint32_t kMaxSoupPeriod = 30;      // blinkers with a pentadecathlon
+static constexpr uint32_t kMinSettledWindow = 24;   // equal populations needed even for period 1
+static constexpr uint64_t kFlushSoups = 256;
+static constexpr uint64_t kCullInterval = 64;       // generations between looks for escaping gliders
+static constexpr int64_t  kGliderMargin = 16;       // clearance from everything else before a glider is let go
+static const char         kGliderCode[] = "xq4_153";
+static constexpr uint32_t kSoupMargin = 120;        // 256x256 board around the soup
+static constexpr uint32_t kObjectMargin = 8;        // room for an isolated object to oscillate in
+
+static void liveCells(const LifeUniverse& universe, std::vector<Cell>& cells)
+{
+    std::vector<uint64_t> keys;
+    universe.tileKeys(keys);
+    cells.clear();
+    for (uint64_t key : keys)
+    {
+        const int32_t tx = LifeUniverse::tileX(key);
+        const int32_t ty = LifeUniverse::tileY(key);
+        const uint64_t* rows = universe.tileRows(tx, ty);
+        for (int32_t y = 0; rows && y < LifeUniverse::kTileSize; ++y)
+            for (uint64_t word = rows[y]; word; word &= word - 1)
+                cells.emplace_back((int64_t)tx * LifeUniverse::kTileSize + __builtin_ctzll(word),
+                                   (int64_t)ty * LifeUniverse::kTileSize + y);
+    }
+    std::sort(cells.begin(), cells.end());
+}
+
+static void load(LifeUniverse& universe, const std::vector<Cell>& cells)
+{
+    universe.clear();
+    for (const Cell& cell : cells)
+        universe.setCell(cell.first, cell.second, true);
+}
+
+static JDLVState boardAround(const std::vector<Cell>& cells, uint32_t margin, Cell& origin)
+{
+    int64_t x0 = 0, y0 = 0, x1 = -1, y1 = -1;
+    for (size_t i = 0; i < cells.size(); ++i)
+    {
+        x0 = i ? std::min(x0, cells[i].first) : cells[i].first;
+        y0 = i ? std::min(y0, cells[i].second) : cells[i].second;
+        x1 = i ? std::max(x1, cells[i].first) : cells[i].first;
+        y1 = i ? std::max(y1, cells[i].second) : cells[i].second;
+    }
+    origin = Cell(x0 - margin, y0 - margin);
+    return (JDLVState{ (uint32_t)(x1 - x0 + 1 + 2 * margin), (uint32_t)(y1 - y0 + 1 + 2 * margin), JDLVTopologyPlane, 0 });
+}
+
+namespace
+{
+
+/// Steps a finite pattern as if the plane were infinite: on a packed plane
+/// LifeEngine with `margin` dead cells around it while nothing touches the
+/// board's outer ring (up to there the dead halo is exact), on a
+/// LifeUniverse from then on. Cells are in the caller's coordinates.
+class PatternStepper : public NonCopyable
+{
+public:
+    PatternStepper(const std::vector<Cell>& cells, uint32_t margin)
+        : _board(boardAround(cells, margin, _origin))
+    {
+        _board.setKernel(life_kernels::best());
+        for (const Cell& cell : cells)
+            _board.setCell((uint32_t)(cell.first - _origin.first), (uint32_t)(cell.second - _origin.second), true);
+    }
+
+    void        step()
+    {
+        if (!_universe && touchesEdge())
+        {
+            std::vector<Cell> cells;
+            liveCells(cells);
+            _universe = std::make_unique<LifeUniverse>();
+            load(*_universe, cells);
+        }
+        if (_universe)
+            _universe->step();
+        else
+            _board.step();
+    }
+
+    uint64_t    population() const { return (_universe ? _universe->population() : _board.population()); }
+
+    /// Sorted live cells.
+    void        liveCells(std::vector<Cell>& cells) const
+    {
+        if (_universe)
+        {
+            ::liveCells(*_universe, cells);
+            return;
+        }
+        cells.clear();
+        for (uint32_t y = 0; y < _board.height(); ++y)
+        {
+            const uint64_t* row = _board.row((int32_t)y);
+            for (size_t w = 0; w < _board.wordsPerRow(); ++w)
+                for (uint64_t word = row[w]; word; word &= word - 1)
+                    cells.emplace_back(_origin.first + (int64_t)(w * 64 + __builtin_ctzll(word)), _origin.second + y);
+        }
+        std::sort(cells.begin(), cells.end());
+    }
+
+    void        erase(const std::vector<Cell>& cells)
+    {
+        for (const Cell& cell : cells)
+        {
+            if (_universe)
+                _universe->setCell(cell.first, cell.second, false);
+            else
+                _board.setCell((uint32_t)(cell.first - _origin.first), (uint32_t)(cell.second - _origin.second), false);
+        }
+    }
+
+    /// Something lives in the outer ring of 64x64 tiles (always true once unbounded).
+    bool        nearEdge() const
+    {
+        if (_universe)
+            return (true);
+        const uint32_t tilesX = _board.tilesX(), tilesY = _board.tilesY();
+        for (uint32_t ty = 0; ty < tilesY; ++ty)
+            for (uint32_t tx = 0; tx < tilesX; ++tx)
+                if ((tx == 0 || ty == 0 || tx + 1 == tilesX || ty + 1 == tilesY) && _board.tilePopulation(tx, ty))
+                    return (true);
+        return (false);
+    }
+
+private:
+    bool        touchesEdge() const
+    {
+        const size_t last = _board.wordsPerRow() - 1;
+        const uint64_t rightBit = uint64_t(1) << ((_board.width() - 1) & 63);
+        for (uint32_t y = 0; y < _board.height(); ++y)
+        {
+            const uint64_t* row = _board.row((int32_t)y);
+            if ((row[0] & 1) || (row[last] & rightBit))
+                return (true);
+        }
+        const uint64_t* top = _board.row(0);
+        const uint64_t* bottom = _board.row((int32_t)_board.height() - 1);
+        for (size_t w = 0; w <= last; ++w)
+            if (top[w] | bottom[w])
+                return (true);
+        return (false);
+    }
+
+    Cell                            _origin;
+    LifeEngine                      _board;
+    std::unique_ptr<LifeUniverse>   _universe;
+};
+
+}
+
+/// Moves `cells` so their bounding box starts at (0, 0); returns the old corner.
+static Cell normalise(std::vector<Cell>& cells)
+{
+    if (cells.empty())
+        return (Cell(0, 0));
+    Cell corner = cells[0];
+    for (const Cell& cell : cells)
+    {
+        corner.first = std::min(corner.first, cell.first);
+        corner.second = std::min(corner.second, cell.second);
+    }
+    for (Cell& cell : cells)
+    {
+        cell.first -= corner.first;
+        cell.second -= corner.second;
+    }
+    std::sort(cells.begin(), cells.end());
+    return (corner);
+}
+
+/// Extended Wechsler format, as apgsearch writes it: 5-row strips separated by
+/// 'z', one base-32 digit per column (bit k is row k of the strip), trailing
+/// empty columns dropped and runs of empty columns shortened to 0, w, x or yN.
+static std::string wechsler(const std::vector<Cell>& shape, uint32_t orientation)
+{
+    static const char kDigits[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+
+    int64_t width = 0, height = 0;
+    for (const Cell& cell : shape)
+    {
+        width = std::max(width, cell.first + 1);
+        height = std::max(height, cell.second + 1);
+    }
+    const bool transpose = orientation & 4;
+    const int64_t columns = transpose ? height : width;
+    const int64_t rows = transpose ? width : height;
+
+    std::vector<uint8_t> grid((size_t)(columns * rows), 0);
+    for (const Cell& cell : shape)
+    {
+        int64_t x = transpose ? cell.second : cell.first;
+        int64_t y = transpose ? cell.first : cell.second;
+        if (orientation & 1)
+            x = columns - 1 - x;
+        if (orientation & 2)
+            y = rows - 1 - y;
+        grid[(size_t)(y * columns + x)] = 1;
+    }
+
+    std::string code;
+    for (int64_t y0 = 0; y0 < rows; y0 += 5)
+    {
+        if (y0)
+            code += 'z';
+        uint32_t zeroes = 0;
+        for (int64_t x = 0; x < columns; ++x)
+        {
+            uint32_t digit = 0;
+            for (int64_t k = 0; k < 5 && y0 + k < rows; ++k)
+                digit |= (uint32_t)grid[(size_t)((y0 + k) * columns + x)] << k;
+            if (!digit)
+            {
+                zeroes += 1;
+                continue;
+            }
+            for (; zeroes > 0; zeroes -= std::min<uint32_t>(zeroes, 39))
+            {
+                const uint32_t run = std::min<uint32_t>(zeroes, 39);
+                if (run == 1)
+                    code += '0';
+                else if (run == 2)
+                    code += 'w';
+                else if (run == 3)
+                    code += 'x';
+                else
+                {
+                    code += 'y';
+                    code += kDigits[run - 4];
+                }
+            }
+            code += kDigits[digit];
+        }
+    }
+    return (code);
+}
+
+/// apgsearch ordering: the shorter code wins, then the lexicographically smaller one.
+static bool betterCode(const std::string& a, const std::string& b)
+{
+    if (b.empty())
+        return (true);
+    if (a.size() != b.size())
+        return (a.size() < b.size());
+    return (a < b);
+}
+
+/// Groups cells whose Chebyshev distance is at most `reach`. Neighbours are
+/// found by binary search in the (x, y) order, one column at a time.
+static void components(const std::vector<Cell>& cells, int64_t reach, std::vector<std::vector<Cell>>& out)
+{
+    std::vector<Cell> sorted = cells;
+    std::sort(sorted.begin(), sorted.end());
+
+    std::vector<uint32_t> parent(sorted.size());
+    for (uint32_t i = 0; i < parent.size(); ++i)
+        parent[i] = i;
+    auto find = [&parent](uint32_t i)
+    {
+        while (parent[i] != i)
+            i = parent[i] = parent[parent[i]];
+        return (i);
+    };
+
+    for (uint32_t i = 0; i < sorted.size(); ++i)
+    {
+        const Cell cell = sorted[i];
+        // Later columns only: every pair is seen once from its leftmost cell.
+        for (int64_t dx = 0; dx <= reach; ++dx)
+        {
+            auto it = std::lower_bound(sorted.begin(), sorted.end(), Cell(cell.first + dx, cell.second - reach));
+            for (; it != sorted.end() && it->first == cell.first + dx && it->second <= cell.second + reach; ++it)
+                parent[find((uint32_t)(it - sorted.begin()))] = find(i);
+        }
+    }
+
+    std::unordered_map<uint32_t, uint32_t> group;
+    out.clear();
+    for (uint32_t i = 0; i < sorted.size(); ++i)
+    {
+        auto inserted = group.emplace(find(i), (uint32_t)out.size());
+        if (inserted.second)
+            out.emplace_back();
+        out[inserted.first->second].push_back(sorted[i]);
+    }
+}
+
+/// Period of a finite pattern, 0 if it does not come back within maxPeriod.
+/// `shift` is how far it moved in one period (0, 0 for an oscillator);
+/// `phases` gets every normalised phase.
+static uint32_t period(const std::vector<Cell>& cells, uint32_t maxPeriod, Cell& shift,
+                       std::vector<std::vector<Cell>>* phases)
+{
+    std::vector<Cell> start = cells;
+    const Cell origin = normalise(start);
+    if (phases)
+        phases->assign(1, start);
+
+    PatternStepper stepper(cells, kObjectMargin);
+    std::vector<Cell> current;
+    for (uint32_t p = 1; p <= maxPeriod; ++p)
+    {
+        stepper.step();
+        stepper.liveCells(current);
+        if (current.empty() || current.size() > 4 * start.size() + 64)
+            return (0);
+        const Cell corner = normalise(current);
+        if (current == start)
+        {
+            shift = Cell(corner.first - origin.first, corner.second - origin.second);
+            return (p);
+        }
+        if (phases)
+            phases->push_back(current);
+    }
+    return (0);
+}
+
+/// Finds the gliders that are well clear of every other object and flying
+/// away from all of them: nothing in a soup's ash can catch up with them,
+/// and left alone they would run into the board edge or keep a trail of
+/// universe tiles busy. Their cells go to `culled`; returns how many.
+static uint64_t escapingGliders(const std::vector<Cell>& cells, std::vector<Cell>& culled)
+{
+    culled.clear();
+    std::vector<std::vector<Cell>> objects;
+    components(cells, 2, objects);
+
+    std::vector<Cell> shifts(objects.size(), Cell(0, 0));
+    int64_t x0 = INT64_MAX, y0 = INT64_MAX, x1 = INT64_MIN, y1 = INT64_MIN;
+    for (size_t i = 0; i < objects.size(); ++i)
+    {
+        if (objects[i].size() == 5 && period(objects[i], 4, shifts[i], nullptr) == 4 && shifts[i] != Cell(0, 0))
+            continue;
+        shifts[i] = Cell(0, 0);
+        for (const Cell& cell : objects[i])
+        {
+            x0 = std::min(x0, cell.first);
+            y0 = std::min(y0, cell.second);
+            x1 = std::max(x1, cell.first);
+            y1 = std::max(y1, cell.second);
+        }
+    }
+
+    uint64_t count = 0;
+    for (size_t i = 0; i < objects.size(); ++i)
+    {
+        const Cell shift = shifts[i];
+        if (shift == Cell(0, 0))
+            continue;
+        int64_t gx0 = INT64_MAX, gy0 = INT64_MAX, gx1 = INT64_MIN, gy1 = INT64_MIN;
+        for (const Cell& cell : objects[i])
+        {
+            gx0 = std::min(gx0, cell.first);
+            gy0 = std::min(gy0, cell.second);
+            gx1 = std::max(gx1, cell.first);
+            gy1 = std::max(gy1, cell.second);
+        }
+        // With nothing but gliders left the box is empty and every one of them goes.
+        const bool escaping = x0 > x1
+                           || (shift.first > 0 && gx0 > x1 + kGliderMargin)
+                           || (shift.first < 0 && gx1 < x0 - kGliderMargin)
+                           || (shift.second > 0 && gy0 > y1 + kGliderMargin)
+                           || (shift.second < 0 && gy1 < y0 - kGliderMargin);
+        if (!escaping)
+            continue;
+        culled.insert(culled.end(), objects[i].begin(), objects[i].end());
+        count += 1;
+    }
+    return (count);
+}
+
+LifeCensus::LifeCensus(uint64_t seed, uint64_t maxGenerations)
+    : _seed(seed)
+    , _maxGenerations(maxGenerations)
+    , _next(0)
+    , _end(0)
+    , _soups(0)
+    , _unsettled(0)
+    , _seconds(0)
+    , _workers(0)
+{
+}
+
+LifeCensus::~LifeCensus()
+{
+}
+
+void LifeCensus::soup(uint64_t seed, uint64_t index, std::vector<Cell>& cells)
+{
+    uint64_t state = seed ^ (index * 0xD1B54A32D192ED03ull);
+    cells.clear();
+    for (uint32_t y = 0; y < kSoupSize; y += 4)
+    {
+        const uint64_t bits = life_patterns::splitMix64(state);
+        for (uint32_t i = 0; i < 64; ++i)
+            if ((bits >> i) & 1)
+                cells.emplace_back(i % kSoupSize, y + i / kSoupSize);
+    }
+}
+
+std::string LifeCensus::classify(const std::vector<Cell>& cells, uint32_t maxPeriod)
+{
+    Cell shift;
+    std::vector<std::vector<Cell>> phases;
+    const uint32_t p = period(cells, maxPeriod, shift, &phases);
+    if (!p)
+        return ("");
+
+    std::string best;
+    for (const std::vector<Cell>& phase : phases)
+        for (uint32_t orientation = 0; orientation < 8; ++orientation)
+        {
+            std::string code = wechsler(phase, orientation);
+            if (betterCode(code, best))
+                best.swap(code);
+        }
+
+    if (shift != Cell(0, 0))
+        return ("xq" + std::to_string(p) + "_" + best);
+    if (p > 1)
+        return ("xp" + std::to_string(p) + "_" + best);
+    return ("xs" + std::to_string(cells.size()) + "_" + best);
+}
+
+bool LifeCensus::separate(const std::vector<Cell>& cells, std::vector<std::string>& codes)
+{
+    // Cells two apart share neighbours and may interact: they start out as one object.
+    std::vector<std::vector<Cell>> objects;
+    components(cells, 2, objects);
+
+    std::vector<std::vector<Cell>> parts;
+    for (const std::vector<Cell>& object : objects)
+    {
+        // A pseudo-object (bi-block and friends) falls apart into pieces that
+        // evolve exactly as they do together; those are counted one by one.
+        components(object, 1, parts);
+        bool independent = false;
+        Cell shift;
+        const uint32_t p = parts.size() > 1 ? period(object, kMaxObjectPeriod, shift, nullptr) : 0;
+        if (p)
+        {
+            PatternStepper whole(object, kObjectMargin);
+            std::vector<std::unique_ptr<PatternStepper>> pieces;
+            for (const std::vector<Cell>& part : parts)
+                pieces.push_back(std::make_unique<PatternStepper>(part, kObjectMargin));
+
+            independent = true;
+            std::vector<Cell> together, apart, piece;
+            for (uint32_t t = 0; t < p && independent; ++t)
+            {
+                whole.step();
+                whole.liveCells(together);
+                apart.clear();
+                for (std::unique_ptr<PatternStepper>& stepper : pieces)
+                {
+                    stepper->step();
+                    stepper->liveCells(piece);
+                    apart.insert(apart.end(), piece.begin(), piece.end());
+                }
+                std::sort(apart.begin(), apart.end());
+                independent = apart == together;
+            }
+        }
+
+        if (!independent)
+            parts.assign(1, object);
+        for (const std::vector<Cell>& part : parts)
+        {
+            std::string code = classify(part);
+            if (code.empty())
+                return (false);
+            codes.push_back(code);
+        }
+    }
+    return (true);
+}
+
+bool LifeCensus::searchSoup(uint64_t index, std::unordered_map<std::string, uint64_t>& local) const
+{
+    std::vector<Cell> cells;
+    soup(_seed, index, cells);
+    PatternStepper stepper(cells, kSoupMargin);
+
+    std::vector<uint64_t> populations;
+    std::vector<Cell> culled;
+    std::vector<std::string> codes;
+    uint64_t escaped = 0;
+    for (uint64_t generation = 1; generation <= _maxGenerations; ++generation)
+    {
+        stepper.step();
+
+        // Gliders only need seeing to once they head for the edge of the board.
+        if (generation % kCullInterval == 0 && stepper.nearEdge())
+        {
+            stepper.liveCells(cells);
+            const uint64_t count = escapingGliders(cells, culled);
+            stepper.erase(culled);
+            escaped += count;
+            if (count)
+                populations.clear();
+        }
+        populations.push_back(stepper.population());
+
+        // Settled once the population has repeated with some period p for
+        // long enough; gliders still on their way out do not change the count.
+        const size_t n = populations.size();
+        bool settled = false;
+        for (uint32_t p = 1; p <= kMaxSoupPeriod && !settled; ++p)
+        {
+            const size_t window = std::max<size_t>(3 * p, kMinSettledWindow);
+            if (n < window + p)
+                break;
+            settled = true;
+            for (size_t i = 1; i <= window && settled; ++i)
+                settled = populations[n - i] == populations[n - i - p];
+        }
+        if (!settled)
+            continue;
+
+        stepper.liveCells(cells);
+        codes.clear();
+        if (separate(cells, codes))
+        {
+            for (const std::string& code : codes)
+                local[code] += 1;
+            if (escaped)
+                local[kGliderCode] += escaped;
+            return (true);
+        }
+        // Something in there is still evolving: look again once it has had time to settle.
+        populations.clear();
+    }
+    return (false);
+}
+
+void LifeCensus::flush(std::unordered_map<std::string, uint64_t>& local)
+{
+    std::hash<std::string> hasher;
+    for (const auto& entry : local)
+    {
+        Shard& shard = _shards[hasher(entry.first) % kShards];
+        std::lock_guard<std::mutex> guard(shard.lock);
+        shard.counts[entry.first] += entry.second;
+    }
+    local.clear();
+}
+
+void LifeCensus::worker()
+{
+    std::unordered_map<std::string, uint64_t> local;
+    uint64_t sinceFlush = 0;
+    for (uint64_t index = _next.fetch_add(1); index < _end; index = _next.fetch_add(1))
+    {
+        if (!searchSoup(index, local))
+            _unsettled.fetch_add(1);
+        _soups.fetch_add(1);
+        if (++sinceFlush == kFlushSoups)
+        {
+            flush(local);
+            sinceFlush = 0;
+        }
+    }
+    flush(local);
+}
+
+void LifeCensus::run(uint64_t soups, WorkStealingPool* pool)
+{
+    const auto start = std::chrono::steady_clock::now();
+    _end = _next.load() + soups;
+
+    if (!pool)
+        worker();
+    else
+    {
+        const uint32_t workers = pool->threadCount();
+        _workers.store(workers);
+        for (uint32_t i = 0; i < workers; ++i)
+            pool->submit([this]
+            {
+                worker();
+                // Under the lock, or run() could return and free the census before the notify.
+                std::lock_guard<std::mutex> guard(_doneLock);
+                if (_workers.fetch_sub(1) == 1)
+                    _doneSignal.notify_all();
+            });
+        std::unique_lock<std::mutex> guard(_doneLock);
+        _doneSignal.wait(guard, [this] { return (_workers.load() == 0); });
+    }
+    // Workers overshoot _next by one each on their way out.
+    _next.store(_end);
+    _seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+std::vector<LifeCensus::Tally> LifeCensus::results() const
+{
+    std::vector<Tally> tallies;
+    for (const Shard& shard : _shards)
+    {
+        std::lock_guard<std::mutex> guard(shard.lock);
+        for (const auto& entry : shard.counts)
+            tallies.push_back({ entry.first, entry.second });
+    }
+    std::sort(tallies.begin(), tallies.end(), [](const Tally& a, const Tally& b)
+    {
+        return (a.count != b.count ? a.count > b.count : a.code < b.code);
+    });
+    return (tallies);
+}
+
+uint64_t LifeCensus::count(const std::string& code) const
+{
+    const Shard& shard = _shards[std::hash<std::string>()(code) % kShards];
+    std::lock_guard<std::mutex> guard(shard.lock);
+    auto it = shard.counts.find(code);
+    return (it == shard.counts.end() ? 0 : it->second);
+}
@@ -0,0 +1,102 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: RMDLLifeCensus.hpp              +++     +++   **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 18/10/2026 19:04:52      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef RMDLLIFECENSUS_HPP
+# define RMDLLIFECENSUS_HPP
+
+# include <atomic>
+# include <condition_variable>
+# include <cstdint>
+# include <mutex>
+# include <string>
+# include <unordered_map>
+# include <utility>
+# include <vector>
+
+# include "NonCopyable.h"
+
+class WorkStealingPool;
+
+/// apgsearch-style census of random 16x16 soups (B3/S23, density 1/2).
+/// Soup n is seeded from SplitMix64 over (seed, n) alone, so a census is
+/// reproducible whatever the thread count. Each soup runs on a packed plane
+/// LifeEngine (moved to an unbounded LifeUniverse if it reaches the edge)
+/// until its population is periodic. The ash is then cut into objects and
+/// each is counted under its apgcode: xs4_33 for a block, xp2_7 for a
+/// blinker, xq4_153 for a glider, i.e. the smallest extended Wechsler code
+/// over all phases and the 8 symmetries. As in apgsearch, gliders that have
+/// cleared the ash are counted and deleted on the way out.
+/// Workers tally into private maps and flush them into a sharded table
+/// every so often, so nothing hot is shared.
+class LifeCensus : public NonCopyable
+{
+public:
+    using Cell = std::pair<int64_t, int64_t>;   // x, y
+
+    struct Tally
+    {
+        std::string code;
+        uint64_t    count;
+    };
+
+    static constexpr uint32_t kSoupSize = 16;
+
+    explicit LifeCensus(uint64_t seed = 0, uint64_t maxGenerations = 8192);
+    ~LifeCensus();
+
+    /// Searches the next `soups` soups, one per pool worker at a time (on the calling thread without a pool).
+    void        run(uint64_t soups, WorkStealingPool* pool = nullptr);
+
+    uint64_t    soups() const               { return _soups.load(); }
+    /// Soups whose population was still not periodic after maxGenerations.
+    uint64_t    unsettled() const           { return _unsettled.load(); }
+    double      seconds() const             { return _seconds; }
+    double      soupsPerSecond() const      { return _seconds > 0 ? soups() / _seconds : 0; }
+
+    /// Every object seen so far, most common first (ties by code).
+    std::vector<Tally> results() const;
+    uint64_t    count(const std::string& code) const;
+
+    /// Live cells of soup `index` of a census started with `seed`, in [0, kSoupSize)^2.
+    static void soup(uint64_t seed, uint64_t index, std::vector<Cell>& cells);
+    /// apgcode of a finite pattern that repeats within maxPeriod generations, "" otherwise.
+    static std::string classify(const std::vector<Cell>& cells, uint32_t maxPeriod = kMaxObjectPeriod);
+    /// Cuts settled ash into objects and names them; false if some piece is not periodic.
+    static bool separate(const std::vector<Cell>& cells, std::vector<std::string>& codes);
+
+private:
+    static constexpr uint32_t kShards = 64;
+    static constexpr uint32_t kMaxObjectPeriod = 64;
+
+    struct alignas(64) Shard
+    {
+        mutable std::mutex                          lock;
+        std::unordered_map<std::string, uint64_t>   counts;
+    };
+
+    void        worker();
+    bool        searchSoup(uint64_t index, std::unordered_map<std::string, uint64_t>& local) const;
+    void        flush(std::unordered_map<std::string, uint64_t>& local);
+
+    uint64_t                _seed;
+    uint64_t                _maxGenerations;
+    Shard                   _shards[kShards];
+    std::atomic<uint64_t>   _next;          // next soup index to hand out
+    uint64_t                _end;           // one past the last soup of this run()
+    std::atomic<uint64_t>   _soups;
+    std::atomic<uint64_t>   _unsettled;
+    double                  _seconds;
+
+    std::atomic<uint32_t>   _workers;
+    std::mutex              _doneLock;
+    std::condition_variable _doneSignal;
+};
+
+#endif /* RMDLLIFECENSUS_HPP */
@@ -0,0 +1,186 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: RMDLLifeCheckpoint.cpp        +++     +++     **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 18/10/2026 09:12:31      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+#include "RMDLLifeCheckpoint.hpp"
+
+static const char kMagic[8] = { 'E', 'P', 'I', 'S', 'C', 'K', 'P', 'T' };
+
+LifeCheckpoint::LifeCheckpoint()
+    : _revision(0)
+    , _pendingFirst(SIZE_MAX)
+    , _pendingLast(0)
+{
+}
+
+LifeCheckpoint::~LifeCheckpoint()
+{
+    close();
+}
+
+void LifeCheckpoint::close()
+{
+    if (_file.data())
+        commit();
+    _file.close();
+    _revision = 0;
+    _pendingFirst = SIZE_MAX;
+    _pendingLast = 0;
+}
+
+void LifeCheckpoint::fillHeader(const LifeEngine& engine)
+{
+    LifeCheckpointHeader* h = header();
+    memcpy(h->magic, kMagic, sizeof(kMagic));
+    h->version = LifeCheckpointHeader::kVersion;
+    h->dataOffset = LifeCheckpointHeader::kDataOffset;
+    h->width = engine.width();
+    h->height = engine.height();
+    h->topology = engine.state().topology;
+    h->paddingState = engine.state().paddingState;
+    h->birth = engine.rule().birth;
+    h->survive = engine.rule().survive;
+    h->states = engine.rule().states;
+    h->stride = engine.stride();
+    h->rows = (uint64_t)engine.height() + 2;
+    h->generation = engine.generation();
+}
+
+bool LifeCheckpoint::create(const char* path, const LifeEngine& engine)
+{
+    close();
+    const size_t dataBytes = engine.cellWords() * sizeof(uint64_t);
+    if (!_file.create(path, LifeCheckpointHeader::kDataOffset + dataBytes))
+        return (false);
+
+    LifeCheckpointHeader* h = header();
+    h->committed = 0;
+    fillHeader(engine);
+    memcpy(_file.mutableData() + LifeCheckpointHeader::kDataOffset, engine.cells(), dataBytes);
+    if (!_file.sync(LifeCheckpointHeader::kDataOffset, dataBytes))
+        return (false);
+    h->committed = 1;
+    _revision = engine.revision();
+    return (_file.sync(0, sizeof(LifeCheckpointHeader)));
+}
+
+bool LifeCheckpoint::update(const LifeEngine& engine, bool async)
+{
+    LifeCheckpointHeader* h = header();
+    if (!h || h->width != engine.width() || h->height != engine.height())
+        return (false);
+
+    // A torn update leaves committed == 0 on disk, so restore refuses it.
+    if (h->committed)
+    {
+        h->committed = 0;
+        if (!_file.sync(0, sizeof(LifeCheckpointHeader)))
+            return (false);
+    }
+
+    uint64_t* data = reinterpret_cast<uint64_t*>(_file.mutableData() + LifeCheckpointHeader::kDataOffset);
+    const size_t stride = engine.stride();
+    size_t first = SIZE_MAX;
+    size_t last = 0;
+    for (uint32_t ty = 0; ty < engine.tilesY(); ++ty)
+    {
+        const uint32_t y0 = ty * LifeEngine::kTileRows;
+        const uint32_t y1 = std::min(y0 + LifeEngine::kTileRows, engine.height());
+        for (uint32_t tx = 0; tx < engine.tilesX(); ++tx)
+        {
+            if (engine.tileRevision(tx, ty) <= _revision)
+                continue;
+            for (uint32_t y = y0; y < y1; ++y)
+            {
+                // Only differing words dirty a page, so a tile that changed back costs nothing.
+                const size_t index = (size_t)(y + 1) * stride + 1 + tx;
+                const uint64_t word = engine.row((int32_t)y)[tx];
+                if (data[index] == word)
+                    continue;
+                data[index] = word;
+                first = std::min(first, index);
+                last = std::max(last, index);
+            }
+        }
+    }
+    fillHeader(engine);
+    _revision = engine.revision();
+    _pendingFirst = std::min(_pendingFirst, first);
+    _pendingLast = std::max(_pendingLast, last);
+    if (!async)
+        return (commit());
+    // Writeback starts now; the header stays uncommitted until commit() has the data on disk.
+    return (_pendingFirst > _pendingLast ||
+            _file.sync(LifeCheckpointHeader::kDataOffset + _pendingFirst * sizeof(uint64_t),
+                       (_pendingLast - _pendingFirst + 1) * sizeof(uint64_t), true));
+}
+
+bool LifeCheckpoint::commit()
+{
+    LifeCheckpointHeader* h = header();
+    if (!h)
+        return (false);
+    if (h->committed)
+        return (true);
+    // The data must be on disk before the header says so: the kernel orders neither msync.
+    if (_pendingFirst <= _pendingLast &&
+        !_file.sync(LifeCheckpointHeader::kDataOffset + _pendingFirst * sizeof(uint64_t),
+                    (_pendingLast - _pendingFirst + 1) * sizeof(uint64_t)))
+        return (false);
+    _pendingFirst = SIZE_MAX;
+    _pendingLast = 0;
+    h->committed = 1;
+    return (_file.sync(0, sizeof(LifeCheckpointHeader)));
+}
+
+bool LifeCheckpoint::readHeader(const char* path, LifeCheckpointHeader& header)
+{
+    FILE* file = fopen(path, "rb");
+    if (!file)
+        return (false);
+    const bool ok = fread(&header, sizeof(header), 1, file) == 1;
+    fclose(file);
+    return (ok && !memcmp(header.magic, kMagic, sizeof(kMagic)) &&
+            header.version == LifeCheckpointHeader::kVersion && header.committed == 1);
+}
+
+bool LifeCheckpoint::restore(const char* path, LifeEngine& engine)
+{
+    std::shared_ptr<MappedFile> file = std::make_shared<MappedFile>();
+    if (!file->open(path, MappedFile::Access::CopyOnWrite))
+        return (false);
+
+    LifeCheckpointHeader h;
+    if (file->size() < sizeof(h))
+        return (false);
+    memcpy(&h, file->data(), sizeof(h));
+    if (memcmp(h.magic, kMagic, sizeof(kMagic)) || h.version != LifeCheckpointHeader::kVersion || !h.committed)
+    {
+        printf("LifeCheckpoint: %s is not a complete checkpoint\n", path);
+        return (false);
+    }
+    if (h.width != engine.width() || h.height != engine.height() || h.stride != engine.stride() ||
+        file->size() < h.dataOffset + engine.cellWords() * sizeof(uint64_t))
+    {
+        printf("LifeCheckpoint: %s is %ux%u, the engine is %ux%u\n", path, h.width, h.height, engine.width(), engine.height());
+        return (false);
+    }
+
+    LifeRule rule = { h.birth, h.survive, h.states };
+    if (!engine.setRule(rule))
+        return (false);
+    engine.setTopology((JDLVTopology)h.topology, h.paddingState);
+    engine.setGeneration(h.generation);
+    engine.adoptCells(file, h.dataOffset);
+    return (true);
+}
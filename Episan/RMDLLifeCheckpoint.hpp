@@ -0,0 +1,85 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: RMDLLifeCheckpoint.hpp        +++     +++     **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 18/10/2026 09:12:26      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef RMDLLIFECHECKPOINT_HPP
+# define RMDLLIFECHECKPOINT_HPP
+
+# include <cstddef>
+# include <cstdint>
+# include <memory>
+
+# include "NonCopyable.h"
+# include "RMDLLifeEngine.hpp"
+# include "RMDLMappedFile.hpp"
+
+/// On-disk layout: this header, then at kDataOffset the LifeEngine buffer
+/// exactly as it sits in memory (stride words per row, halo rows included),
+/// so a restore maps the file instead of parsing it.
+struct LifeCheckpointHeader
+{
+    static constexpr uint32_t kVersion = 1;
+    /// Page aligned on both 4 KiB and 16 KiB page systems.
+    static constexpr uint32_t kDataOffset = 16384;
+
+    char        magic[8];       // "EPISCKPT"
+    uint32_t    version;
+    uint32_t    dataOffset;
+    uint32_t    width;
+    uint32_t    height;
+    uint32_t    topology;
+    uint32_t    paddingState;
+    uint16_t    birth;
+    uint16_t    survive;
+    uint32_t    states;
+    uint64_t    stride;         // words per stored row
+    uint64_t    rows;           // height + 2
+    uint64_t    generation;
+    uint32_t    committed;      // 0 while an update is in progress
+    uint32_t    reserved;
+};
+
+/// Keeps a checkpoint file mapped shared. update() copies only the tiles
+/// stamped since the last update, skips words that did not change, then
+/// msyncs the data before committing the header.
+class LifeCheckpoint : public NonCopyable
+{
+public:
+    LifeCheckpoint();
+    ~LifeCheckpoint();
+
+    /// Creates `path` with a full copy of `engine`.
+    bool        create(const char* path, const LifeEngine& engine);
+    /// Rewrites the tiles of `engine` that changed since the last create/update
+    /// and commits them. With `async` the data only starts its writeback and
+    /// the file stays uncommitted (restore refuses it) until commit().
+    bool        update(const LifeEngine& engine, bool async = false);
+    /// Syncs the data of pending async updates, then marks the file committed.
+    bool        commit();
+    /// Commits any pending async update first.
+    void        close();
+
+    uint64_t    generation() const  { return (_file.data() ? header()->generation : 0); }
+
+    static bool readHeader(const char* path, LifeCheckpointHeader& header);
+    /// Maps `path` copy-on-write as the current buffer of `engine`, which
+    /// must have the checkpoint's size. Rule, topology and generation follow the file.
+    static bool restore(const char* path, LifeEngine& engine);
+
+private:
+    LifeCheckpointHeader*   header() const { return reinterpret_cast<LifeCheckpointHeader*>(_file.mutableData()); }
+    void                    fillHeader(const LifeEngine& engine);
+
+    MappedFile  _file;
+    uint64_t    _revision;      // engine revision the file matches
+    size_t      _pendingFirst;  // data words written since the last commit, SIZE_MAX: none
+    size_t      _pendingLast;
+};
+
+#endif /* RMDLLIFECHECKPOINT_HPP */
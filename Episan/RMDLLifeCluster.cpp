@@ -0,0 +1,807 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: RMDLLifeCluster.cpp           +++     +++     **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 20/10/2026 09:14:58      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "RMDLLifeCluster.hpp"
+#include "RMDLLifeEngine.hpp"
+#include "RMDLLifeTopology.hpp"
+
+#if defined(MSG_NOSIGNAL)
+# define RMDL_SEND_FLAGS MSG_NOSIGNAL
+#else
+# define RMDL_SEND_FLAGS 0
+#endif
+
+namespace
+{
+
+enum class Message : uint32_t
+{
+    Hello = 1,      // worker -> driver: its listening address
+    Setup,          // driver -> worker: SetupMessage, down address, band rows
+    Ready,          // worker -> driver: linked to its neighbours
+    Step,           // driver -> worker: value generations
+    Done,           // worker -> driver: value band population
+    Gather,         // driver -> worker
+    Band,           // worker -> driver: band rows
+    Quit
+};
+
+struct Header
+{
+    uint32_t    type;
+    uint32_t    reserved;
+    uint64_t    value;
+    uint64_t    bytes;      // payload that follows
+};
+
+struct SetupMessage
+{
+    uint32_t    rank;
+    uint32_t    workers;
+    JDLVState   state;
+    uint32_t    birth;
+    uint32_t    survive;
+    uint32_t    haloDepth;
+    uint32_t    y0;
+    uint32_t    rows;
+    uint32_t    hasUp;              // accept a link from the band above
+    uint32_t    downAddressLength;  // 0: nobody below
+    uint32_t    reserved;
+    uint64_t    generation;
+};
+
+// "tcp:host:port" or "unix:/path".
+struct Address
+{
+    bool        local;
+    std::string host;
+    std::string port;
+    std::string path;
+};
+
+bool parseAddress(const std::string& text, Address& address)
+{
+    if (text.compare(0, 5, "unix:") == 0 && text.size() > 5)
+    {
+        address.local = true;
+        address.path = text.substr(5);
+        return (address.path.size() < sizeof(sockaddr_un::sun_path));
+    }
+    const size_t colon = text.rfind(':');
+    if (text.compare(0, 4, "tcp:") == 0 && colon != std::string::npos && colon > 4)
+    {
+        address.local = false;
+        address.host = text.substr(4, colon - 4);
+        address.port = text.substr(colon + 1);
+        return (!address.port.empty());
+    }
+    printf("LifeCluster: bad address %s (tcp:host:port or unix:/path)\n", text.c_str());
+    return (false);
+}
+
+void configure(int fd, bool tcp)
+{
+    if (tcp)
+    {
+        // Halo strips are small and latency bound.
+        int one = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    }
+#if defined(SO_NOSIGPIPE)
+    int one = 1;
+    setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &one, sizeof(one));
+#endif
+}
+
+// Binds and listens; `bound` gets the address with the port actually picked.
+int openListener(const Address& address, std::string& bound)
+{
+    if (address.local)
+    {
+        const int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        sockaddr_un addr = {};
+        addr.sun_family = AF_UNIX;
+        strncpy(addr.sun_path, address.path.c_str(), sizeof(addr.sun_path) - 1);
+        unlink(address.path.c_str());
+        if (fd < 0 || bind(fd, (const sockaddr*)&addr, sizeof(addr)) != 0 || ::listen(fd, 64) != 0)
+        {
+            printf("LifeCluster: cannot listen on unix:%s: %s\n", address.path.c_str(), strerror(errno));
+            if (fd >= 0)
+                close(fd);
+            return (-1);
+        }
+        bound = "unix:" + address.path;
+        return (fd);
+    }
+
+    addrinfo hints = {};
+    hints.ai_family = AF_INET;
+    hints.ai_socktype = SOCK_STREAM;
+    hints.ai_flags = AI_PASSIVE;
+    addrinfo* info = nullptr;
+    if (getaddrinfo(address.host.empty() ? nullptr : address.host.c_str(), address.port.c_str(), &hints, &info) != 0)
+    {
+        printf("LifeCluster: cannot resolve %s\n", address.host.c_str());
+        return (-1);
+    }
+    const int fd = socket(info->ai_family, info->ai_socktype, info->ai_protocol);
+    int one = 1;
+    if (fd >= 0)
+        setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    if (fd < 0 || bind(fd, info->ai_addr, info->ai_addrlen) != 0 || ::listen(fd, 64) != 0)
+    {
+        printf("LifeCluster: cannot listen on tcp:%s:%s: %s\n", address.host.c_str(), address.port.c_str(), strerror(errno));
+        freeaddrinfo(info);
+        if (fd >= 0)
+            close(fd);
+        return (-1);
+    }
+    freeaddrinfo(info);
+
+    sockaddr_in addr = {};
+    socklen_t length = sizeof(addr);
+    getsockname(fd, (sockaddr*)&addr, &length);
+    char host[INET_ADDRSTRLEN];
+    inet_ntop(AF_INET, &addr.sin_addr, host, sizeof(host));
+    bound = std::string("tcp:") + host + ":" + std::to_string(ntohs(addr.sin_port));
+    return (fd);
+}
+
+int connectTo(const std::string& text)
+{
+    Address address;
+    if (!parseAddress(text, address))
+        return (-1);
+    if (address.local)
+    {
+        const int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        sockaddr_un addr = {};
+        addr.sun_family = AF_UNIX;
+        strncpy(addr.sun_path, address.path.c_str(), sizeof(addr.sun_path) - 1);
+        if (fd < 0 || connect(fd, (const sockaddr*)&addr, sizeof(addr)) != 0)
+        {
+            printf("LifeCluster: cannot connect to %s: %s\n", text.c_str(), strerror(errno));
+            if (fd >= 0)
+                close(fd);
+            return (-1);
+        }
+        configure(fd, false);
+        return (fd);
+    }
+
+    addrinfo hints = {};
+    hints.ai_family = AF_INET;
+    hints.ai_socktype = SOCK_STREAM;
+    addrinfo* info = nullptr;
+    if (getaddrinfo(address.host.c_str(), address.port.c_str(), &hints, &info) != 0)
+    {
+        printf("LifeCluster: cannot resolve %s\n", text.c_str());
+        return (-1);
+    }
+    const int fd = socket(info->ai_family, info->ai_socktype, info->ai_protocol);
+    if (fd < 0 || connect(fd, info->ai_addr, info->ai_addrlen) != 0)
+    {
+        printf("LifeCluster: cannot connect to %s: %s\n", text.c_str(), strerror(errno));
+        freeaddrinfo(info);
+        if (fd >= 0)
+            close(fd);
+        return (-1);
+    }
+    freeaddrinfo(info);
+    configure(fd, true);
+    return (fd);
+}
+
+int acceptOn(int listener)
+{
+    int fd;
+    do
+        fd = accept(listener, nullptr, nullptr);
+    while (fd < 0 && errno == EINTR);
+    if (fd < 0)
+    {
+        printf("LifeCluster: accept failed: %s\n", strerror(errno));
+        return (-1);
+    }
+    sockaddr_storage addr;
+    socklen_t length = sizeof(addr);
+    getsockname(fd, (sockaddr*)&addr, &length);
+    configure(fd, addr.ss_family != AF_UNIX);
+    return (fd);
+}
+
+bool sendAll(int fd, const void* data, size_t bytes)
+{
+    const uint8_t* p = static_cast<const uint8_t*>(data);
+    while (bytes)
+    {
+        const ssize_t n = send(fd, p, bytes, RMDL_SEND_FLAGS);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            return (false);
+        p += n;
+        bytes -= (size_t)n;
+    }
+    return (true);
+}
+
+bool recvAll(int fd, void* data, size_t bytes)
+{
+    uint8_t* p = static_cast<uint8_t*>(data);
+    while (bytes)
+    {
+        const ssize_t n = recv(fd, p, bytes, 0);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            return (false);
+        p += n;
+        bytes -= (size_t)n;
+    }
+    return (true);
+}
+
+bool sendMessage(int fd, Message type, uint64_t value, const void* payload = nullptr, size_t bytes = 0)
+{
+    const Header header = { (uint32_t)type, 0, value, bytes };
+    return (sendAll(fd, &header, sizeof(header)) && (!bytes || sendAll(fd, payload, bytes)));
+}
+
+// A payload of another type or a closed socket is reported and fails.
+bool recvMessage(int fd, Message expected, Header& header, std::vector<uint8_t>& payload)
+{
+    if (!recvAll(fd, &header, sizeof(header)))
+    {
+        printf("LifeCluster: connection lost waiting for message %u\n", (uint32_t)expected);
+        return (false);
+    }
+    if (header.type != (uint32_t)expected)
+    {
+        printf("LifeCluster: got message %u, expected %u\n", header.type, (uint32_t)expected);
+        return (false);
+    }
+    payload.resize(header.bytes);
+    return (!header.bytes || recvAll(fd, payload.data(), payload.size()));
+}
+
+void closeListener(int fd, const std::string& address)
+{
+    if (fd < 0)
+        return;
+    close(fd);
+    if (address.compare(0, 5, "unix:") == 0)
+        unlink(address.c_str() + 5);
+}
+
+void packRows(const LifeEngine& engine, uint32_t y0, uint32_t rows, uint64_t* out)
+{
+    const size_t words = engine.wordsPerRow();
+    for (uint32_t y = 0; y < rows; ++y, out += words)
+    {
+        std::copy(engine.row((int32_t)(y0 + y)), engine.row((int32_t)(y0 + y)) + words, out);
+        out[words - 1] &= engine.lastWordMask();
+    }
+}
+
+// One neighbour link in non-blocking mode: the outgoing strip drains and the
+// incoming one fills whenever progress() gets to run.
+struct HaloLink
+{
+    int                     fd = -1;
+    std::vector<uint8_t>    out;
+    size_t                  sent = 0;
+    std::vector<uint8_t>    in;
+    size_t                  received = 0;
+
+    bool    busy() const    { return (fd >= 0 && (sent < out.size() || received < in.size())); }
+
+    void    post(uint64_t generation, const uint64_t* rows, size_t words)
+    {
+        out.resize(sizeof(uint64_t) + words * sizeof(uint64_t));
+        memcpy(out.data(), &generation, sizeof(generation));
+        memcpy(out.data() + sizeof(generation), rows, words * sizeof(uint64_t));
+        sent = 0;
+        in.resize(out.size());
+        received = 0;
+    }
+
+    bool    pump()
+    {
+        while (sent < out.size())
+        {
+            const ssize_t n = send(fd, out.data() + sent, out.size() - sent, RMDL_SEND_FLAGS);
+            if (n > 0)
+                sent += (size_t)n;
+            else if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+                break;
+            else if (!(n < 0 && errno == EINTR))
+                return (false);
+        }
+        while (received < in.size())
+        {
+            const ssize_t n = recv(fd, in.data() + received, in.size() - received, 0);
+            if (n > 0)
+                received += (size_t)n;
+            else if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+                break;
+            else if (!(n < 0 && errno == EINTR))
+                return (false);
+        }
+        return (true);
+    }
+
+    /// The strip that came in, after checking it is for `generation`.
+    const uint64_t* rows(uint64_t generation) const
+    {
+        uint64_t stamp;
+        memcpy(&stamp, in.data(), sizeof(stamp));
+        if (stamp != generation)
+        {
+            printf("LifeCluster: halo for generation %llu, expected %llu\n",
+                   (unsigned long long)stamp, (unsigned long long)generation);
+            return (nullptr);
+        }
+        return (reinterpret_cast<const uint64_t*>(in.data() + sizeof(uint64_t)));
+    }
+};
+
+// Moves both links along; with `wait`, blocks until one of them can.
+bool progress(HaloLink& up, HaloLink& down, bool wait)
+{
+    if (!up.pump() || !down.pump())
+    {
+        printf("LifeCluster: halo link lost: %s\n", strerror(errno));
+        return (false);
+    }
+    if (!wait || (!up.busy() && !down.busy()))
+        return (true);
+    pollfd fds[2];
+    nfds_t count = 0;
+    for (HaloLink* link : { &up, &down })
+    {
+        if (!link->busy())
+            continue;
+        fds[count].fd = link->fd;
+        fds[count].events = (short)((link->sent < link->out.size() ? POLLOUT : 0) | (link->received < link->in.size() ? POLLIN : 0));
+        fds[count].revents = 0;
+        ++count;
+    }
+    if (poll(fds, count, -1) < 0 && errno != EINTR)
+        return (false);
+    return (true);
+}
+
+class BandWorker
+{
+public:
+    BandWorker(int control) : _control(control), _generation(0) {}
+    ~BandWorker()
+    {
+        for (int fd : { _up.fd, _down.fd })
+            if (fd >= 0)
+                close(fd);
+    }
+
+    bool    setup(const SetupMessage& setup, const std::string& downAddress, const uint8_t* rows, int listener);
+    bool    step(uint64_t generations);
+    const LifeEngine& band() const  { return (*_band); }
+
+private:
+    bool    block(uint32_t k);
+    void    stepStrip(std::unique_ptr<LifeEngine>& strip, uint32_t height, uint32_t k,
+                      const uint64_t* above, const uint64_t* below, bool mirrorAbove, bool mirrorBelow,
+                      uint32_t ownFirst, uint32_t validFirst);
+
+    int                         _control;
+    SetupMessage                _setup;
+    JDLVState                   _local;         // the band's own engines
+    std::unique_ptr<LifeEngine> _band;
+    std::unique_ptr<LifeEngine> _top;
+    std::unique_ptr<LifeEngine> _bottom;
+    HaloLink                    _up;
+    HaloLink                    _down;
+    std::vector<uint64_t>       _strip;
+    uint64_t                    _generation;
+};
+
+bool BandWorker::setup(const SetupMessage& setup, const std::string& downAddress, const uint8_t* rows, int listener)
+{
+    _setup = setup;
+    _generation = setup.generation;
+    // One worker keeps the whole topology; otherwise y is the cluster's business and only x wraps locally.
+    _local = { setup.state.width, setup.rows, setup.state.topology, setup.state.paddingState };
+    if (setup.workers > 1 && (setup.state.topology == JDLVTopologyTorus || setup.state.topology == JDLVTopologyKleinBottle))
+        _local.topology = JDLVTopologyTorus;
+    _band.reset(new LifeEngine(_local));
+    _band->setRule({ (uint16_t)setup.birth, (uint16_t)setup.survive, 2 });
+    _band->writeRows(0, setup.rows, reinterpret_cast<const uint64_t*>(rows), _band->wordsPerRow());
+    _band->setGeneration(_generation);
+
+    if (setup.workers == 1)
+        return (true);
+    // Everybody dials first and accepts second: connects complete in the backlog, so no one waits on a ring.
+    if (setup.downAddressLength && (_down.fd = connectTo(downAddress)) < 0)
+        return (false);
+    if (setup.hasUp && (_up.fd = acceptOn(listener)) < 0)
+        return (false);
+    for (int fd : { _up.fd, _down.fd })
+        if (fd >= 0)
+            fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+    return (true);
+}
+
+// Steps an edge strip k generations: `height` rows, the halo strips (when
+// given) k rows each around 2k rows of the band from `ownFirst`. Rows
+// validFirst .. validFirst + k are then right and land at the start of _strip.
+void BandWorker::stepStrip(std::unique_ptr<LifeEngine>& strip, uint32_t height, uint32_t k,
+                           const uint64_t* above, const uint64_t* below, bool mirrorAbove, bool mirrorBelow,
+                           uint32_t ownFirst, uint32_t validFirst)
+{
+    const size_t words = _band->wordsPerRow();
+    if (!strip || strip->height() != height)
+        strip.reset(new LifeEngine({ _local.width, height, _local.topology, _local.paddingState }));
+    strip->setRule(_band->rule());
+
+    _strip.resize(words * height);
+    uint64_t* out = _strip.data();
+    auto halo = [&](const uint64_t* rows, bool mirror)
+    {
+        for (uint32_t y = 0; y < k; ++y, out += words, rows += words)
+        {
+            if (mirror)
+                life_topology::mirrorRow(rows, out, words, _local.width);
+            else
+                std::copy(rows, rows + words, out);
+        }
+    };
+    if (above)
+        halo(above, mirrorAbove);
+    packRows(*_band, ownFirst, 2 * k, out);
+    out += 2 * k * words;
+    if (below)
+        halo(below, mirrorBelow);
+
+    strip->writeRows(0, height, _strip.data(), words);
+    strip->step(k);
+    packRows(*strip, validFirst, k, _strip.data());
+}
+
+bool BandWorker::block(uint32_t k)
+{
+    const size_t words = _band->wordsPerRow();
+    const uint32_t rows = _setup.rows;
+    const bool hasUp = _up.fd >= 0, hasDown = _down.fd >= 0;
+
+    // Post the edge rows, then step the interior while they drain.
+    std::vector<uint64_t> edge(words * k);
+    if (hasUp)
+    {
+        packRows(*_band, 0, k, edge.data());
+        _up.post(_generation, edge.data(), edge.size());
+    }
+    if (hasDown)
+    {
+        packRows(*_band, rows - k, k, edge.data());
+        _down.post(_generation, edge.data(), edge.size());
+    }
+    // The edge strips need the band as it is now.
+    std::vector<uint64_t> topRows(words * 2 * k), bottomRows(words * 2 * k);
+    packRows(*_band, 0, 2 * k, topRows.data());
+    packRows(*_band, rows - 2 * k, 2 * k, bottomRows.data());
+
+    for (uint32_t g = 0; g < k; ++g)
+    {
+        if (!progress(_up, _down, false))
+            return (false);
+        _band->step();
+    }
+    while (_up.busy() || _down.busy())
+        if (!progress(_up, _down, true))
+            return (false);
+
+    const uint64_t* above = hasUp ? _up.rows(_generation) : nullptr;
+    const uint64_t* below = hasDown ? _down.rows(_generation) : nullptr;
+    if ((hasUp && !above) || (hasDown && !below))
+        return (false);
+
+    // Rows k .. rows - k are right now; the strips start from the edges as they were.
+    const uint64_t generation = _band->generation();
+    std::vector<uint64_t> interior(words * rows);
+    packRows(*_band, 0, rows, interior.data());
+    _band->writeRows(0, 2 * k, topRows.data(), words);
+    _band->writeRows(rows - 2 * k, 2 * k, bottomRows.data(), words);
+    const bool klein = _setup.state.topology == JDLVTopologyKleinBottle;
+    stepStrip(_top, (hasUp ? 3 : 2) * k, k, above, nullptr, klein && _setup.rank == 0, false, 0, hasUp ? k : 0);
+    std::copy(_strip.begin(), _strip.begin() + words * k, interior.begin());
+    stepStrip(_bottom, (hasDown ? 3 : 2) * k, k, nullptr, below, false, klein && _setup.rank + 1 == _setup.workers,
+              rows - 2 * k, k);
+    std::copy(_strip.begin(), _strip.begin() + words * k, interior.begin() + words * (rows - k));
+    _band->writeRows(0, rows, interior.data(), words);
+    _band->setGeneration(generation);
+    _generation = generation;
+    return (true);
+}
+
+bool BandWorker::step(uint64_t generations)
+{
+    if (_setup.workers == 1)
+    {
+        _band->step(generations);
+        _generation = _band->generation();
+        return (true);
+    }
+    while (generations)
+    {
+        const uint32_t k = (uint32_t)std::min<uint64_t>(_setup.haloDepth, generations);
+        if (!block(k))
+            return (false);
+        generations -= k;
+    }
+    return (true);
+}
+
+}
+
+LifeCluster::LifeCluster()
+    : _state{ 0, 0, 0, 0 }
+    , _listener(-1)
+    , _haloDepth(1)
+    , _generation(0)
+    , _population(0)
+{
+}
+
+LifeCluster::~LifeCluster()
+{
+    shutdown();
+}
+
+bool LifeCluster::listen(const std::string& address)
+{
+    Address parsed;
+    if (!parseAddress(address, parsed))
+        return (false);
+    closeListener(_listener, _address);
+    _listener = openListener(parsed, _address);
+    return (_listener >= 0);
+}
+
+bool LifeCluster::start(uint32_t workers, const JDLVState& state, const LifeRule& rule,
+                        uint32_t haloDepth, const uint32_t* grid)
+{
+    if (_listener < 0 || workers == 0 || !rule.isTwoState())
+    {
+        printf("LifeCluster: start needs a listening driver, workers and a two-state rule\n");
+        return (false);
+    }
+    if (state.height < 2 * workers)
+    {
+        printf("LifeCluster: %u rows cannot give %u workers two rows each\n", state.height, workers);
+        return (false);
+    }
+    _state = state;
+    _generation = 0;
+
+    // Workers take ranks in the order they connect.
+    std::vector<std::string> listening;
+    Header header;
+    std::vector<uint8_t> payload;
+    while (_workers.size() < workers)
+    {
+        const int fd = acceptOn(_listener);
+        if (fd < 0 || !recvMessage(fd, Message::Hello, header, payload))
+        {
+            if (fd >= 0)
+                close(fd);
+            return (false);
+        }
+        _workers.push_back(fd);
+        listening.emplace_back(payload.begin(), payload.end());
+    }
+
+    _bandStart.resize(workers + 1);
+    uint32_t smallest = state.height;
+    for (uint32_t r = 0; r <= workers; ++r)
+        _bandStart[r] = (uint32_t)((uint64_t)state.height * r / workers);
+    for (uint32_t r = 0; r < workers; ++r)
+        smallest = std::min(smallest, _bandStart[r + 1] - _bandStart[r]);
+    _haloDepth = std::max<uint32_t>(1, std::min(haloDepth, smallest / 2));
+
+    // A scratch engine packs the rows the way the workers hold them.
+    LifeEngine packer(state);
+    packer.importGrid(grid);
+    const bool ring = state.topology == JDLVTopologyTorus || state.topology == JDLVTopologyKleinBottle;
+    for (uint32_t r = 0; r < workers; ++r)
+    {
+        const bool hasDown = workers > 1 && (ring || r + 1 < workers);
+        const std::string down = hasDown ? listening[(r + 1) % workers] : std::string();
+        SetupMessage setup = {};
+        setup.rank = r;
+        setup.workers = workers;
+        setup.state = state;
+        setup.birth = rule.birth;
+        setup.survive = rule.survive;
+        setup.haloDepth = _haloDepth;
+        setup.y0 = _bandStart[r];
+        setup.rows = _bandStart[r + 1] - _bandStart[r];
+        setup.hasUp = workers > 1 && (ring || r > 0);
+        setup.downAddressLength = (uint32_t)down.size();
+        setup.generation = 0;
+
+        std::vector<uint8_t> message(sizeof(setup) + down.size() + (size_t)setup.rows * packer.wordsPerRow() * sizeof(uint64_t));
+        memcpy(message.data(), &setup, sizeof(setup));
+        memcpy(message.data() + sizeof(setup), down.data(), down.size());
+        packRows(packer, setup.y0, setup.rows, reinterpret_cast<uint64_t*>(message.data() + sizeof(setup) + down.size()));
+        if (!sendMessage(_workers[r], Message::Setup, 0, message.data(), message.size()))
+        {
+            printf("LifeCluster: cannot set worker %u up\n", r);
+            return (false);
+        }
+    }
+    for (int fd : _workers)
+        if (!recvMessage(fd, Message::Ready, header, payload))
+            return (false);
+    _population = packer.population();
+    return (true);
+}
+
+bool LifeCluster::step(uint64_t generations)
+{
+    for (int fd : _workers)
+        if (!sendMessage(fd, Message::Step, generations))
+            return (false);
+    Header header;
+    std::vector<uint8_t> payload;
+    uint64_t population = 0;
+    for (int fd : _workers)
+    {
+        if (!recvMessage(fd, Message::Done, header, payload))
+            return (false);
+        population += header.value;
+    }
+    _population = population;
+    _generation += generations;
+    return (true);
+}
+
+bool LifeCluster::gather(uint32_t* grid)
+{
+    const size_t words = (_state.width + 63) / 64;
+    Header header;
+    std::vector<uint8_t> payload;
+    for (size_t r = 0; r < _workers.size(); ++r)
+    {
+        if (!sendMessage(_workers[r], Message::Gather, 0) || !recvMessage(_workers[r], Message::Band, header, payload))
+            return (false);
+        const uint32_t rows = _bandStart[r + 1] - _bandStart[r];
+        if (payload.size() != rows * words * sizeof(uint64_t))
+        {
+            printf("LifeCluster: worker %zu sent %zu bytes for %u rows\n", r, payload.size(), rows);
+            return (false);
+        }
+        const uint64_t* bits = reinterpret_cast<const uint64_t*>(payload.data());
+        for (uint32_t y = 0; y < rows; ++y, bits += words)
+        {
+            uint32_t* out = grid + (size_t)(_bandStart[r] + y) * _state.width;
+            for (uint32_t x = 0; x < _state.width; ++x)
+                out[x] = (bits[x >> 6] >> (x & 63)) & 1;
+        }
+    }
+    return (true);
+}
+
+void LifeCluster::shutdown()
+{
+    for (int fd : _workers)
+    {
+        sendMessage(fd, Message::Quit, 0);
+        close(fd);
+    }
+    _workers.clear();
+    closeListener(_listener, _address);
+    _listener = -1;
+}
+
+bool LifeClusterWorker::run(const std::string& address)
+{
+    const int control = connectTo(address);
+    if (control < 0)
+        return (false);
+
+    // Neighbours reach this worker the way it reached the driver: same interface, or a sibling socket file.
+    Address own;
+    parseAddress(address, own);
+    if (own.local)
+        own.path += "." + std::to_string(getpid());
+    else
+    {
+        sockaddr_in addr = {};
+        socklen_t length = sizeof(addr);
+        getsockname(control, (sockaddr*)&addr, &length);
+        char host[INET_ADDRSTRLEN];
+        inet_ntop(AF_INET, &addr.sin_addr, host, sizeof(host));
+        own.host = host;
+        own.port = "0";
+    }
+    std::string listening;
+    const int listener = openListener(own, listening);
+    if (listener < 0 || !sendMessage(control, Message::Hello, 0, listening.data(), listening.size()))
+    {
+        closeListener(listener, listening);
+        close(control);
+        return (false);
+    }
+
+    Header header;
+    std::vector<uint8_t> payload;
+    SetupMessage setup;
+    BandWorker worker(control);
+    bool ok = recvMessage(control, Message::Setup, header, payload) && payload.size() >= sizeof(setup);
+    if (ok)
+    {
+        memcpy(&setup, payload.data(), sizeof(setup));
+        const size_t rowBytes = (size_t)setup.rows * ((setup.state.width + 63) / 64) * sizeof(uint64_t);
+        ok = payload.size() == sizeof(setup) + setup.downAddressLength + rowBytes;
+        if (!ok)
+            printf("LifeCluster: malformed setup for worker %u\n", setup.rank);
+    }
+    if (ok)
+    {
+        const std::string down(payload.begin() + sizeof(setup), payload.begin() + sizeof(setup) + setup.downAddressLength);
+        ok = worker.setup(setup, down, payload.data() + sizeof(setup) + setup.downAddressLength, listener)
+             && sendMessage(control, Message::Ready, 0);
+    }
+    closeListener(listener, listening);
+
+    while (ok)
+    {
+        if (!recvAll(control, &header, sizeof(header)))
+        {
+            printf("LifeCluster: worker %u lost the driver\n", setup.rank);
+            ok = false;
+            break;
+        }
+        if (header.type == (uint32_t)Message::Quit)
+            break;
+        if (header.type == (uint32_t)Message::Step)
+            ok = worker.step(header.value) && sendMessage(control, Message::Done, worker.band().population());
+        else if (header.type == (uint32_t)Message::Gather)
+        {
+            std::vector<uint64_t> rows(worker.band().wordsPerRow() * setup.rows);
+            packRows(worker.band(), 0, setup.rows, rows.data());
+            ok = sendMessage(control, Message::Band, 0, rows.data(), rows.size() * sizeof(uint64_t));
+        }
+        else
+        {
+            printf("LifeCluster: worker %u got unexpected message %u\n", setup.rank, header.type);
+            ok = false;
+        }
+    }
+    close(control);
+    return (ok);
+}
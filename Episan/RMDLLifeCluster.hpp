@@ -0,0 +1,83 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: RMDLLifeCluster.hpp           +++     +++     **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 20/10/2026 09:14:52      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef RMDLLIFECLUSTER_HPP
+# define RMDLLIFECLUSTER_HPP
+
+# include <cstdint>
+# include <string>
+# include <vector>
+
+# include "JDLV_shared.h"
+# include "NonCopyable.h"
+# include "RMDLLifeRule.hpp"
+
+/// A JDLV board cut into horizontal bands, one per worker process, stepped
+/// together over sockets. Addresses are "tcp:host:port" (port 0 picks a
+/// free one) or "unix:/path".
+///
+/// The driver listens, workers connect to it and then to their neighbours:
+/// each worker dials the one below and accepts the one above, wrapping
+/// round on the torus and Klein bottle (mirrored there), while the plane
+/// and padded edges stay local. Every exchange trades k-row halo strips
+/// (temporal blocking): a worker posts its top and bottom k rows on
+/// non-blocking sockets, steps its band k generations while they drain
+/// (rows k .. height - k do not need the halo), then steps two 3k-row
+/// edge strips with the received halos, whose middle k rows replace its
+/// first and last k. One round trip per k generations, at the cost of
+/// recomputing 4k rows.
+/// Every process runs the same build: messages are native structs.
+class LifeCluster : public NonCopyable
+{
+public:
+    LifeCluster();
+    ~LifeCluster();
+
+    /// Binds the driver's socket; address() then says where workers connect.
+    bool                listen(const std::string& address);
+    const std::string&  address() const     { return _address; }
+    /// Waits for `workers` workers, gives each a band of `grid` (JDLV layout)
+    /// and returns once they are all linked. Two-state rules only; every band
+    /// is at least 2 rows, and k is capped at half the smallest band.
+    bool                start(uint32_t workers, const JDLVState& state, const LifeRule& rule,
+                              uint32_t haloDepth, const uint32_t* grid);
+
+    uint32_t            workers() const     { return (uint32_t)_workers.size(); }
+    uint32_t            haloDepth() const   { return _haloDepth; }
+    uint64_t            generation() const  { return _generation; }
+    /// Live cells as of the last step(), summed over the bands.
+    uint64_t            population() const  { return _population; }
+
+    bool                step(uint64_t generations);
+    /// Collects every band into `grid`, width * height cells.
+    bool                gather(uint32_t* grid);
+    /// Tells the workers to exit and closes every socket.
+    void                shutdown();
+
+private:
+    JDLVState               _state;
+    std::string             _address;
+    int                     _listener;
+    std::vector<int>        _workers;       // control socket per rank
+    std::vector<uint32_t>   _bandStart;     // first row per rank, then the height
+    uint32_t                _haloDepth;
+    uint64_t                _generation;
+    uint64_t                _population;
+};
+
+/// The worker side: serves one driver until it shuts down.
+class LifeClusterWorker : public NonCopyable
+{
+public:
+    /// Connects to the driver at `address`. False on a socket or protocol error.
+    static bool run(const std::string& address);
+};
+
+#endif /* RMDLLIFECLUSTER_HPP */
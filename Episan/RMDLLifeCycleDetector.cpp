@@ -0,0 +1,158 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: RMDLLifeCycleDetector.cpp       +++     +++   **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 18/10/2026 16:02:25      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include <algorithm>
+
+#include "RMDLLifeCycleDetector.hpp"
+
+LifeCycleDetector::LifeCycleDetector(uint32_t historySize)
+    : _boardHash(0)
+    , _population(0)
+    , _engine(nullptr)
+    , _engineRevision(0)
+    , _history(std::max<uint32_t>(1, historySize))
+    , _next(0)
+    , _count(0)
+    , _state(State::Running)
+    , _period(0)
+    , _detectedAt(0)
+{
+}
+
+void LifeCycleDetector::reset()
+{
+    _next = 0;
+    _count = 0;
+    _state = State::Running;
+    _period = 0;
+    _detectedAt = 0;
+}
+
+uint64_t LifeCycleDetector::wordKey(uint64_t position, uint64_t word)
+{
+    if (!word)
+        return (0);
+    // Two rounds of the SplitMix64 finaliser over the word and its position.
+    uint64_t z = word ^ (position * 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    z ^= z >> 31;
+    z = (z + position) * 0xBF58476D1CE4E5B9ull;
+    return (z ^ (z >> 29));
+}
+
+uint64_t LifeCycleDetector::hash(const LifeEngine& engine)
+{
+    const uint32_t tilesX = engine.tilesX();
+    const uint32_t tilesY = engine.tilesY();
+    const size_t tiles = (size_t)tilesX * tilesY;
+
+    // Another engine, a resized one, or one whose revisions went backwards: start from scratch.
+    bool rehashAll = false;
+    if (&engine != _engine || _tileHash.size() != tiles || engine.revision() < _engineRevision)
+    {
+        _engine = &engine;
+        _tileHash.assign(tiles, 0);
+        _tileWords.assign(tiles, 0);
+        _tileHashed.assign(tiles, 0);
+        _boardHash = 0;
+        _population = 0;
+        rehashAll = true;
+    }
+    else if (engine.revision() == _engineRevision)
+        return (_boardHash);
+
+    const size_t last = engine.wordsPerRow() - 1;
+    for (uint32_t ty = 0; ty < tilesY; ++ty)
+    {
+        const uint32_t y0 = ty * LifeEngine::kTileRows;
+        const uint32_t y1 = std::min(y0 + LifeEngine::kTileRows, engine.height());
+        for (uint32_t tx = 0; tx < tilesX; ++tx)
+        {
+            const size_t tile = (size_t)ty * tilesX + tx;
+            const uint64_t stamp = engine.tileRevision(tx, ty);
+            if (!rehashAll && stamp <= _tileHashed[tile])
+                continue;
+
+            const uint64_t mask = tx == last ? engine.lastWordMask() : ~0ull;
+            uint64_t tileHash = 0;
+            uint64_t words = 0;
+            for (uint32_t y = y0; y < y1; ++y)
+            {
+                const uint64_t word = engine.row((int32_t)y)[tx] & mask;
+                tileHash ^= wordKey((uint64_t)y * (last + 1) + tx, word);
+                words += word != 0;
+            }
+            _boardHash ^= _tileHash[tile] ^ tileHash;
+            _population += words - _tileWords[tile];
+            _tileHash[tile] = tileHash;
+            _tileWords[tile] = words;
+            _tileHashed[tile] = engine.revision();
+        }
+    }
+    _engineRevision = engine.revision();
+    return (_boardHash);
+}
+
+LifeCycleDetector::State LifeCycleDetector::observe(const LifeEngine& engine)
+{
+    const uint64_t boardHash = hash(engine);
+    const uint64_t generation = engine.generation();
+
+    if (_state != State::Running)
+        return (_state);
+    if (_population == 0)
+    {
+        _state = State::Extinct;
+        _period = 1;
+        _detectedAt = generation;
+        return (_state);
+    }
+
+    const uint32_t size = (uint32_t)_history.size();
+    for (uint32_t i = 1; i <= _count; ++i)
+    {
+        const Entry& entry = _history[(_next + size - i) % size];
+        if (entry.hash == boardHash && entry.generation < generation)
+        {
+            _period = (uint32_t)(generation - entry.generation);
+            _state = _period == 1 ? State::StillLife : State::Oscillating;
+            _detectedAt = generation;
+            return (_state);
+        }
+    }
+    _history[_next] = { boardHash, generation };
+    _next = (_next + 1) % size;
+    _count = std::min(_count + 1, size);
+    return (_state);
+}
+
+uint64_t LifeCycleDetector::run(LifeEngine& engine, uint64_t generations)
+{
+    const uint64_t target = engine.generation() + generations;
+    uint64_t stepped = 0;
+
+    observe(engine);
+    while (engine.generation() < target && _state == State::Running)
+    {
+        engine.step();
+        ++stepped;
+        observe(engine);
+    }
+    if (engine.generation() < target)
+    {
+        // The board repeats every _period generations from here on.
+        const uint64_t remainder = (target - engine.generation()) % std::max<uint32_t>(1, _period);
+        engine.step(remainder);
+        stepped += remainder;
+        engine.setGeneration(target);
+    }
+    return (stepped);
+}
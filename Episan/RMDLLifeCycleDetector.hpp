@@ -0,0 +1,84 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: RMDLLifeCycleDetector.hpp       +++     +++   **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 18/10/2026 16:02:18      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef RMDLLIFECYCLEDETECTOR_HPP
+# define RMDLLIFECYCLEDETECTOR_HPP
+
+# include <cstdint>
+# include <vector>
+
+# include "RMDLLifeEngine.hpp"
+
+/// Notices when a LifeEngine board dies out, settles or starts repeating.
+/// The board hash is Zobrist-style: the XOR over every non-empty word of a
+/// key mixed from the word and its position. It is kept per 64x64 tile and
+/// only the tiles the engine stamped since the last look are rehashed, so a
+/// settling soup costs next to nothing. The last historySize() hashes are
+/// kept to spot cycles of up to that period.
+class LifeCycleDetector : public NonCopyable
+{
+public:
+    enum class State
+    {
+        Running,
+        Extinct,        // no live cell left
+        StillLife,      // period 1
+        Oscillating     // period() > 1, spaceships on a wrapped board included
+    };
+
+    explicit LifeCycleDetector(uint32_t historySize = 64);
+
+    /// Forgets the history; the next observe() starts over.
+    void        reset();
+
+    /// Hash of the engine's current board, updating only the stamped tiles.
+    uint64_t    hash(const LifeEngine& engine);
+
+    /// Hashes the current generation and looks it up in the history.
+    State       observe(const LifeEngine& engine);
+    State       state() const       { return _state; }
+    uint32_t    period() const      { return _period; }
+    /// Generation at which the repeat was first seen.
+    uint64_t    detectedAt() const  { return _detectedAt; }
+    uint32_t    historySize() const { return (uint32_t)_history.size(); }
+
+    /// Steps `engine` up to `generations` further, one generation at a time,
+    /// until the board dies or cycles; a cycle is then fast-forwarded: only
+    /// the remainder modulo the period is stepped. The engine ends at the
+    /// requested generation either way. Returns the generations actually stepped.
+    uint64_t    run(LifeEngine& engine, uint64_t generations);
+
+    /// Zobrist key of one packed word; 0 for an empty word.
+    static uint64_t wordKey(uint64_t position, uint64_t word);
+
+private:
+    struct Entry
+    {
+        uint64_t    hash;
+        uint64_t    generation;
+    };
+
+    std::vector<uint64_t>   _tileHash;
+    std::vector<uint64_t>   _tileHashed;    // engine revision each tile hash was taken at
+    uint64_t                _boardHash;
+    uint64_t                _population;    // live words, to tell extinct from a hash of 0
+    std::vector<uint64_t>   _tileWords;     // non-empty words per tile
+    const LifeEngine*       _engine;
+    uint64_t                _engineRevision;
+
+    std::vector<Entry>      _history;       // ring, most recent at _next - 1
+    uint32_t                _next;
+    uint32_t                _count;
+    State                   _state;
+    uint32_t                _period;
+    uint64_t                _detectedAt;
+};
+
+#endif /* RMDLLIFECYCLEDETECTOR_HPP */
@@ -0,0 +1,236 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: RMDLLifeDensityPyramid.cpp    +++     +++     **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 19/10/2026 22:58:47      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+#include "RMDLLifeDensityPyramid.hpp"
+
+// Halves the board until one block covers it, or JDLVDensityMaxLevels; returns the number of counts.
+static size_t buildLayout(const JDLVState& state, JDLVDensity& layout)
+{
+    memset(&layout, 0, sizeof(layout));
+    uint32_t width = state.width, height = state.height;
+    size_t offset = 0;
+    while ((width > 1 || height > 1) && layout.levelCount < JDLVDensityMaxLevels)
+    {
+        width = (width + 1) / 2;
+        height = (height + 1) / 2;
+        layout.levels[layout.levelCount++] = { width, height, (uint32_t)offset, 0 };
+        offset += (size_t)width * height;
+    }
+    return (offset);
+}
+
+LifeDensityPyramid::LifeDensityPyramid()
+    : _state{ 0, 0, 0, 0 }
+{
+    memset(&_layout, 0, sizeof(_layout));
+}
+
+size_t LifeDensityPyramid::bytesFor(const JDLVState& state)
+{
+    JDLVDensity layout;
+    return (sizeof(JDLVDensity) + buildLayout(state, layout) * sizeof(uint32_t));
+}
+
+void LifeDensityPyramid::reset(const JDLVState& state)
+{
+    _state = state;
+    const size_t counts = buildLayout(state, _layout);
+    _data.assign(kHeaderWords + counts, 0);
+    memcpy(_data.data(), &_layout, sizeof(_layout));
+
+    // Every frame of a simulation resets its own pyramid: say it once per process.
+    static std::atomic<bool> reportedCap(false);
+    const JDLVDensityLevel& top = _layout.levels[std::max<uint32_t>(_layout.levelCount, 1) - 1];
+    if (_layout.levelCount == JDLVDensityMaxLevels && (top.width > 1 || top.height > 1) && !reportedCap.exchange(true))
+        printf("LifeDensityPyramid: %ux%u needs more than %u levels, the top one is %ux%u blocks\n",
+               state.width, state.height, JDLVDensityMaxLevels, top.width, top.height);
+}
+
+void LifeDensityPyramid::sum(uint32_t k, uint32_t x0, uint32_t y0, uint32_t x1, uint32_t y1, const uint32_t* grid)
+{
+    const uint32_t width = _layout.levels[k - 1].width;
+    uint32_t* out = level(k);
+    if (k == 1)
+    {
+        const uint32_t w = _state.width, h = _state.height;
+        for (uint32_t y = y0; y < y1; ++y)
+        {
+            const uint32_t* top = grid + (size_t)(2 * y) * w;
+            const uint32_t* bottom = 2 * y + 1 < h ? top + w : nullptr;
+            for (uint32_t x = x0; x < x1; ++x)
+            {
+                const uint32_t cx = 2 * x;
+                const bool right = cx + 1 < w;
+                uint32_t count = (top[cx] == 1) + (right && top[cx + 1] == 1);
+                if (bottom)
+                    count += (bottom[cx] == 1) + (right && bottom[cx + 1] == 1);
+                out[(size_t)y * width + x] = count;
+            }
+        }
+        return;
+    }
+
+    const JDLVDensityLevel& below = _layout.levels[k - 2];
+    const uint32_t* child = level(k - 1);
+    for (uint32_t y = y0; y < y1; ++y)
+    {
+        const uint32_t* top = child + (size_t)(2 * y) * below.width;
+        const uint32_t* bottom = 2 * y + 1 < below.height ? top + below.width : nullptr;
+        for (uint32_t x = x0; x < x1; ++x)
+        {
+            const uint32_t cx = 2 * x;
+            const bool right = cx + 1 < below.width;
+            uint32_t count = top[cx] + (right ? top[cx + 1] : 0);
+            if (bottom)
+                count += bottom[cx] + (right ? bottom[cx + 1] : 0);
+            out[(size_t)y * width + x] = count;
+        }
+    }
+}
+
+void LifeDensityPyramid::rebuild(const JDLVState& state, const uint32_t* grid)
+{
+    reset(state);
+    for (uint32_t k = 1; k <= levels(); ++k)
+        sum(k, 0, 0, _layout.levels[k - 1].width, _layout.levels[k - 1].height, grid);
+}
+
+void LifeDensityPyramid::dirtyTiles(const std::vector<uint64_t>& tileSerial, uint64_t since, std::vector<uint32_t>& tiles) const
+{
+    tiles.clear();
+    const size_t count = std::min(tileSerial.size(), (size_t)tilesX() * tilesY());
+    for (size_t i = 0; i < count; ++i)
+        if (tileSerial[i] > since)
+            tiles.push_back((uint32_t)i);
+}
+
+void LifeDensityPyramid::ancestors(const std::vector<uint32_t>& tiles, std::vector<std::vector<uint32_t>>& nodes) const
+{
+    nodes.clear();
+    if (levels() <= kTileLevel)
+        return;
+    nodes.resize(levels() - kTileLevel);
+    const std::vector<uint32_t>* children = &tiles;
+    for (uint32_t k = kTileLevel + 1; k <= levels(); ++k)
+    {
+        const uint32_t childWidth = _layout.levels[k - 2].width, width = _layout.levels[k - 1].width;
+        std::vector<uint32_t>& parents = nodes[k - kTileLevel - 1];
+        parents.reserve(children->size());
+        for (uint32_t index : *children)
+            parents.push_back((index / childWidth / 2) * width + index % childWidth / 2);
+        // Children are in row-major order, so siblings are never far apart.
+        std::sort(parents.begin(), parents.end());
+        parents.erase(std::unique(parents.begin(), parents.end()), parents.end());
+        children = &parents;
+    }
+}
+
+void LifeDensityPyramid::update(const JDLVState& state, const uint32_t* grid,
+                                const std::vector<uint64_t>& tileSerial, uint64_t since)
+{
+    if (_data.empty() || state.width != _state.width || state.height != _state.height)
+    {
+        rebuild(state, grid);
+        return;
+    }
+    _state = state;
+
+    std::vector<uint32_t> tiles;
+    dirtyTiles(tileSerial, since, tiles);
+    if (tiles.empty())
+        return;
+
+    const uint32_t tileLevels = std::min(levels(), kTileLevel);
+    for (uint32_t tile : tiles)
+    {
+        const uint32_t tx = tile % tilesX(), ty = tile / tilesX();
+        for (uint32_t k = 1; k <= tileLevels; ++k)
+        {
+            const JDLVDensityLevel& l = _layout.levels[k - 1];
+            const uint32_t blocks = kTileSize >> k;
+            sum(k, tx * blocks, ty * blocks, std::min((tx + 1) * blocks, l.width), std::min((ty + 1) * blocks, l.height), grid);
+        }
+    }
+
+    std::vector<std::vector<uint32_t>> nodes;
+    ancestors(tiles, nodes);
+    for (size_t i = 0; i < nodes.size(); ++i)
+    {
+        const uint32_t k = kTileLevel + 1 + (uint32_t)i;
+        const uint32_t width = _layout.levels[k - 1].width;
+        for (uint32_t index : nodes[i])
+            sum(k, index % width, index / width, index % width + 1, index / width + 1, grid);
+    }
+}
+
+uint32_t LifeDensityPyramid::count(uint32_t k, uint32_t x, uint32_t y) const
+{
+    if (k == 0 || k > levels())
+        return (0);
+    const JDLVDensityLevel& l = _layout.levels[k - 1];
+    return (x < l.width && y < l.height ? level(k)[(size_t)y * l.width + x] : 0);
+}
+
+uint32_t LifeDensityPyramid::levelFor(float cellsPerPixel) const
+{
+    if (!(cellsPerPixel >= 2.f))
+        return (0);
+    return (std::min((uint32_t)std::floor(std::log2(cellsPerPixel)), levels()));
+}
+
+void LifeDensityPyramid::dirtyRanges(const std::vector<uint64_t>& tileSerial, uint64_t since, DirtyRangeTracker& tracker) const
+{
+    if (_data.empty())
+        return;
+    // Row runs of dirty tiles, level by level, so the tracker sees them in order.
+    const uint32_t columns = tilesX(), rows = tilesY();
+    const uint32_t tileLevels = std::min(levels(), kTileLevel);
+    for (uint32_t k = 1; k <= tileLevels; ++k)
+    {
+        const JDLVDensityLevel& l = _layout.levels[k - 1];
+        const uint32_t blocks = kTileSize >> k;
+        for (uint32_t ty = 0; ty < rows; ++ty)
+        {
+            const uint64_t* serials = &tileSerial[(size_t)ty * columns];
+            for (uint32_t tx = 0; tx < columns;)
+            {
+                if (serials[tx] <= since)
+                {
+                    ++tx;
+                    continue;
+                }
+                const uint32_t first = tx;
+                while (tx < columns && serials[tx] > since)
+                    ++tx;
+                const uint32_t x0 = first * blocks, x1 = std::min(tx * blocks, l.width);
+                for (uint32_t y = ty * blocks; y < std::min((ty + 1) * blocks, l.height); ++y)
+                    tracker.add((kHeaderWords + l.offset + (size_t)y * l.width + x0) * sizeof(uint32_t),
+                                (x1 - x0) * sizeof(uint32_t));
+            }
+        }
+    }
+
+    std::vector<uint32_t> tiles;
+    dirtyTiles(tileSerial, since, tiles);
+    std::vector<std::vector<uint32_t>> nodes;
+    ancestors(tiles, nodes);
+    for (size_t i = 0; i < nodes.size(); ++i)
+    {
+        const JDLVDensityLevel& l = _layout.levels[kTileLevel + i];
+        for (uint32_t index : nodes[i])
+            tracker.add((kHeaderWords + l.offset + index) * sizeof(uint32_t), sizeof(uint32_t));
+    }
+}
@@ -0,0 +1,80 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: RMDLLifeDensityPyramid.hpp    +++     +++     **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 19/10/2026 22:58:41      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef RMDLLIFEDENSITYPYRAMID_HPP
+# define RMDLLIFEDENSITYPYRAMID_HPP
+
+# include <cstddef>
+# include <cstdint>
+# include <vector>
+
+# include "JDLV_shared.h"
+# include "RMDLDirtyRangeTracker.hpp"
+
+/// Mip pyramid of live-cell counts over a JDLV board, for views zoomed out
+/// past one cell per pixel: level k holds the count of each 2^k x 2^k block
+/// (clipped at the edges), each level summing 2x2 blocks of the one below,
+/// up to a single block, or to level JDLVDensityMaxLevels on boards wider
+/// than 2^16 cells. Cells in state 1 count, as in LifeFrame::population:
+/// the dying states of a Generations rule do not.
+/// It follows the 64x64 tiles of LifeFrame::tileSerial: update() recounts
+/// levels 1 to 6 inside the tiles that changed, and above that only their
+/// ancestors, so a glider on a huge board costs a few hundred sums.
+/// data() is laid out as the JDLVFragment density buffer, the JDLVDensity
+/// header first. Copyable, so a LifeFrame can carry one.
+class LifeDensityPyramid
+{
+public:
+    static constexpr uint32_t kTileSize = 64;   // LifeFrame::kTileSize
+    static constexpr uint32_t kTileLevel = 6;   // level whose blocks are tiles
+
+    LifeDensityPyramid();
+
+    /// Sizes the levels for `state` and zeroes every count.
+    void                reset(const JDLVState& state);
+    void                rebuild(const JDLVState& state, const uint32_t* grid);
+    /// Recounts the tiles whose serial is past `since`; a board of another size is rebuilt whole.
+    void                update(const JDLVState& state, const uint32_t* grid,
+                               const std::vector<uint64_t>& tileSerial, uint64_t since);
+
+    const JDLVState&    state() const       { return _state; }
+    uint32_t            levels() const      { return _layout.levelCount; }
+    const JDLVDensity&  layout() const      { return _layout; }
+    /// Live cells of block (x, y) of `level`, 1 .. levels().
+    uint32_t            count(uint32_t level, uint32_t x, uint32_t y) const;
+    /// The level whose blocks are about `cellsPerPixel` cells across (0: the board itself).
+    uint32_t            levelFor(float cellsPerPixel) const;
+
+    const uint32_t*     data() const        { return _data.data(); }
+    size_t              bytes() const       { return _data.size() * sizeof(uint32_t); }
+    static size_t       bytesFor(const JDLVState& state);
+    /// Adds the byte ranges of data() that tiles with a serial past `since` changed.
+    void                dirtyRanges(const std::vector<uint64_t>& tileSerial, uint64_t since,
+                                    DirtyRangeTracker& tracker) const;
+
+private:
+    static constexpr uint32_t kHeaderWords = sizeof(JDLVDensity) / sizeof(uint32_t);
+
+    uint32_t*           level(uint32_t k)   { return &_data[kHeaderWords + _layout.levels[k - 1].offset]; }
+    const uint32_t*     level(uint32_t k) const { return &_data[kHeaderWords + _layout.levels[k - 1].offset]; }
+    uint32_t            tilesX() const      { return (_state.width + kTileSize - 1) / kTileSize; }
+    uint32_t            tilesY() const      { return (_state.height + kTileSize - 1) / kTileSize; }
+    /// Blocks [x0, x1) x [y0, y1) of level k from their children.
+    void                sum(uint32_t k, uint32_t x0, uint32_t y0, uint32_t x1, uint32_t y1, const uint32_t* grid);
+    /// Per level above the tiles, the indices of the ancestors of `tiles`, sorted.
+    void                ancestors(const std::vector<uint32_t>& tiles, std::vector<std::vector<uint32_t>>& nodes) const;
+    void                dirtyTiles(const std::vector<uint64_t>& tileSerial, uint64_t since, std::vector<uint32_t>& tiles) const;
+
+    JDLVState               _state;
+    JDLVDensity             _layout;
+    std::vector<uint32_t>   _data;          // header, then the counts
+};
+
+#endif /* RMDLLIFEDENSITYPYRAMID_HPP */
@@ -0,0 +1,115 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: RMDLLifeEditQueue.cpp         +++     +++     **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 19/10/2026 16:05:47      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include <cstdio>
+
+#include "RMDLLifeEditQueue.hpp"
+
+static LifeEdit makeEdit(LifeEdit::Kind kind, int32_t x0, int32_t y0)
+{
+    LifeEdit edit;
+    edit.kind = kind;
+    edit.state = 0;
+    edit.overwrite = false;
+    edit.x0 = x0;
+    edit.y0 = y0;
+    edit.x1 = x0;
+    edit.y1 = y0;
+    edit.radius = 0;
+    edit.width = 0;
+    edit.height = 0;
+    return (edit);
+}
+
+LifeEdit LifeEdit::stroke(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t radius, uint32_t state)
+{
+    LifeEdit edit = makeEdit(Kind::Stroke, x0, y0);
+    edit.x1 = x1;
+    edit.y1 = y1;
+    edit.radius = radius;
+    edit.state = state;
+    return (edit);
+}
+
+LifeEdit LifeEdit::stamp(int32_t x, int32_t y, uint32_t width, uint32_t height, std::vector<uint32_t> cells, bool overwrite)
+{
+    LifeEdit edit = makeEdit(Kind::Stamp, x, y);
+    if (cells.size() != (size_t)width * height)
+    {
+        printf("LifeEdit: %zu cells for a %ux%u stamp\n", cells.size(), width, height);
+        width = 0;
+        height = 0;
+        cells.clear();
+    }
+    edit.width = width;
+    edit.height = height;
+    edit.overwrite = overwrite;
+    edit.cells = std::move(cells);
+    return (edit);
+}
+
+LifeEdit LifeEdit::clear(int32_t x, int32_t y, uint32_t width, uint32_t height)
+{
+    LifeEdit edit = makeEdit(Kind::Clear, x, y);
+    edit.width = width;
+    edit.height = height;
+    return (edit);
+}
+
+LifeEditQueue::LifeEditQueue()
+    : _head(nullptr)
+{
+}
+
+LifeEditQueue::~LifeEditQueue()
+{
+    Node* node = _head.exchange(nullptr, std::memory_order_acquire);
+    while (node)
+    {
+        Node* next = node->next;
+        delete node;
+        node = next;
+    }
+}
+
+bool LifeEditQueue::push(LifeEdit edit)
+{
+    // Once published the node belongs to drain(): the old head is kept here, never read back from it.
+    Node* expected = _head.load(std::memory_order_relaxed);
+    Node* node = new Node{ std::move(edit), expected };
+    while (!_head.compare_exchange_weak(expected, node, std::memory_order_release, std::memory_order_relaxed))
+        node->next = expected;
+    return (expected == nullptr);
+}
+
+size_t LifeEditQueue::drain(std::vector<LifeEdit>& edits)
+{
+    // The consumer takes the whole list at once, so nodes are never popped under a producer (no ABA).
+    Node* node = _head.exchange(nullptr, std::memory_order_acquire);
+    Node* oldest = nullptr;
+    while (node)
+    {
+        Node* next = node->next;
+        node->next = oldest;
+        oldest = node;
+        node = next;
+    }
+
+    size_t count = 0;
+    while (oldest)
+    {
+        Node* next = oldest->next;
+        edits.push_back(std::move(oldest->edit));
+        delete oldest;
+        oldest = next;
+        ++count;
+    }
+    return (count);
+}
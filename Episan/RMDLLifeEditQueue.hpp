@@ -0,0 +1,136 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: RMDLLifeEditQueue.hpp         +++     +++     **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 19/10/2026 16:05:41      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef RMDLLIFEEDITQUEUE_HPP
+# define RMDLLIFEEDITQUEUE_HPP
+
+# include <algorithm>
+# include <atomic>
+# include <cstdint>
+# include <vector>
+
+# include "NonCopyable.h"
+
+/// One change to the board, in board cells. Edits are clipped to the board.
+struct LifeEdit
+{
+    enum class Kind : uint8_t
+    {
+        Stroke,     // round brush dragged from (x0, y0) to (x1, y1)
+        Stamp,      // width x height cells at (x0, y0)
+        Clear       // width x height cells at (x0, y0); 0 x 0 is the whole board
+    };
+
+    Kind                    kind;
+    uint32_t                state;      // what a stroke paints; 0 erases
+    bool                    overwrite;  // a stamp also writes its dead cells
+    int32_t                 x0, y0, x1, y1;
+    uint32_t                radius;
+    uint32_t                width, height;
+    std::vector<uint32_t>   cells;      // stamp, JDLV layout
+
+    static LifeEdit stroke(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t radius, uint32_t state = 1);
+    static LifeEdit stamp(int32_t x, int32_t y, uint32_t width, uint32_t height, std::vector<uint32_t> cells, bool overwrite = false);
+    static LifeEdit clear(int32_t x = 0, int32_t y = 0, uint32_t width = 0, uint32_t height = 0);
+
+    /// Calls span(y, x0, x1, state) for each run of cells [x0, x1) of row y
+    /// the edit sets to one state, clipped to a boardWidth x boardHeight board.
+    template <typename Span>
+    void forEachSpan(uint32_t boardWidth, uint32_t boardHeight, Span&& span) const;
+};
+
+/// Edits from any thread to the simulation thread without a lock: push()
+/// links a node onto an atomic list head, and the consumer takes the whole
+/// list with one exchange, so neither side ever waits on the other.
+class LifeEditQueue : public NonCopyable
+{
+public:
+    LifeEditQueue();
+    ~LifeEditQueue();
+
+    /// True when the queue was empty, i.e. the consumer may need waking.
+    bool        push(LifeEdit edit);
+    bool        empty() const   { return (_head.load(std::memory_order_acquire) == nullptr); }
+    /// Appends every queued edit to `edits`, oldest first; consumer side only.
+    size_t      drain(std::vector<LifeEdit>& edits);
+
+private:
+    struct Node
+    {
+        LifeEdit    edit;
+        Node*       next;
+    };
+
+    std::atomic<Node*>  _head;      // newest first
+};
+
+template <typename Span>
+void LifeEdit::forEachSpan(uint32_t boardWidth, uint32_t boardHeight, Span&& span) const
+{
+    const int64_t w = boardWidth, h = boardHeight;
+    if (kind == Kind::Stroke)
+    {
+        // A cell is painted when its centre lies within radius + 1/2 of the segment.
+        const int64_t r = radius;
+        const int64_t top = std::max<int64_t>(std::min(y0, y1) - r, 0);
+        const int64_t bottom = std::min<int64_t>(std::max(y0, y1) + r, h - 1);
+        const double dx = (double)x1 - x0, dy = (double)y1 - y0;
+        const double length2 = dx * dx + dy * dy;
+        const double reach2 = ((double)r + 0.5) * ((double)r + 0.5);
+        for (int64_t y = top; y <= bottom; ++y)
+        {
+            int64_t first = -1, last = -1;
+            const int64_t left = std::max<int64_t>(std::min(x0, x1) - r, 0);
+            const int64_t right = std::min<int64_t>(std::max(x0, x1) + r, w - 1);
+            for (int64_t x = left; x <= right; ++x)
+            {
+                double t = length2 > 0 ? (((double)x - x0) * dx + ((double)y - y0) * dy) / length2 : 0;
+                t = std::min(std::max(t, 0.0), 1.0);
+                const double ex = x - (x0 + t * dx), ey = y - (y0 + t * dy);
+                if (ex * ex + ey * ey > reach2)
+                    continue;
+                if (first < 0)
+                    first = x;
+                last = x;
+            }
+            // The capsule is convex, so each row is one run.
+            if (first >= 0)
+                span((uint32_t)y, (uint32_t)first, (uint32_t)last + 1, state);
+        }
+        return;
+    }
+
+    const int64_t ew = kind == Kind::Clear && width == 0 ? w : width;
+    const int64_t eh = kind == Kind::Clear && height == 0 ? h : height;
+    const int64_t left = std::max<int64_t>(x0, 0), right = std::min<int64_t>((int64_t)x0 + ew, w);
+    const int64_t top = std::max<int64_t>(y0, 0), bottom = std::min<int64_t>((int64_t)y0 + eh, h);
+    for (int64_t y = top; y < bottom; ++y)
+    {
+        if (kind == Kind::Clear)
+        {
+            if (left < right)
+                span((uint32_t)y, (uint32_t)left, (uint32_t)right, 0u);
+            continue;
+        }
+        const uint32_t* src = cells.data() + (size_t)(y - y0) * width;
+        for (int64_t x = left; x < right;)
+        {
+            const uint32_t value = src[x - x0];
+            int64_t end = x + 1;
+            while (end < right && src[end - x0] == value)
+                ++end;
+            if (value || overwrite)
+                span((uint32_t)y, (uint32_t)x, (uint32_t)end, value);
+            x = end;
+        }
+    }
+}
+
+#endif /* RMDLLIFEEDITQUEUE_HPP */
@@ -0,0 +1,278 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: RMDLLifeEngine.cpp            +++     +++     **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 17/10/2026 10:40:05      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include <algorithm>
+#include <cstdio>
+
+#include "RMDLLifeEngine.hpp"
+#include "RMDLLifeTopology.hpp"
+#include "RMDLMappedFile.hpp"
+
+// A row needs a word and the board a row: the halo and last-word mask code index both.
+static JDLVState atLeastOneCell(const JDLVState& state)
+{
+    if (state.width > 0 && state.height > 0)
+        return (state);
+    printf("LifeEngine: %ux%u board raised to one cell a side\n", state.width, state.height);
+    JDLVState raised = state;
+    raised.width = std::max<uint32_t>(state.width, 1);
+    raised.height = std::max<uint32_t>(state.height, 1);
+    return (raised);
+}
+
+LifeEngine::LifeEngine(const JDLVState& state)
+    : _state(atLeastOneCell(state))
+    , _wordsPerRow((_state.width + 63) / 64)
+    , _stride(_wordsPerRow + 2)
+    , _lastWordMask((_state.width % 64) ? ((uint64_t(1) << (_state.width % 64)) - 1) : ~uint64_t(0))
+    , _population(0)
+    , _revision(0)
+    , _current(0)
+    , _generation(0)
+    , _kernel(life_kernels::best())
+    , _rule(LifeRule::conway())
+    , _stepRow(life_kernels::stepRowFunction(_kernel, _rule))
+{
+    _storage[0].assign(cellWords(), 0);
+    _storage[1].assign(cellWords(), 0);
+    _cells[0] = _storage[0].data();
+    _cells[1] = _storage[1].data();
+    _tileRevision.assign((size_t)tilesX() * tilesY(), 0);
+    _tilePopulation.assign((size_t)tilesX() * tilesY(), 0);
+}
+
+LifeEngine::~LifeEngine()
+{
+}
+
+bool LifeEngine::setKernel(LifeKernel kernel)
+{
+    if (!life_kernels::available(kernel))
+        return (false);
+    _kernel = kernel;
+    _stepRow = life_kernels::stepRowFunction(kernel, _rule);
+    return (true);
+}
+
+bool LifeEngine::setRule(const LifeRule& rule)
+{
+    if (!rule.isTwoState())
+        return (false);
+    _rule = rule;
+    _stepRow = life_kernels::stepRowFunction(_kernel, rule);
+    return (true);
+}
+
+void LifeEngine::setTopology(JDLVTopology topology, uint32_t paddingState)
+{
+    _state.topology = topology;
+    _state.paddingState = paddingState;
+}
+
+void LifeEngine::clear()
+{
+    std::fill(_cells[0], _cells[0] + cellWords(), 0);
+    std::fill(_cells[1], _cells[1] + cellWords(), 0);
+    _generation = 0;
+    markAllDirty();
+}
+
+void LifeEngine::markAllDirty()
+{
+    _revision += 1;
+    std::fill(_tileRevision.begin(), _tileRevision.end(), _revision);
+
+    std::fill(_tilePopulation.begin(), _tilePopulation.end(), 0);
+    _population = 0;
+    for (uint32_t y = 0; y < _state.height; ++y)
+    {
+        const uint64_t* r = row((int32_t)y);
+        uint32_t* counts = &_tilePopulation[(size_t)(y / kTileRows) * _wordsPerRow];
+        for (size_t w = 0; w < _wordsPerRow; ++w)
+        {
+            const uint32_t count = (uint32_t)__builtin_popcountll(w + 1 < _wordsPerRow ? r[w] : r[w] & _lastWordMask);
+            counts[w] += count;
+            _population += count;
+        }
+    }
+}
+
+void LifeEngine::adoptCells(std::shared_ptr<MappedFile> file, size_t offset)
+{
+    _mapping = std::move(file);
+    _cells[_current] = reinterpret_cast<uint64_t*>(_mapping->mutableData() + offset);
+    _storage[_current].clear();
+    _storage[_current].shrink_to_fit();
+    markAllDirty();
+}
+
+void LifeEngine::writeRows(uint32_t y0, uint32_t rows, const uint64_t* src, size_t srcStride)
+{
+    _revision += 1;
+    for (uint32_t y = y0; y < y0 + rows; ++y, src += srcStride)
+    {
+        uint64_t* dst = row((int32_t)y);
+        uint64_t* stamps = &_tileRevision[(size_t)(y / kTileRows) * _wordsPerRow];
+        uint32_t* counts = &_tilePopulation[(size_t)(y / kTileRows) * _wordsPerRow];
+        for (size_t w = 0; w < _wordsPerRow; ++w)
+        {
+            // The last word may still carry the side halo bit: count under the mask.
+            const uint64_t mask = w + 1 < _wordsPerRow ? ~uint64_t(0) : _lastWordMask;
+            if ((dst[w] ^ src[w]) & mask)
+            {
+                stamps[w] = _revision;
+                const int32_t delta = __builtin_popcountll(src[w] & mask) - __builtin_popcountll(dst[w] & mask);
+                counts[w] += delta;
+                _population += delta;
+            }
+            dst[w] = src[w];
+        }
+    }
+}
+
+bool LifeEngine::cell(uint32_t x, uint32_t y) const
+{
+    if (x >= _state.width || y >= _state.height)
+        return (false);
+    return ((row(y)[x >> 6] >> (x & 63)) & 1);
+}
+
+void LifeEngine::setCell(uint32_t x, uint32_t y, bool alive)
+{
+    if (x >= _state.width || y >= _state.height)
+        return;
+    uint64_t& word = row(y)[x >> 6];
+    const uint64_t bit = uint64_t(1) << (x & 63);
+    if (((word & bit) != 0) == alive)
+        return;
+    word ^= bit;
+    _tilePopulation[(size_t)(y / kTileRows) * _wordsPerRow + (x >> 6)] += alive ? 1 : -1;
+    _population += alive ? 1 : -1;
+    _revision += 1;
+    markTile(x, y);
+}
+
+void LifeEngine::fillSpan(uint32_t y, uint32_t x0, uint32_t x1, bool alive)
+{
+    x1 = std::min(x1, _state.width);
+    if (y >= _state.height || x0 >= x1)
+        return;
+    _revision += 1;
+    uint64_t* r = row((int32_t)y);
+    const size_t tileRow = (size_t)(y / kTileRows) * _wordsPerRow;
+    for (uint32_t w = x0 >> 6; w <= (x1 - 1) >> 6; ++w)
+    {
+        const uint32_t begin = std::max(x0, w * 64) - w * 64, end = std::min(x1, w * 64 + 64) - w * 64;
+        const uint64_t mask = (end - begin == 64 ? ~uint64_t(0) : ((uint64_t(1) << (end - begin)) - 1)) << begin;
+        const uint64_t next = alive ? r[w] | mask : r[w] & ~mask;
+        if (next == r[w])
+            continue;
+        const int32_t delta = __builtin_popcountll(next) - __builtin_popcountll(r[w]);
+        r[w] = next;
+        _tilePopulation[tileRow + w] += delta;
+        _population += delta;
+        _tileRevision[tileRow + w] = _revision;
+    }
+}
+
+void LifeEngine::importGrid(const uint32_t* grid)
+{
+    for (uint32_t y = 0; y < _state.height; ++y)
+    {
+        uint64_t* dst = row(y);
+        const uint32_t* src = grid + (size_t)y * _state.width;
+        for (size_t w = 0; w < _wordsPerRow; ++w)
+        {
+            const uint32_t x0 = (uint32_t)(w * 64);
+            const uint32_t n = std::min<uint32_t>(64, _state.width - x0);
+            uint64_t word = 0;
+            for (uint32_t i = 0; i < n; ++i)
+                word |= (uint64_t)(src[x0 + i] > 0) << i;
+            dst[w] = word;
+        }
+    }
+    markAllDirty();
+}
+
+void LifeEngine::exportGrid(uint32_t* grid) const
+{
+    for (uint32_t y = 0; y < _state.height; ++y)
+    {
+        const uint64_t* src = row(y);
+        uint32_t* dst = grid + (size_t)y * _state.width;
+        for (size_t w = 0; w < _wordsPerRow; ++w)
+        {
+            const uint32_t x0 = (uint32_t)(w * 64);
+            const uint32_t n = std::min<uint32_t>(64, _state.width - x0);
+            const uint64_t word = src[w];
+            for (uint32_t i = 0; i < n; ++i)
+                dst[x0 + i] = (uint32_t)((word >> i) & 1);
+        }
+    }
+}
+
+void LifeEngine::fillHalo()
+{
+    if (_state.height == 0)
+        return;
+    life_topology::fillEdgeRow(row(-1), row((int32_t)_state.height - 1), _wordsPerRow, _state);
+    life_topology::fillEdgeRow(row((int32_t)_state.height), row(0), _wordsPerRow, _state);
+    for (int32_t y = -1; y <= (int32_t)_state.height; ++y)
+        life_topology::fillSideHalo(row(y), _state);
+}
+
+void LifeEngine::step()
+{
+    fillHalo();
+
+    const uint64_t* src = _cells[_current] + _stride + 1;
+    uint64_t* dst = _cells[_current ^ 1] + _stride + 1;
+    const size_t last = _wordsPerRow - 1;
+    _revision += 1;
+    uint64_t population = 0;
+
+    for (uint32_t y = 0; y < _state.height; ++y)
+    {
+        const uint64_t* r = src + (size_t)y * _stride;
+        uint64_t* out = dst + (size_t)y * _stride;
+        _stepRow(r - _stride, r, r + _stride, out, _wordsPerRow, _rule);
+        // Births past the right edge would leak back in on the next generation.
+        out[last] &= _lastWordMask;
+
+        // Both rows are still in L1; the side halo bit is not part of the tile.
+        const size_t tileRow = (size_t)(y / kTileRows) * _wordsPerRow;
+        uint64_t* stamps = &_tileRevision[tileRow];
+        uint32_t* counts = &_tilePopulation[tileRow];
+        if (y % kTileRows == 0)
+            std::fill(counts, counts + _wordsPerRow, 0);
+        for (size_t w = 0; w < last; ++w)
+        {
+            if (out[w] != r[w])
+                stamps[w] = _revision;
+            const uint32_t count = (uint32_t)__builtin_popcountll(out[w]);
+            counts[w] += count;
+            population += count;
+        }
+        if ((out[last] ^ r[last]) & _lastWordMask)
+            stamps[last] = _revision;
+        const uint32_t count = (uint32_t)__builtin_popcountll(out[last]);
+        counts[last] += count;
+        population += count;
+    }
+    _population = population;
+    _current ^= 1;
+    _generation += 1;
+}
+
+void LifeEngine::step(uint64_t generations)
+{
+    while (generations--)
+        step();
+}
@@ -0,0 +1,119 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: RMDLLifeEngine.hpp            +++     +++     **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 17/10/2026 10:40:02      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef RMDLLIFEENGINE_HPP
+# define RMDLLIFEENGINE_HPP
+
+# include <cstddef>
+# include <cstdint>
+# include <memory>
+# include <vector>
+
+# include "JDLV_shared.h"
+# include "NonCopyable.h"
+# include "RMDLLifeKernels.hpp"
+
+class MappedFile;
+
+/// Headless CPU port of JDLVReference: 64 cells per uint64_t word.
+/// Rows are padded with one halo word on each side and one halo row
+/// above and below, so the kernels never test bounds; the halo is filled
+/// from the topology once per generation.
+/// Every 64x64 tile (one word by 64 rows) records the revision it last
+/// changed at, so checkpoints and uploads only touch what moved, and its
+/// live cell count, which step() gets from the words it has just written.
+class LifeEngine : public NonCopyable
+{
+public:
+    static constexpr uint32_t kTileRows = 64;
+
+    /// A zero width or height is raised to 1, with a message: the kernels need a word per row.
+    explicit LifeEngine(const JDLVState& state);
+    ~LifeEngine();
+
+    const JDLVState&    state() const       { return _state; }
+    uint32_t            width() const       { return _state.width; }
+    uint32_t            height() const      { return _state.height; }
+    JDLVTopology        topology() const    { return (JDLVTopology)_state.topology; }
+    void                setTopology(JDLVTopology topology, uint32_t paddingState = 0);
+    size_t              wordsPerRow() const { return _wordsPerRow; }
+    size_t              stride() const      { return _stride; }
+    uint64_t            generation() const  { return _generation; }
+    void                setGeneration(uint64_t generation) { _generation = generation; }
+    LifeKernel          kernel() const      { return _kernel; }
+    bool                setKernel(LifeKernel kernel);
+    const LifeRule&     rule() const        { return _rule; }
+    /// Two-state rules only; the packed layout has one bit per cell.
+    bool                setRule(const LifeRule& rule);
+    life_kernels::StepRowFn stepRowFunction() const { return _stepRow; }
+
+    void                clear();
+    bool                cell(uint32_t x, uint32_t y) const;
+    void                setCell(uint32_t x, uint32_t y, bool alive);
+    /// Sets cells [x0, x1) of row y a word at a time, stamping only the tiles that change.
+    void                fillSpan(uint32_t y, uint32_t x0, uint32_t x1, bool alive);
+
+    /// Same layout as _pGridBuffer_A/_B: one uint32_t per cell, row-major, > 0 is alive.
+    void                importGrid(const uint32_t* grid);
+    void                exportGrid(uint32_t* grid) const;
+
+    /// Rebuilds the halo rows and columns from the topology; step() does it first.
+    void                fillHalo();
+    void                step();
+    void                step(uint64_t generations);
+
+    /// Copies `rows` packed rows in (stride `srcStride` words), stamping the tiles that differ.
+    void                writeRows(uint32_t y0, uint32_t rows, const uint64_t* src, size_t srcStride);
+
+    /// Bumped by every step and edit; tiles changed after a reader's last revision have a larger stamp.
+    uint64_t            revision() const    { return _revision; }
+    uint32_t            tilesX() const      { return (uint32_t)_wordsPerRow; }
+    uint32_t            tilesY() const      { return (_state.height + kTileRows - 1) / kTileRows; }
+    uint64_t            tileRevision(uint32_t tx, uint32_t ty) const { return _tileRevision[(size_t)ty * _wordsPerRow + tx]; }
+    /// Stamps every tile and recounts the population; for callers that wrote through row().
+    void                markAllDirty();
+
+    /// Live cells, kept up to date by every step and edit.
+    uint64_t            population() const  { return _population; }
+    uint32_t            tilePopulation(uint32_t tx, uint32_t ty) const { return _tilePopulation[(size_t)ty * _wordsPerRow + tx]; }
+
+    /// Whole buffer, halo rows included: stride() * (height() + 2) words.
+    const uint64_t*     cells() const       { return _cells[_current]; }
+    size_t              cellWords() const   { return _stride * ((size_t)_state.height + 2); }
+    /// Steps from `cells` (cellWords() words at `offset` in a writable mapping) without copying them in.
+    void                adoptCells(std::shared_ptr<MappedFile> file, size_t offset);
+
+    /// First real word of row y (y may be -1 or height for the halo rows).
+    const uint64_t*     row(int32_t y) const { return _cells[_current] + (size_t)(y + 1) * _stride + 1; }
+    uint64_t*           row(int32_t y)       { return _cells[_current] + (size_t)(y + 1) * _stride + 1; }
+    uint64_t            lastWordMask() const { return _lastWordMask; }
+
+private:
+    JDLVState               _state;
+    size_t                  _wordsPerRow;
+    size_t                  _stride;
+    uint64_t                _lastWordMask;
+    void                    markTile(uint32_t x, uint32_t y) { _tileRevision[(size_t)(y / kTileRows) * _wordsPerRow + (x >> 6)] = _revision; }
+
+    std::vector<uint64_t>   _storage[2];
+    uint64_t*               _cells[2];      // _storage or an adopted mapping
+    std::shared_ptr<MappedFile> _mapping;
+    std::vector<uint64_t>   _tileRevision;
+    std::vector<uint32_t>   _tilePopulation;
+    uint64_t                _population;
+    uint64_t                _revision;
+    uint8_t                 _current;
+    uint64_t                _generation;
+    LifeKernel              _kernel;
+    LifeRule                _rule;
+    life_kernels::StepRowFn _stepRow;
+};
+
+#endif /* RMDLLIFEENGINE_HPP */
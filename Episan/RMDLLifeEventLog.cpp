@@ -0,0 +1,513 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: RMDLLifeEventLog.cpp          +++     +++     **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 19/10/2026 20:12:40      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include <algorithm>
+#include <cstring>
+
+#include "RMDLLifeBoard.hpp"
+#include "RMDLLifeEventLog.hpp"
+#include "RMDLMappedFile.hpp"
+
+static const char kMagic[4] = { 'E', 'P', 'E', 'V' };
+static constexpr uint8_t kVersion = 1;
+
+static void putVarint(std::vector<uint8_t>& out, uint64_t value)
+{
+    while (value >= 0x80)
+    {
+        out.push_back((uint8_t)(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back((uint8_t)value);
+}
+
+static void putSigned(std::vector<uint8_t>& out, int64_t value)
+{
+    putVarint(out, ((uint64_t)value << 1) ^ (uint64_t)(value >> 63));
+}
+
+static void putFloat(std::vector<uint8_t>& out, float value)
+{
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    for (uint32_t i = 0; i < 4; ++i)
+        out.push_back((uint8_t)(bits >> (8 * i)));
+}
+
+// (value, run) pairs over `count` cells.
+static void putCells(std::vector<uint8_t>& out, const uint32_t* cells, size_t count)
+{
+    for (size_t i = 0; i < count;)
+    {
+        size_t end = i + 1;
+        while (end < count && cells[end] == cells[i])
+            ++end;
+        putVarint(out, cells[i]);
+        putVarint(out, end - i);
+        i = end;
+    }
+}
+
+namespace
+{
+    struct Cursor
+    {
+        const uint8_t*  data;
+        const uint8_t*  end;
+
+        bool varint(uint64_t& value)
+        {
+            value = 0;
+            for (uint32_t shift = 0; shift < 64 && data < end; shift += 7)
+            {
+                const uint8_t byte = *data++;
+                value |= (uint64_t)(byte & 0x7f) << shift;
+                if (!(byte & 0x80))
+                    return (true);
+            }
+            return (false);
+        }
+
+        bool word(uint32_t& value)
+        {
+            uint64_t wide;
+            if (!varint(wide) || wide > UINT32_MAX)
+                return (false);
+            value = (uint32_t)wide;
+            return (true);
+        }
+
+        bool signedWord(int32_t& value)
+        {
+            uint64_t wide;
+            if (!varint(wide))
+                return (false);
+            const int64_t decoded = (int64_t)(wide >> 1) ^ -(int64_t)(wide & 1);
+            if (decoded < INT32_MIN || decoded > INT32_MAX)
+                return (false);
+            value = (int32_t)decoded;
+            return (true);
+        }
+
+        bool real(float& value)
+        {
+            if (end - data < 4)
+                return (false);
+            const uint32_t bits = (uint32_t)data[0] | ((uint32_t)data[1] << 8) | ((uint32_t)data[2] << 16) | ((uint32_t)data[3] << 24);
+            memcpy(&value, &bits, sizeof(value));
+            data += 4;
+            return (true);
+        }
+
+        bool cells(std::vector<uint32_t>& out, size_t count)
+        {
+            out.clear();
+            out.reserve(count);
+            while (out.size() < count)
+            {
+                uint64_t value, run;
+                if (!varint(value) || !varint(run) || value > UINT32_MAX || run == 0 || run > count - out.size())
+                    return (false);
+                out.insert(out.end(), (size_t)run, (uint32_t)value);
+            }
+            return (true);
+        }
+    };
+}
+
+LifeEventLog::LifeEventLog()
+    : _file(nullptr)
+    , _width(0)
+    , _height(0)
+    , _lastGeneration(0)
+    , _events(0)
+{
+}
+
+LifeEventLog::~LifeEventLog()
+{
+    close();
+}
+
+bool LifeEventLog::open(const char* path, uint32_t width, uint32_t height)
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    if (_file)
+        fclose(_file);
+    _file = fopen(path, "wb");
+    if (!_file)
+    {
+        printf("LifeEventLog: cannot write %s\n", path);
+        return (false);
+    }
+    _width = width;
+    _height = height;
+    _lastGeneration = 0;
+    _events = 0;
+    _buffer.assign(kMagic, kMagic + 4);
+    _buffer.push_back(kVersion);
+    putVarint(_buffer, width);
+    putVarint(_buffer, height);
+    fwrite(_buffer.data(), 1, _buffer.size(), _file);
+    return (true);
+}
+
+void LifeEventLog::close()
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    if (!_file)
+        return;
+    fclose(_file);
+    _file = nullptr;
+}
+
+// Called with _lock held.
+void LifeEventLog::begin(uint64_t generation, LifeEvent::Kind kind)
+{
+    _buffer.clear();
+    putSigned(_buffer, (int64_t)(generation - _lastGeneration));
+    _buffer.push_back((uint8_t)kind);
+    _lastGeneration = generation;
+}
+
+void LifeEventLog::commit()
+{
+    fwrite(_buffer.data(), 1, _buffer.size(), _file);
+    ++_events;
+}
+
+void LifeEventLog::key(uint64_t generation, uint32_t key)
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    if (!_file)
+        return;
+    begin(generation, LifeEvent::Kind::Key);
+    putVarint(_buffer, key);
+    commit();
+}
+
+void LifeEventLog::moveCamera(uint64_t generation, float x, float y, float z)
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    if (!_file)
+        return;
+    begin(generation, LifeEvent::Kind::MoveCamera);
+    putFloat(_buffer, x);
+    putFloat(_buffer, y);
+    putFloat(_buffer, z);
+    commit();
+}
+
+void LifeEventLog::rotateCamera(uint64_t generation, float yaw, float pitch)
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    if (!_file)
+        return;
+    begin(generation, LifeEvent::Kind::RotateCamera);
+    putFloat(_buffer, yaw);
+    putFloat(_buffer, pitch);
+    commit();
+}
+
+void LifeEventLog::edit(uint64_t generation, const LifeEdit& edit)
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    if (!_file)
+        return;
+    begin(generation, LifeEvent::Kind::Edit);
+    _buffer.push_back((uint8_t)edit.kind);
+    _buffer.push_back(edit.overwrite ? 1 : 0);
+    putVarint(_buffer, edit.state);
+    putSigned(_buffer, edit.x0);
+    putSigned(_buffer, edit.y0);
+    putSigned(_buffer, edit.x1);
+    putSigned(_buffer, edit.y1);
+    putVarint(_buffer, edit.radius);
+    putVarint(_buffer, edit.width);
+    putVarint(_buffer, edit.height);
+    if (edit.kind == LifeEdit::Kind::Stamp)
+        putCells(_buffer, edit.cells.data(), edit.cells.size());
+    commit();
+}
+
+void LifeEventLog::rule(uint64_t generation, const LifeRule& rule)
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    if (!_file)
+        return;
+    begin(generation, LifeEvent::Kind::Rule);
+    putVarint(_buffer, rule.birth);
+    putVarint(_buffer, rule.survive);
+    putVarint(_buffer, rule.states);
+    commit();
+}
+
+void LifeEventLog::ruleTable(uint64_t generation, const RuleTable& table)
+{
+    std::vector<uint8_t> bytes;
+    table.serialize(bytes);
+    std::lock_guard<std::mutex> guard(_lock);
+    if (!_file)
+        return;
+    begin(generation, LifeEvent::Kind::RuleTable);
+    putVarint(_buffer, bytes.size());
+    _buffer.insert(_buffer.end(), bytes.begin(), bytes.end());
+    commit();
+}
+
+void LifeEventLog::topology(uint64_t generation, JDLVTopology topology, uint32_t paddingState)
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    if (!_file)
+        return;
+    begin(generation, LifeEvent::Kind::Topology);
+    putVarint(_buffer, (uint32_t)topology);
+    putVarint(_buffer, paddingState);
+    commit();
+}
+
+void LifeEventLog::grid(uint64_t generation, const uint32_t* grid)
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    if (!_file)
+        return;
+    begin(generation, LifeEvent::Kind::Grid);
+    putCells(_buffer, grid, (size_t)_width * _height);
+    commit();
+}
+
+void LifeEventLog::end(uint64_t generation)
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    if (!_file)
+        return;
+    begin(generation, LifeEvent::Kind::End);
+    commit();
+    fflush(_file);
+}
+
+LifeEventReader::LifeEventReader()
+    : _position(0)
+    , _width(0)
+    , _height(0)
+    , _generation(0)
+{
+}
+
+bool LifeEventReader::open(const char* path)
+{
+    MappedFile file;
+    if (!file.open(path))
+        return (false);
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(file.data());
+    _data.assign(bytes, bytes + file.size());
+    Cursor cursor = { _data.data(), _data.data() + _data.size() };
+    if (_data.size() < 5 || memcmp(_data.data(), kMagic, 4) != 0 || _data[4] != kVersion)
+    {
+        printf("LifeEventReader: %s is not an event log\n", path);
+        return (false);
+    }
+    cursor.data += 5;
+    if (!cursor.word(_width) || !cursor.word(_height) || _width == 0 || _height == 0)
+    {
+        printf("LifeEventReader: %s has a bad header\n", path);
+        return (false);
+    }
+    _position = (size_t)(cursor.data - _data.data());
+    _generation = 0;
+    return (true);
+}
+
+bool LifeEventReader::next(LifeEvent& event)
+{
+    if (_position >= _data.size())
+        return (false);
+    Cursor cursor = { _data.data() + _position, _data.data() + _data.size() };
+    uint64_t delta;
+    if (!cursor.varint(delta) || cursor.data >= cursor.end)
+    {
+        printf("LifeEventReader: truncated event at byte %zu\n", _position);
+        return (false);
+    }
+    event.generation = _generation + (uint64_t)((int64_t)(delta >> 1) ^ -(int64_t)(delta & 1));
+    event.kind = (LifeEvent::Kind)*cursor.data++;
+
+    bool ok = true;
+    switch (event.kind)
+    {
+        case LifeEvent::Kind::Key:
+            ok = cursor.word(event.key);
+            break;
+        case LifeEvent::Kind::MoveCamera:
+            ok = cursor.real(event.values[0]) && cursor.real(event.values[1]) && cursor.real(event.values[2]);
+            break;
+        case LifeEvent::Kind::RotateCamera:
+            ok = cursor.real(event.values[0]) && cursor.real(event.values[1]);
+            break;
+        case LifeEvent::Kind::Edit:
+        {
+            LifeEdit& edit = event.edit;
+            if (cursor.end - cursor.data < 2)
+            {
+                ok = false;
+                break;
+            }
+            const uint8_t kind = *cursor.data++;
+            edit.overwrite = *cursor.data++ != 0;
+            edit.kind = (LifeEdit::Kind)kind;
+            ok = kind <= (uint8_t)LifeEdit::Kind::Clear && cursor.word(edit.state)
+                && cursor.signedWord(edit.x0) && cursor.signedWord(edit.y0)
+                && cursor.signedWord(edit.x1) && cursor.signedWord(edit.y1)
+                && cursor.word(edit.radius) && cursor.word(edit.width) && cursor.word(edit.height);
+            edit.cells.clear();
+            if (ok && edit.kind == LifeEdit::Kind::Stamp)
+                ok = cursor.cells(edit.cells, (size_t)edit.width * edit.height);
+            break;
+        }
+        case LifeEvent::Kind::Rule:
+        {
+            uint32_t birth = 0, survive = 0;
+            ok = cursor.word(birth) && cursor.word(survive) && cursor.word(event.rule.states)
+                && birth <= UINT16_MAX && survive <= UINT16_MAX;
+            event.rule.birth = (uint16_t)birth;
+            event.rule.survive = (uint16_t)survive;
+            break;
+        }
+        case LifeEvent::Kind::RuleTable:
+        {
+            uint64_t size;
+            event.table = std::make_shared<RuleTable>();
+            ok = cursor.varint(size) && size <= (uint64_t)(cursor.end - cursor.data)
+                && RuleTable::deserialize(cursor.data, (size_t)size, *event.table);
+            if (ok)
+                cursor.data += size;
+            break;
+        }
+        case LifeEvent::Kind::Topology:
+            ok = cursor.word(event.topology) && cursor.word(event.paddingState) && event.topology <= JDLVTopologyPadded;
+            break;
+        case LifeEvent::Kind::Grid:
+            ok = cursor.cells(event.grid, (size_t)_width * _height);
+            break;
+        case LifeEvent::Kind::End:
+            break;
+        default:
+            ok = false;
+            break;
+    }
+    if (!ok)
+    {
+        printf("LifeEventReader: malformed event at byte %zu\n", _position);
+        _position = _data.size();
+        return (false);
+    }
+    _position = (size_t)(cursor.data - _data.data());
+    _generation = event.generation;
+    return (true);
+}
+
+LifeReplay::LifeReplay(const JDLVState& state)
+    : _engine(state)
+    , _events(0)
+{
+}
+
+LifeReplay::~LifeReplay()
+{
+}
+
+uint64_t LifeReplay::generation() const
+{
+    return (_multiState ? _multiState->generation() : _engine.generation());
+}
+
+uint64_t LifeReplay::population() const
+{
+    if (!_multiState)
+        return (_engine.population());
+    std::vector<uint32_t> grid((size_t)_engine.width() * _engine.height());
+    _multiState->exportGrid(grid.data());
+    return ((uint64_t)std::count(grid.begin(), grid.end(), 1u));
+}
+
+void LifeReplay::exportGrid(uint32_t* grid) const
+{
+    life_board::exportGrid(_engine, _multiState.get(), grid);
+}
+
+void LifeReplay::stepTo(uint64_t generation)
+{
+    if (generation <= this->generation())
+        return;
+    if (_multiState)
+        _multiState->step(generation - _multiState->generation());
+    else
+        _engine.step(generation - _engine.generation());
+}
+
+bool LifeReplay::apply(const LifeEvent& event)
+{
+    if (!event.changesBoard() && event.kind != LifeEvent::Kind::End)
+        return (true);
+    ++_events;
+    if (event.kind == LifeEvent::Kind::Grid)
+    {
+        life_board::importGrid(_engine, _multiState.get(), event.grid.data(), event.generation);
+        return (true);
+    }
+    if (event.generation < generation())
+    {
+        printf("LifeReplay: event at generation %llu after %llu\n",
+               (unsigned long long)event.generation, (unsigned long long)generation());
+        return (false);
+    }
+    stepTo(event.generation);
+
+    const uint32_t width = _engine.width(), height = _engine.height();
+    switch (event.kind)
+    {
+        case LifeEvent::Kind::Edit:
+            event.edit.forEachSpan(width, height, [this](uint32_t y, uint32_t x0, uint32_t x1, uint32_t state)
+            {
+                life_board::fillSpan(_engine, _multiState.get(), y, x0, x1, state);
+            });
+            break;
+        case LifeEvent::Kind::Rule:
+            life_board::applyRule(_engine, _multiState, event.rule);
+            break;
+        case LifeEvent::Kind::RuleTable:
+            life_board::applyRuleTable(_engine, _multiState, *event.table);
+            break;
+        case LifeEvent::Kind::Topology:
+            life_board::setTopology(_engine, _multiState.get(), (JDLVTopology)event.topology, event.paddingState);
+            break;
+        default:
+            break;
+    }
+    return (true);
+}
+
+bool LifeReplay::play(const char* path, std::unique_ptr<LifeReplay>& replay)
+{
+    LifeEventReader reader;
+    if (!reader.open(path))
+        return (false);
+    replay.reset(new LifeReplay({ reader.width(), reader.height(), JDLVTopologyPlane, 0 }));
+    LifeEvent event;
+    while (reader.next(event))
+    {
+        if (!replay->apply(event))
+            return (false);
+        if (event.kind == LifeEvent::Kind::End)
+            return (true);
+    }
+    printf("LifeReplay: %s ends without an end event\n", path);
+    return (false);
+}
@@ -0,0 +1,148 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: RMDLLifeEventLog.hpp          +++     +++     **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 19/10/2026 20:12:34      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef RMDLLIFEEVENTLOG_HPP
+# define RMDLLIFEEVENTLOG_HPP
+
+# include <cstdint>
+# include <cstdio>
+# include <memory>
+# include <mutex>
+# include <string>
+# include <vector>
+
+# include "JDLV_shared.h"
+# include "NonCopyable.h"
+# include "RMDLLifeEditQueue.hpp"
+# include "RMDLLifeEngine.hpp"
+# include "RMDLRuleTable.hpp"
+# include "RMDLRuleTableEngine.hpp"
+
+/// One entry of a session log. Board events are stamped with the generation
+/// the simulation thread applied them at, so replaying them in order after
+/// stepping to that generation gives the same board bit for bit; key and
+/// camera events carry the generation they were seen at.
+struct LifeEvent
+{
+    enum class Kind : uint8_t
+    {
+        Key = 1,
+        MoveCamera,         // values[0..2]
+        RotateCamera,       // values[0..1]: yaw, pitch
+        Edit,
+        Rule,
+        RuleTable,
+        Topology,
+        Grid,               // whole board; sets the generation (loads, history seeks)
+        End                 // the session stopped here
+    };
+
+    Kind                        kind;
+    uint64_t                    generation;
+    uint32_t                    key;
+    float                       values[3];
+    LifeEdit                    edit;
+    LifeRule                    rule;
+    std::shared_ptr<RuleTable>  table;
+    uint32_t                    topology;
+    uint32_t                    paddingState;
+    std::vector<uint32_t>       grid;
+
+    bool    changesBoard() const    { return (kind >= Kind::Edit && kind <= Kind::Grid); }
+};
+
+/// Appends events to a file, from any thread. Each is a zigzag varint of
+/// the generation minus the previous event's, a kind byte and its payload;
+/// boards and stamps are run-length coded, so an hour of painting and
+/// camera moves stays in the megabytes.
+/// File: "EPEV", version byte, varint width and height, then events.
+class LifeEventLog : public NonCopyable
+{
+public:
+    LifeEventLog();
+    ~LifeEventLog();
+
+    bool        open(const char* path, uint32_t width, uint32_t height);
+    void        close();
+    bool        isOpen() const  { return (_file != nullptr); }
+    uint64_t    events() const  { return _events; }
+
+    void        key(uint64_t generation, uint32_t key);
+    void        moveCamera(uint64_t generation, float x, float y, float z);
+    void        rotateCamera(uint64_t generation, float yaw, float pitch);
+    void        edit(uint64_t generation, const LifeEdit& edit);
+    void        rule(uint64_t generation, const LifeRule& rule);
+    void        ruleTable(uint64_t generation, const RuleTable& table);
+    void        topology(uint64_t generation, JDLVTopology topology, uint32_t paddingState);
+    /// width * height cells, JDLV layout.
+    void        grid(uint64_t generation, const uint32_t* grid);
+    void        end(uint64_t generation);
+
+private:
+    void        begin(uint64_t generation, LifeEvent::Kind kind);
+    void        commit();
+
+    std::mutex              _lock;
+    FILE*                   _file;
+    uint32_t                _width;
+    uint32_t                _height;
+    uint64_t                _lastGeneration;
+    uint64_t                _events;
+    std::vector<uint8_t>    _buffer;
+};
+
+/// Reads a LifeEventLog file back, one event at a time.
+class LifeEventReader : public NonCopyable
+{
+public:
+    LifeEventReader();
+
+    bool        open(const char* path);
+    uint32_t    width() const   { return _width; }
+    uint32_t    height() const  { return _height; }
+    /// False at the end of the file or on a malformed event (reported).
+    bool        next(LifeEvent& event);
+
+private:
+    std::vector<uint8_t>    _data;
+    size_t                  _position;
+    uint32_t                _width;
+    uint32_t                _height;
+    uint64_t                _generation;
+};
+
+/// Headless replay of a log's board events: the engines LifeSimulation
+/// would use, switched by the same life_board calls and stepped flat out
+/// between events with no pacing or publishing.
+class LifeReplay : public NonCopyable
+{
+public:
+    explicit LifeReplay(const JDLVState& state);
+    ~LifeReplay();
+
+    /// Steps to the event's generation and applies it; input events are skipped.
+    bool        apply(const LifeEvent& event);
+    /// Replays a whole file into a board of its size. Returns false on a read error.
+    static bool play(const char* path, std::unique_ptr<LifeReplay>& replay);
+
+    uint64_t    generation() const;
+    uint64_t    population() const;
+    uint64_t    events() const  { return _events; }
+    void        exportGrid(uint32_t* grid) const;
+
+private:
+    void        stepTo(uint64_t generation);
+
+    LifeEngine                          _engine;
+    std::unique_ptr<RuleTableEngine>    _multiState;
+    uint64_t                            _events;
+};
+
+#endif /* RMDLLIFEEVENTLOG_HPP */
@@ -0,0 +1,225 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: RMDLLifeHistory.cpp           +++     +++     **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 19/10/2026 18:47:26      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include <algorithm>
+
+#include "RMDLLifeHistory.hpp"
+
+static constexpr uint32_t kTileRows = LifeEngine::kTileRows;
+
+LifeHistory::LifeHistory(uint32_t keyframeInterval, size_t budgetBytes)
+    : _keyframeInterval(std::max<uint32_t>(keyframeInterval, 1))
+    , _budgetBytes(budgetBytes)
+    , _bytes(0)
+    , _width(0)
+    , _height(0)
+    , _wordsPerRow(0)
+    , _lastMask(0)
+    , _lastGeneration(0)
+    , _lastRevision(0)
+    , _seeked(false)
+    , _cursorSegment(0)
+    , _cursorMarks(0)
+{
+}
+
+void LifeHistory::setBudgetBytes(size_t budgetBytes)
+{
+    _budgetBytes = budgetBytes;
+    if (!_seeked)
+        trim();
+}
+
+void LifeHistory::clear()
+{
+    _segments.clear();
+    _bytes = 0;
+    _shadow.clear();
+    _seeked = false;
+}
+
+uint64_t LifeHistory::oldestGeneration() const
+{
+    return (_segments.empty() ? 0 : _segments.front().generation);
+}
+
+uint64_t LifeHistory::newestGeneration() const
+{
+    if (_segments.empty())
+        return (0);
+    const Segment& last = _segments.back();
+    return (last.marks.empty() ? last.generation : last.marks.back().generation);
+}
+
+size_t LifeHistory::segmentBytes(const Segment& segment) const
+{
+    return ((segment.keyframe.size() + segment.deltas.size()) * sizeof(uint64_t) + segment.marks.size() * sizeof(Mark));
+}
+
+void LifeHistory::startSegment(const LifeEngine& engine)
+{
+    _width = engine.width();
+    _height = engine.height();
+    _wordsPerRow = engine.wordsPerRow();
+    _lastMask = engine.lastWordMask();
+
+    _segments.emplace_back();
+    Segment& segment = _segments.back();
+    segment.generation = engine.generation();
+    segment.keyframe.resize(_wordsPerRow * _height);
+    for (uint32_t y = 0; y < _height; ++y)
+    {
+        uint64_t* dst = &segment.keyframe[(size_t)y * _wordsPerRow];
+        std::copy(engine.row((int32_t)y), engine.row((int32_t)y) + _wordsPerRow, dst);
+        dst[_wordsPerRow - 1] &= _lastMask;
+    }
+    _shadow = segment.keyframe;
+    _bytes += segmentBytes(segment);
+    _lastGeneration = engine.generation();
+    _lastRevision = engine.revision();
+}
+
+// Tile by tile: [tile index] [row mask] [one XOR word per set bit].
+void LifeHistory::appendDelta(const LifeEngine& engine)
+{
+    Segment& segment = _segments.back();
+    const size_t before = segmentBytes(segment);
+    segment.marks.push_back({ engine.generation(), segment.deltas.size() });
+
+    const uint32_t tilesX = engine.tilesX(), tilesY = engine.tilesY();
+    uint64_t words[kTileRows];
+    for (uint32_t ty = 0; ty < tilesY; ++ty)
+    {
+        const uint32_t y0 = ty * kTileRows, rows = std::min(kTileRows, _height - y0);
+        for (uint32_t tx = 0; tx < tilesX; ++tx)
+        {
+            if (engine.tileRevision(tx, ty) <= _lastRevision)
+                continue;
+            const uint64_t keep = tx + 1 < tilesX ? ~uint64_t(0) : _lastMask;
+            uint64_t mask = 0;
+            uint32_t count = 0;
+            for (uint32_t r = 0; r < rows; ++r)
+            {
+                uint64_t& old = _shadow[(size_t)(y0 + r) * _wordsPerRow + tx];
+                const uint64_t now = engine.row((int32_t)(y0 + r))[tx] & keep;
+                if (now == old)
+                    continue;
+                mask |= uint64_t(1) << r;
+                words[count++] = now ^ old;
+                old = now;
+            }
+            if (!mask)
+                continue;
+            segment.deltas.push_back((uint64_t)ty * tilesX + tx);
+            segment.deltas.push_back(mask);
+            segment.deltas.insert(segment.deltas.end(), words, words + count);
+        }
+    }
+    _bytes += segmentBytes(segment) - before;
+    _lastGeneration = engine.generation();
+    _lastRevision = engine.revision();
+}
+
+void LifeHistory::applyDeltas(const Segment& segment, size_t begin, size_t end, std::vector<uint64_t>& board) const
+{
+    const size_t tilesX = _wordsPerRow;
+    const size_t from = begin < segment.marks.size() ? segment.marks[begin].offset : segment.deltas.size();
+    const size_t to = end < segment.marks.size() ? segment.marks[end].offset : segment.deltas.size();
+    for (size_t i = from; i < to;)
+    {
+        const size_t tile = (size_t)segment.deltas[i];
+        const size_t tx = tile % tilesX, y0 = tile / tilesX * kTileRows;
+        const uint64_t rows = segment.deltas[i + 1];
+        const uint64_t* words = &segment.deltas[i + 2];
+        for (uint64_t mask = rows; mask; mask &= mask - 1)
+            board[(y0 + (size_t)__builtin_ctzll(mask)) * _wordsPerRow + tx] ^= *words++;
+        i += 2 + (size_t)__builtin_popcountll(rows);
+    }
+}
+
+void LifeHistory::truncateAfterCursor()
+{
+    while (_segments.size() > _cursorSegment + 1)
+    {
+        _bytes -= segmentBytes(_segments.back());
+        _segments.pop_back();
+    }
+    Segment& segment = _segments.back();
+    _bytes -= segmentBytes(segment);
+    if (_cursorMarks < segment.marks.size())
+    {
+        segment.deltas.resize(segment.marks[_cursorMarks].offset);
+        segment.marks.resize(_cursorMarks);
+    }
+    _bytes += segmentBytes(segment);
+    _seeked = false;
+}
+
+void LifeHistory::trim()
+{
+    while (_bytes > _budgetBytes && _segments.size() > 1)
+    {
+        _bytes -= segmentBytes(_segments.front());
+        _segments.pop_front();
+    }
+}
+
+void LifeHistory::record(const LifeEngine& engine)
+{
+    const uint64_t generation = engine.generation();
+    if (_segments.empty() || engine.width() != _width || engine.height() != _height || generation < _lastGeneration)
+    {
+        clear();
+        startSegment(engine);
+        return;
+    }
+
+    // Nothing new, e.g. straight after a seek: the future is kept for further scrubbing.
+    bool changed = generation != _lastGeneration;
+    for (uint32_t ty = 0; ty < engine.tilesY() && !changed; ++ty)
+        for (uint32_t tx = 0; tx < engine.tilesX() && !changed; ++tx)
+            changed = engine.tileRevision(tx, ty) > _lastRevision;
+    if (!changed)
+        return;
+    if (_seeked)
+        truncateAfterCursor();
+
+    if (generation / _keyframeInterval != _lastGeneration / _keyframeInterval)
+        startSegment(engine);
+    else
+        appendDelta(engine);
+    trim();
+}
+
+bool LifeHistory::seek(uint64_t generation, LifeEngine& engine)
+{
+    if (_segments.empty() || generation < oldestGeneration() || generation > newestGeneration()
+        || engine.width() != _width || engine.height() != _height)
+        return (false);
+
+    // Segments are contiguous and ordered: the last one starting at or before the target.
+    const size_t index = (size_t)(std::upper_bound(_segments.begin(), _segments.end(), generation,
+        [](uint64_t g, const Segment& segment) { return (g < segment.generation); }) - _segments.begin()) - 1;
+    const Segment& segment = _segments[index];
+    const size_t marks = (size_t)(std::upper_bound(segment.marks.begin(), segment.marks.end(), generation,
+        [](uint64_t g, const Mark& mark) { return (g < mark.generation); }) - segment.marks.begin());
+
+    _shadow = segment.keyframe;
+    applyDeltas(segment, 0, marks, _shadow);
+    engine.writeRows(0, _height, _shadow.data(), _wordsPerRow);
+    engine.setGeneration(generation);
+
+    _lastGeneration = generation;
+    _lastRevision = engine.revision();
+    _seeked = true;
+    _cursorSegment = index;
+    _cursorMarks = marks;
+    return (true);
+}
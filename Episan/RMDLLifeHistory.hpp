@@ -0,0 +1,102 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: RMDLLifeHistory.hpp           +++     +++     **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 19/10/2026 18:47:20      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef RMDLLIFEHISTORY_HPP
+# define RMDLLIFEHISTORY_HPP
+
+# include <cstddef>
+# include <cstdint>
+# include <deque>
+# include <vector>
+
+# include "NonCopyable.h"
+# include "RMDLLifeEngine.hpp"
+
+/// Rewind buffer for a LifeEngine board. Every keyframeInterval()
+/// generations the packed board is stored whole; in between, each recorded
+/// generation (or edit) keeps only the tiles the engine stamped, as the XOR
+/// of their words with the previous record, and of those only the non-zero
+/// rows: a tile index, a 64-bit row mask and the rows it selects. Segments
+/// (a keyframe and its deltas) are dropped oldest first to stay within
+/// budgetBytes().
+/// seek() restores the nearest keyframe at or before the target and XORs at
+/// most keyframeInterval() deltas into it. Recording after a seek cuts the
+/// history there, like an undo stack; seeking alone keeps it, so a paused
+/// board can be scrubbed back and forth.
+class LifeHistory : public NonCopyable
+{
+public:
+    static constexpr uint32_t kDefaultKeyframeInterval = 64;
+    static constexpr size_t kDefaultBudgetBytes = (size_t)64 << 20;
+
+    explicit LifeHistory(uint32_t keyframeInterval = kDefaultKeyframeInterval, size_t budgetBytes = kDefaultBudgetBytes);
+
+    uint32_t    keyframeInterval() const    { return _keyframeInterval; }
+    size_t      budgetBytes() const         { return _budgetBytes; }
+    void        setBudgetBytes(size_t budgetBytes);
+
+    void        clear();
+    bool        empty() const               { return _segments.empty(); }
+    size_t      bytes() const               { return _bytes; }
+    /// Recorded generation range; both 0 when empty.
+    uint64_t    oldestGeneration() const;
+    uint64_t    newestGeneration() const;
+
+    /// Records the engine's board at its current generation. Call after
+    /// every step and every edit; a generation going backwards or a board of
+    /// another size starts the history over.
+    void        record(const LifeEngine& engine);
+    /// Puts the board of `generation` (edits made at it included) back into
+    /// `engine`. False, engine untouched, when it is not in the history.
+    bool        seek(uint64_t generation, LifeEngine& engine);
+
+private:
+    struct Mark
+    {
+        uint64_t    generation;
+        size_t      offset;         // into Segment::deltas
+    };
+
+    struct Segment
+    {
+        uint64_t                generation;
+        std::vector<uint64_t>   keyframe;   // wordsPerRow * height, halo bits cleared
+        std::vector<uint64_t>   deltas;
+        std::vector<Mark>       marks;      // one per recorded delta, in order
+    };
+
+    size_t      segmentBytes(const Segment& segment) const;
+    void        startSegment(const LifeEngine& engine);
+    void        appendDelta(const LifeEngine& engine);
+    void        applyDeltas(const Segment& segment, size_t begin, size_t end, std::vector<uint64_t>& board) const;
+    void        truncateAfterCursor();
+    void        trim();
+
+    uint32_t                _keyframeInterval;
+    size_t                  _budgetBytes;
+    std::deque<Segment>     _segments;
+    size_t                  _bytes;
+
+    // The board as of the last record, to XOR against.
+    std::vector<uint64_t>   _shadow;
+    uint32_t                _width;
+    uint32_t                _height;
+    size_t                  _wordsPerRow;
+    uint64_t                _lastMask;
+    uint64_t                _lastGeneration;
+    uint64_t                _lastRevision;
+
+    // Where the last seek landed, until the next record cuts the history there.
+    bool                    _seeked;
+    size_t                  _cursorSegment;
+    size_t                  _cursorMarks;   // marks of that segment still in use
+};
+
+#endif /* RMDLLIFEHISTORY_HPP */
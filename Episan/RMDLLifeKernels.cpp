@@ -0,0 +1,238 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: RMDLLifeKernels.cpp            +++     +++    **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 17/10/2026 10:12:35      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include "RMDLLifeKernels.hpp"
+
+#if defined(__AVX2__)
+# define RMDL_LIFE_HAS_AVX2 1
+# include <immintrin.h>
+#endif
+
+#if defined(__ARM_NEON)
+# define RMDL_LIFE_HAS_NEON 1
+# include <arm_neon.h>
+#endif
+
+namespace life_kernels
+{
+
+template <typename V, typename Broadcast>
+static inline void makeMasks(const LifeRule& rule, RuleMasks<V>& masks, Broadcast broadcast)
+{
+    for (int k = 0; k <= 8; ++k)
+    {
+        masks.birth[k] = broadcast((rule.birth >> k) & 1 ? ~uint64_t(0) : 0);
+        masks.survive[k] = broadcast((rule.survive >> k) & 1 ? ~uint64_t(0) : 0);
+    }
+}
+
+template <class Rule>
+static void stepRowScalar(const uint64_t* above, const uint64_t* row, const uint64_t* below, uint64_t* out, size_t words, const LifeRule& rule)
+{
+    RuleMasks<uint64_t> masks;
+    if constexpr (Rule::kRuntime)
+        makeMasks(rule, masks, [](uint64_t v) { return v; });
+
+    for (size_t i = 0; i < words; ++i)
+    {
+        const uint64_t n = above[i];
+        const uint64_t c = row[i];
+        const uint64_t s = below[i];
+        out[i] = Rule::apply(west(above[i - 1], n), n, east(n, above[i + 1]),
+                             west(row[i - 1], c),   c, east(c, row[i + 1]),
+                             west(below[i - 1], s), s, east(s, below[i + 1]), &masks);
+    }
+}
+
+#if RMDL_LIFE_HAS_AVX2
+
+static inline __m256i westAVX2(const uint64_t* p)
+{
+    __m256i cur = _mm256_loadu_si256((const __m256i*)p);
+    __m256i prev = _mm256_loadu_si256((const __m256i*)(p - 1));
+    return _mm256_or_si256(_mm256_slli_epi64(cur, 1), _mm256_srli_epi64(prev, 63));
+}
+
+static inline __m256i eastAVX2(const uint64_t* p)
+{
+    __m256i cur = _mm256_loadu_si256((const __m256i*)p);
+    __m256i next = _mm256_loadu_si256((const __m256i*)(p + 1));
+    return _mm256_or_si256(_mm256_srli_epi64(cur, 1), _mm256_slli_epi64(next, 63));
+}
+
+template <class Rule>
+static void stepRowAVX2(const uint64_t* above, const uint64_t* row, const uint64_t* below, uint64_t* out, size_t words, const LifeRule& rule)
+{
+    auto masks = ruleMasksFor(_mm256_setzero_si256());
+    if constexpr (Rule::kRuntime)
+        makeMasks(rule, masks, [](uint64_t v) { return _mm256_set1_epi64x((long long)v); });
+
+    size_t i = 0;
+    for (; i + 4 <= words; i += 4)
+    {
+        __m256i r = Rule::apply(westAVX2(above + i), _mm256_loadu_si256((const __m256i*)(above + i)), eastAVX2(above + i),
+                                westAVX2(row + i),   _mm256_loadu_si256((const __m256i*)(row + i)),   eastAVX2(row + i),
+                                westAVX2(below + i), _mm256_loadu_si256((const __m256i*)(below + i)), eastAVX2(below + i), &masks);
+        _mm256_storeu_si256((__m256i*)(out + i), r);
+    }
+    stepRowScalar<Rule>(above + i, row + i, below + i, out + i, words - i, rule);
+}
+
+#else
+
+template <class Rule>
+static void stepRowAVX2(const uint64_t* above, const uint64_t* row, const uint64_t* below, uint64_t* out, size_t words, const LifeRule& rule)
+{
+    stepRowScalar<Rule>(above, row, below, out, words, rule);
+}
+
+#endif
+
+#if RMDL_LIFE_HAS_NEON
+
+static inline uint64x2_t westNEON(const uint64_t* p)
+{
+    return vorrq_u64(vshlq_n_u64(vld1q_u64(p), 1), vshrq_n_u64(vld1q_u64(p - 1), 63));
+}
+
+static inline uint64x2_t eastNEON(const uint64_t* p)
+{
+    return vorrq_u64(vshrq_n_u64(vld1q_u64(p), 1), vshlq_n_u64(vld1q_u64(p + 1), 63));
+}
+
+template <class Rule>
+static void stepRowNEON(const uint64_t* above, const uint64_t* row, const uint64_t* below, uint64_t* out, size_t words, const LifeRule& rule)
+{
+    RuleMasks<uint64x2_t> masks;
+    if constexpr (Rule::kRuntime)
+        makeMasks(rule, masks, [](uint64_t v) { return vdupq_n_u64(v); });
+
+    size_t i = 0;
+    for (; i + 2 <= words; i += 2)
+    {
+        uint64x2_t r = Rule::apply(westNEON(above + i), vld1q_u64(above + i), eastNEON(above + i),
+                                   westNEON(row + i),   vld1q_u64(row + i),   eastNEON(row + i),
+                                   westNEON(below + i), vld1q_u64(below + i), eastNEON(below + i), &masks);
+        vst1q_u64(out + i, r);
+    }
+    stepRowScalar<Rule>(above + i, row + i, below + i, out + i, words - i, rule);
+}
+
+#else
+
+template <class Rule>
+static void stepRowNEON(const uint64_t* above, const uint64_t* row, const uint64_t* below, uint64_t* out, size_t words, const LifeRule& rule)
+{
+    stepRowScalar<Rule>(above, row, below, out, words, rule);
+}
+
+#endif
+
+struct KernelEntry
+{
+    uint16_t    birth;
+    uint16_t    survive;
+    StepRowFn   fn[3];      // indexed by LifeKernel
+};
+
+template <uint16_t Birth, uint16_t Survive>
+static constexpr KernelEntry entry()
+{
+    return { Birth, Survive, { &stepRowScalar<FixedRule<Birth, Survive>>,
+                               &stepRowAVX2<FixedRule<Birth, Survive>>,
+                               &stepRowNEON<FixedRule<Birth, Survive>> } };
+}
+
+#define B(n) (1 << (n))
+
+// Common rules get their own instantiation; everything else goes through RuntimeRule.
+static const KernelEntry kSpecialised[] =
+{
+    entry<B(3),                      B(2) | B(3)>(),                                    // Conway
+    entry<B(3) | B(6),               B(2) | B(3)>(),                                    // HighLife
+    entry<B(3) | B(6) | B(7) | B(8), B(3) | B(4) | B(6) | B(7) | B(8)>(),               // Day & Night
+    entry<B(2),                      0>(),                                              // Seeds
+    entry<B(3),                      0x1FF>(),                                          // Life without death
+    entry<B(3),                      B(1) | B(2) | B(3) | B(4) | B(5)>(),               // Maze
+    entry<B(1) | B(3) | B(5) | B(7), B(1) | B(3) | B(5) | B(7)>(),                      // Replicator
+    entry<B(3) | B(6),               B(1) | B(2) | B(5)>(),                             // 2x2
+    entry<B(3) | B(6) | B(8),        B(2) | B(4) | B(5)>(),                             // Morley
+    entry<B(3) | B(7),               B(2) | B(3)>(),                                    // DryLife
+};
+
+static const StepRowFn kRuntime[3] =
+{
+    &stepRowScalar<RuntimeRule>,
+    &stepRowAVX2<RuntimeRule>,
+    &stepRowNEON<RuntimeRule>
+};
+
+#undef B
+
+bool available(LifeKernel kernel)
+{
+    switch (kernel)
+    {
+        case LifeKernel::Scalar:
+            return (true);
+        case LifeKernel::AVX2:
+#if RMDL_LIFE_HAS_AVX2
+            return (true);
+#else
+            return (false);
+#endif
+        case LifeKernel::NEON:
+#if RMDL_LIFE_HAS_NEON
+            return (true);
+#else
+            return (false);
+#endif
+    }
+    return (false);
+}
+
+LifeKernel best()
+{
+    if (available(LifeKernel::NEON))
+        return (LifeKernel::NEON);
+    if (available(LifeKernel::AVX2))
+        return (LifeKernel::AVX2);
+    return (LifeKernel::Scalar);
+}
+
+StepRowFn stepRowFunction(LifeKernel kernel, const LifeRule& rule)
+{
+    const int k = available(kernel) ? (int)kernel : (int)LifeKernel::Scalar;
+    for (const KernelEntry& e : kSpecialised)
+        if (e.birth == rule.birth && e.survive == rule.survive)
+            return (e.fn[k]);
+    return (kRuntime[k]);
+}
+
+bool isSpecialised(const LifeRule& rule)
+{
+    for (const KernelEntry& e : kSpecialised)
+        if (e.birth == rule.birth && e.survive == rule.survive)
+            return (true);
+    return (false);
+}
+
+const char* name(LifeKernel kernel)
+{
+    switch (kernel)
+    {
+        case LifeKernel::Scalar: return ("scalar");
+        case LifeKernel::AVX2:   return ("avx2");
+        case LifeKernel::NEON:   return ("neon");
+    }
+    return ("unknown");
+}
+
+}
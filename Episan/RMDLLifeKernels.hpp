@@ -0,0 +1,182 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: RMDLLifeKernels.hpp            +++     +++    **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 17/10/2026 10:12:31      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef RMDLLIFEKERNELS_HPP
+# define RMDLLIFEKERNELS_HPP
+
+# include <cstddef>
+# include <cstdint>
+
+# include "RMDLLifeRule.hpp"
+
+enum class LifeKernel
+{
+    Scalar,
+    AVX2,
+    NEON
+};
+
+namespace life_kernels
+{
+    // Bit i of a packed word is cell x = 64 * word + i.
+    // West neighbours move up one bit, east neighbours move down one bit.
+    inline uint64_t west(uint64_t prev, uint64_t cur) { return (cur << 1) | (prev >> 63); }
+    inline uint64_t east(uint64_t cur, uint64_t next) { return (cur >> 1) | (next << 63); }
+
+    /// Bit-sliced B3/S23 on 64 (or 256, 128...) cells at once.
+    /// Works for any type with bitwise operators: uint64_t, __m256i, uint64x2_t.
+    template <typename V>
+    inline V conway(V nw, V n, V ne, V w, V c, V e, V sw, V s, V se)
+    {
+        // Each row of three collapses to a 2-bit count (full adders),
+        // the middle row only has two neighbours (half adder).
+        V tx = nw ^ n;
+        V t0 = tx ^ ne;
+        V t1 = (nw & n) | (tx & ne);
+        V m0 = w ^ e;
+        V m1 = w & e;
+        V bx = sw ^ s;
+        V b0 = bx ^ se;
+        V b1 = (sw & s) | (bx & se);
+
+        // Add the three 2-bit counts: bit 0, bit 1 and the two carries into bit 2.
+        V x0 = t0 ^ m0;
+        V s0 = x0 ^ b0;
+        V k0 = (t0 & m0) | (x0 & b0);
+        V x1 = t1 ^ m1;
+        V y1 = x1 ^ b1;
+        V k1 = (t1 & m1) | (x1 & b1);
+        V s1 = y1 ^ k0;
+        V k2 = y1 & k0;
+
+        // count is 2 or 3 <=> s1 && no carry into bit 2; 3 births, 2 only survives.
+        return s1 & ~(k1 | k2) & (s0 | c);
+    }
+
+    /// Full neighbour count (0..8) as four bit-planes.
+    template <typename V>
+    inline void countPlanes(V nw, V n, V ne, V w, V e, V sw, V s, V se, V& s0, V& s1, V& s2, V& s3)
+    {
+        V tx = nw ^ n;
+        V t0 = tx ^ ne;
+        V t1 = (nw & n) | (tx & ne);
+        V m0 = w ^ e;
+        V m1 = w & e;
+        V bx = sw ^ s;
+        V b0 = bx ^ se;
+        V b1 = (sw & s) | (bx & se);
+
+        V x0 = t0 ^ m0;
+        s0 = x0 ^ b0;
+        V k0 = (t0 & m0) | (x0 & b0);
+        V x1 = t1 ^ m1;
+        V y1 = x1 ^ b1;
+        V k1 = (t1 & m1) | (x1 & b1);
+        s1 = y1 ^ k0;
+        V k2 = y1 & k0;
+        s2 = k1 ^ k2;
+        s3 = k1 & k2;
+    }
+
+    /// Cells whose count is exactly n. Only 8 sets s3, and then s0..s2 are clear.
+    template <typename V>
+    inline V countIs(int n, V s0, V s1, V s2, V s3)
+    {
+        if (n == 8)
+            return (s3);
+        return (((n & 1) ? s0 : ~s0) & ((n & 2) ? s1 : ~s1) & ((n & 4) ? s2 : ~s2) & ~s3);
+    }
+
+    /// Per-count masks for rules only known at run time: all ones where the rule sets the bit.
+    template <typename V>
+    struct RuleMasks
+    {
+        V   birth[9];
+        V   survive[9];
+    };
+
+    /// Zeroed masks for the vector type of `like`. Deduced rather than spelled:
+    /// GCC warns on RuleMasks<__m256i>, whose may_alias attribute it drops.
+    template <typename V>
+    inline RuleMasks<V> ruleMasksFor(V like)
+    {
+        (void)like;
+        return (RuleMasks<V>());
+    }
+
+    /// Rule fixed at compile time: the count tests fold into a handful of gates.
+    template <uint16_t Birth, uint16_t Survive>
+    struct FixedRule
+    {
+        static constexpr bool kRuntime = false;
+
+        template <typename V>
+        static inline V apply(V nw, V n, V ne, V w, V c, V e, V sw, V s, V se, const RuleMasks<V>*)
+        {
+            V s0, s1, s2, s3;
+            countPlanes(nw, n, ne, w, e, sw, s, se, s0, s1, s2, s3);
+            V born = c ^ c;
+            V kept = c ^ c;
+            for (int k = 0; k <= 8; ++k)
+            {
+                if (Birth & (1 << k))
+                    born = born | countIs(k, s0, s1, s2, s3);
+                if (Survive & (1 << k))
+                    kept = kept | countIs(k, s0, s1, s2, s3);
+            }
+            return ((born & ~c) | (kept & c));
+        }
+    };
+
+    /// B3/S23 keeps the hand-reduced adder.
+    template <>
+    struct FixedRule<(1 << 3), (1 << 2) | (1 << 3)>
+    {
+        static constexpr bool kRuntime = false;
+
+        template <typename V>
+        static inline V apply(V nw, V n, V ne, V w, V c, V e, V sw, V s, V se, const RuleMasks<V>*)
+        {
+            return (conway(nw, n, ne, w, c, e, sw, s, se));
+        }
+    };
+
+    /// Any other two-state rule: nine masked count tests, still no per-cell branch.
+    struct RuntimeRule
+    {
+        static constexpr bool kRuntime = true;
+
+        template <typename V>
+        static inline V apply(V nw, V n, V ne, V w, V c, V e, V sw, V s, V se, const RuleMasks<V>* masks)
+        {
+            V s0, s1, s2, s3;
+            countPlanes(nw, n, ne, w, e, sw, s, se, s0, s1, s2, s3);
+            V next = c ^ c;
+            for (int k = 0; k <= 8; ++k)
+                next = next | (countIs(k, s0, s1, s2, s3) & ((masks->birth[k] & ~c) | (masks->survive[k] & c)));
+            return (next);
+        }
+    };
+
+    /// Advances `words` packed words of one row.
+    /// above/row/below point at the first word; index -1 and `words` must be readable (halo).
+    typedef void (*StepRowFn)(const uint64_t* above, const uint64_t* row, const uint64_t* below,
+                              uint64_t* out, size_t words, const LifeRule& rule);
+
+    bool        available(LifeKernel kernel);
+    LifeKernel  best();
+    /// Specialised instantiation when the rule is one of the common ones, RuntimeRule otherwise.
+    /// Only two-state rules can be packed one bit per cell.
+    StepRowFn   stepRowFunction(LifeKernel kernel, const LifeRule& rule = LifeRule::conway());
+    bool        isSpecialised(const LifeRule& rule);
+    const char* name(LifeKernel kernel);
+}
+
+#endif /* RMDLLIFEKERNELS_HPP */
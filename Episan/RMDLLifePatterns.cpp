@@ -0,0 +1,91 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: RMDLLifePatterns.cpp          +++     +++     **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 18/10/2026 10:22:44      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include <algorithm>
+
+#include "RMDLLifePatterns.hpp"
+
+namespace life_patterns
+{
+
+static const uint8_t kGunPattern[17][9] = {
+    {1,0,1,0,1,0,1,1,1},
+    {1,0,1,0,0,0,1,0,0},
+    {1,0,1,0,1,0,0,1,0},
+    {0,1,0,0,1,1,1,0,0},
+    {1,0,0,0,0,0,1,1,0},
+    {1,1,0,0,0,1,1,0,1},
+    {0,1,1,0,0,0,0,1,0},
+    {1,0,0,1,1,1,1,1,1},
+    {0,1,1,1,1,1,1,1,1},
+    {0,0,1,1,1,0,0,1,1},
+    {0,0,0,1,1,1,0,1,0},
+    {0,0,0,1,0,1,1,1,0},
+    {0,0,0,1,0,1,1,0,1},
+    {0,0,0,1,1,1,1,1,0},
+    {0,0,0,0,0,1,1,1,0},
+    {1,1,0,1,0,1,1,1,0},
+    {1,1,0,1,1,1,1,0,1} };
+
+void seedGun(const JDLVState& state, uint32_t* grid)
+{
+    const int startX = (int)state.width / 2 - 4;
+    const int startY = (int)state.height / 2 - 8;
+
+    for (int y = 0; y < 17; y++)
+    {
+        for (int x = 0; x < 9; x++)
+        {
+            const int gridX = startX + x;
+            const int gridY = startY + y;
+            if (gridX >= 0 && gridX < (int)state.width && gridY >= 0 && gridY < (int)state.height)
+                grid[(size_t)gridY * state.width + gridX] = kGunPattern[y][x];
+        }
+    }
+}
+
+void seedSoup(const JDLVState& state, uint32_t* grid, double density, uint64_t seed)
+{
+    const uint64_t threshold = (uint64_t)(std::min(std::max(density, 0.0), 1.0) * 4294967296.0);
+    const size_t cells = (size_t)state.width * state.height;
+    for (size_t i = 0; i < cells; i += 2)
+    {
+        // Two cells per draw, 32 bits each.
+        const uint64_t r = splitMix64(seed);
+        grid[i] = (r & 0xFFFFFFFF) < threshold;
+        if (i + 1 < cells)
+            grid[i + 1] = (r >> 32) < threshold;
+    }
+}
+
+void seedGliders(const JDLVState& state, uint32_t* grid, uint32_t spacing, uint64_t seed)
+{
+    // South-east glider; the other three directions are mirrors of it.
+    static const uint8_t kGlider[3][3] = { {0,1,0}, {0,0,1}, {1,1,1} };
+    spacing = std::max<uint32_t>(spacing, 8);
+
+    for (uint32_t by = 0; by + 3 <= state.height; by += spacing)
+    {
+        for (uint32_t bx = 0; bx + 3 <= state.width; bx += spacing)
+        {
+            const uint64_t r = splitMix64(seed);
+            const uint32_t slack = spacing - 3;
+            const uint32_t ox = std::min<uint32_t>(bx + (uint32_t)(r % (slack + 1)), state.width - 3);
+            const uint32_t oy = std::min<uint32_t>(by + (uint32_t)((r >> 16) % (slack + 1)), state.height - 3);
+            const bool flipX = (r >> 32) & 1;
+            const bool flipY = (r >> 33) & 1;
+            for (uint32_t y = 0; y < 3; ++y)
+                for (uint32_t x = 0; x < 3; ++x)
+                    grid[(size_t)(oy + y) * state.width + ox + x] = kGlider[flipY ? 2 - y : y][flipX ? 2 - x : x];
+        }
+    }
+}
+
+}
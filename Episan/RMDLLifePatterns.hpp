@@ -0,0 +1,39 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: RMDLLifePatterns.hpp          +++     +++     **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 18/10/2026 10:22:40      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef RMDLLIFEPATTERNS_HPP
+# define RMDLLIFEPATTERNS_HPP
+
+# include <cstdint>
+
+# include "JDLV_shared.h"
+
+/// Deterministic seeds for a JDLV grid (one uint32_t per cell, row-major).
+/// Same seed, same board, on every machine: the benchmarks hash the result.
+namespace life_patterns
+{
+    /// SplitMix64: tiny, fast and good enough to scatter cells.
+    inline uint64_t splitMix64(uint64_t& state)
+    {
+        uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return (z ^ (z >> 31));
+    }
+
+    /// The 9x17 block GameCoordinator::initGrid has always started from, centred.
+    void    seedGun(const JDLVState& state, uint32_t* grid);
+    /// Each cell alive with probability `density`.
+    void    seedSoup(const JDLVState& state, uint32_t* grid, double density, uint64_t seed);
+    /// One glider per `spacing` x `spacing` cell block, random phase and direction.
+    void    seedGliders(const JDLVState& state, uint32_t* grid, uint32_t spacing, uint64_t seed);
+}
+
+#endif /* RMDLLIFEPATTERNS_HPP */
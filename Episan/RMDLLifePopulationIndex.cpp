@@ -0,0 +1,115 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: RMDLLifePopulationIndex.cpp     +++     +++   **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 18/10/2026 18:21:44      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include <algorithm>
+
+#include "RMDLLifePopulationIndex.hpp"
+
+LifePopulationIndex::LifePopulationIndex()
+    : _engine(nullptr)
+    , _engineRevision(0)
+    , _tilesX(0)
+    , _tilesY(0)
+{
+}
+
+void LifePopulationIndex::update(const LifeEngine& engine)
+{
+    if (&engine == _engine && engine.revision() == _engineRevision
+        && engine.tilesX() == _tilesX && engine.tilesY() == _tilesY)
+        return;
+
+    _engine = &engine;
+    _engineRevision = engine.revision();
+    _tilesX = engine.tilesX();
+    _tilesY = engine.tilesY();
+
+    const size_t pitch = (size_t)_tilesX + 1;
+    _table.assign(pitch * (_tilesY + 1), 0);
+    for (uint32_t ty = 0; ty < _tilesY; ++ty)
+    {
+        uint64_t rowSum = 0;
+        for (uint32_t tx = 0; tx < _tilesX; ++tx)
+        {
+            rowSum += engine.tilePopulation(tx, ty);
+            _table[(ty + 1) * pitch + tx + 1] = _table[ty * pitch + tx + 1] + rowSum;
+        }
+    }
+}
+
+uint64_t LifePopulationIndex::tileCount(const LifeEngine& engine, uint32_t tx0, uint32_t ty0, uint32_t tx1, uint32_t ty1)
+{
+    update(engine);
+    tx1 = std::min(tx1, _tilesX);
+    ty1 = std::min(ty1, _tilesY);
+    if (tx0 >= tx1 || ty0 >= ty1)
+        return (0);
+
+    const size_t pitch = (size_t)_tilesX + 1;
+    return (_table[ty1 * pitch + tx1] - _table[ty0 * pitch + tx1]
+            - _table[ty1 * pitch + tx0] + _table[ty0 * pitch + tx0]);
+}
+
+uint64_t LifePopulationIndex::rowCount(const LifeEngine& engine, uint32_t y, uint32_t x0, uint32_t x1)
+{
+    if (x0 >= x1)
+        return (0);
+
+    // x1 <= width, so the side halo bit in the last word is never inside the mask.
+    const uint64_t* r = engine.row((int32_t)y);
+    const uint32_t w0 = x0 >> 6;
+    const uint32_t w1 = (x1 - 1) >> 6;
+    const uint64_t head = ~uint64_t(0) << (x0 & 63);
+    const uint64_t tail = ~uint64_t(0) >> (63 - ((x1 - 1) & 63));
+    if (w0 == w1)
+        return (__builtin_popcountll(r[w0] & head & tail));
+
+    uint64_t count = __builtin_popcountll(r[w0] & head) + __builtin_popcountll(r[w1] & tail);
+    for (uint32_t w = w0 + 1; w < w1; ++w)
+        count += __builtin_popcountll(r[w]);
+    return (count);
+}
+
+uint64_t LifePopulationIndex::count(const LifeEngine& engine, uint32_t x, uint32_t y, uint32_t width, uint32_t height)
+{
+    const uint32_t x1 = (uint32_t)std::min<uint64_t>((uint64_t)x + width, engine.width());
+    const uint32_t y1 = (uint32_t)std::min<uint64_t>((uint64_t)y + height, engine.height());
+    if (x >= x1 || y >= y1)
+        return (0);
+
+    // Tiles the rectangle covers whole; the last tile row or column only counts
+    // when the rectangle reaches the board edge it is cut off by.
+    const uint32_t rows = LifeEngine::kTileRows;
+    const uint32_t tx0 = (x + 63) >> 6;
+    const uint32_t tx1 = (x1 == engine.width()) ? engine.tilesX() : (x1 >> 6);
+    const uint32_t ty0 = (y + rows - 1) / rows;
+    const uint32_t ty1 = (y1 == engine.height()) ? engine.tilesY() : (y1 / rows);
+    if (tx0 >= tx1 || ty0 >= ty1)
+    {
+        uint64_t total = 0;
+        for (uint32_t row = y; row < y1; ++row)
+            total += rowCount(engine, row, x, x1);
+        return (total);
+    }
+
+    const uint32_t innerX0 = tx0 << 6;
+    const uint32_t innerX1 = std::min(tx1 << 6, x1);
+    const uint32_t innerY0 = ty0 * rows;
+    const uint32_t innerY1 = std::min(ty1 * rows, y1);
+
+    uint64_t total = tileCount(engine, tx0, ty0, tx1, ty1);
+    for (uint32_t row = y; row < innerY0; ++row)
+        total += rowCount(engine, row, x, x1);
+    for (uint32_t row = innerY0; row < innerY1; ++row)
+        total += rowCount(engine, row, x, innerX0) + rowCount(engine, row, innerX1, x1);
+    for (uint32_t row = innerY1; row < y1; ++row)
+        total += rowCount(engine, row, x, x1);
+    return (total);
+}
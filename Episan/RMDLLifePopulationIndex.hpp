@@ -0,0 +1,48 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: RMDLLifePopulationIndex.hpp     +++     +++   **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 18/10/2026 18:21:37      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef RMDLLIFEPOPULATIONINDEX_HPP
+# define RMDLLIFEPOPULATIONINDEX_HPP
+
+# include <cstdint>
+# include <vector>
+
+# include "RMDLLifeEngine.hpp"
+
+/// Population of any rectangle of a LifeEngine board. A summed-area table
+/// over the engine's per-tile counts answers the 64x64 tiles the rectangle
+/// covers whole in O(1); only the ragged border, at most one word per row
+/// on the sides and 63 rows top and bottom, is popcounted from the cells.
+/// The table is rebuilt from the tile counts, O(tiles), the first time it
+/// is queried after the engine's revision moved.
+class LifePopulationIndex : public NonCopyable
+{
+public:
+    LifePopulationIndex();
+
+    /// Live cells in [x, x + width) x [y, y + height), clipped to the board.
+    uint64_t    count(const LifeEngine& engine, uint32_t x, uint32_t y, uint32_t width, uint32_t height);
+
+    /// Live cells in tiles [tx0, tx1) x [ty0, ty1).
+    uint64_t    tileCount(const LifeEngine& engine, uint32_t tx0, uint32_t ty0, uint32_t tx1, uint32_t ty1);
+
+private:
+    void        update(const LifeEngine& engine);
+    /// Live cells of row y in [x0, x1).
+    static uint64_t rowCount(const LifeEngine& engine, uint32_t y, uint32_t x0, uint32_t x1);
+
+    std::vector<uint64_t>   _table;     // (tilesY + 1) x (tilesX + 1), zero first row and column
+    const LifeEngine*       _engine;
+    uint64_t                _engineRevision;
+    uint32_t                _tilesX;
+    uint32_t                _tilesY;
+};
+
+#endif /* RMDLLIFEPOPULATIONINDEX_HPP */
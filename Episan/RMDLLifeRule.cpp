@@ -0,0 +1,112 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: RMDLLifeRule.cpp            +++     +++       **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 18/10/2026 09:31:27      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include <cctype>
+#include <vector>
+
+#include "RMDLLifeRule.hpp"
+
+static bool parseDigits(const std::string& field, uint16_t& mask)
+{
+    mask = 0;
+    for (char c : field)
+    {
+        if (c < '0' || c > '8')
+            return (false);
+        mask |= 1 << (c - '0');
+    }
+    return (true);
+}
+
+static bool parseCount(const std::string& field, uint32_t& states)
+{
+    if (field.empty() || field.size() > 3)
+        return (false);
+    states = 0;
+    for (char c : field)
+    {
+        if (!isdigit((unsigned char)c))
+            return (false);
+        states = states * 10 + (uint32_t)(c - '0');
+    }
+    return (states >= 2 && states <= 256);
+}
+
+bool LifeRule::parse(const std::string& text, LifeRule& rule)
+{
+    std::vector<std::string> fields(1);
+    for (char c : text)
+    {
+        if (c == '/')
+            fields.emplace_back();
+        else if (!isspace((unsigned char)c))
+            fields.back() += (char)toupper((unsigned char)c);
+    }
+    if (fields.size() < 2 || fields.size() > 3)
+        return (false);
+
+    LifeRule out = { 0, 0, 2 };
+    const bool tagged = !fields[0].empty() && (fields[0][0] == 'B' || fields[0][0] == 'S');
+    if (tagged)
+    {
+        bool seenB = false, seenS = false;
+        for (size_t i = 0; i < fields.size(); ++i)
+        {
+            const std::string& f = fields[i];
+            if (!f.empty() && f[0] == 'B' && !seenB)
+            {
+                seenB = true;
+                if (!parseDigits(f.substr(1), out.birth))
+                    return (false);
+            }
+            else if (!f.empty() && f[0] == 'S' && !seenS)
+            {
+                seenS = true;
+                if (!parseDigits(f.substr(1), out.survive))
+                    return (false);
+            }
+            else if (i == 2)
+            {
+                const bool prefixed = !f.empty() && (f[0] == 'C' || f[0] == 'G');
+                if (!parseCount(prefixed ? f.substr(1) : f, out.states))
+                    return (false);
+            }
+            else
+                return (false);
+        }
+        if (!seenB || !seenS)
+            return (false);
+    }
+    else
+    {
+        // Golly legacy order: survive/birth[/states].
+        if (!parseDigits(fields[0], out.survive) || !parseDigits(fields[1], out.birth))
+            return (false);
+        if (fields.size() == 3 && !parseCount(fields[2], out.states))
+            return (false);
+    }
+    rule = out;
+    return (true);
+}
+
+std::string LifeRule::toString() const
+{
+    std::string text = "B";
+    for (int n = 0; n <= 8; ++n)
+        if (birth & (1 << n))
+            text += (char)('0' + n);
+    text += "/S";
+    for (int n = 0; n <= 8; ++n)
+        if (survive & (1 << n))
+            text += (char)('0' + n);
+    if (states > 2)
+        text += "/C" + std::to_string(states);
+    return (text);
+}
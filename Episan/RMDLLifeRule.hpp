@@ -0,0 +1,41 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: RMDLLifeRule.hpp            +++     +++       **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 18/10/2026 09:31:22      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef RMDLLIFERULE_HPP
+# define RMDLLIFERULE_HPP
+
+# include <cstdint>
+# include <string>
+
+/// Outer-totalistic Moore rule: bit n of `birth` / `survive` is set when a
+/// dead / live cell with n live neighbours is alive next generation.
+/// `states` > 2 is a Generations rule: live cells that do not survive
+/// age through states 2 .. states - 1 before dying, and only state 1 counts
+/// as a live neighbour.
+struct LifeRule
+{
+    uint16_t    birth;
+    uint16_t    survive;
+    uint32_t    states;
+
+    static LifeRule conway() { return { 1 << 3, (1 << 2) | (1 << 3), 2 }; }
+
+    /// Accepts "B3/S23", "S23/B3", "B2/S/C3", "B2/S/3" and the legacy "23/3" and "345/2/4" (S/B[/C]).
+    static bool parse(const std::string& text, LifeRule& rule);
+    std::string toString() const;
+
+    bool        isTwoState() const      { return (states == 2); }
+    bool        bornFromNothing() const { return (birth & 1); }
+
+    bool operator==(const LifeRule& rhs) const { return (birth == rhs.birth && survive == rhs.survive && states == rhs.states); }
+    bool operator!=(const LifeRule& rhs) const { return (!(*this == rhs)); }
+};
+
+#endif /* RMDLLIFERULE_HPP */
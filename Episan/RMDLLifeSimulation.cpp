@@ -0,0 +1,493 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: RMDLLifeSimulation.cpp        +++     +++     **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 18/10/2026 14:12:13      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+
+#include "RMDLLifeBoard.hpp"
+#include "RMDLLifeSimulation.hpp"
+
+typedef std::chrono::steady_clock SimulationClock;
+
+// Stepping is cut into batches so queued tasks and publishes are never far away.
+static constexpr uint64_t kMaxBatch = 64;
+// Falling further behind than this drops the debt instead of spiralling.
+static constexpr double kMaxLagSeconds = 0.25;
+
+static size_t tileCount(const JDLVState& state)
+{
+    const size_t tilesX = (state.width + LifeFrame::kTileSize - 1) / LifeFrame::kTileSize;
+    const size_t tilesY = (state.height + LifeFrame::kTileSize - 1) / LifeFrame::kTileSize;
+    return (tilesX * tilesY);
+}
+
+static LifeFrame blankFrame(const JDLVState& state)
+{
+    LifeFrame frame;
+    frame.state = state;
+    frame.generation = 0;
+    frame.serial = 0;
+    frame.population = 0;
+    frame.grid.assign((size_t)state.width * state.height, 0);
+    frame.tileSerial.assign(tileCount(state), 0);
+    frame.density.reset(state);
+    return (frame);
+}
+
+void LifeFrame::dirtyRanges(uint64_t since, std::vector<LifeGridRange>& ranges) const
+{
+    ranges.clear();
+    const uint32_t width = state.width, height = state.height;
+    const uint32_t tilesX = (width + kTileSize - 1) / kTileSize;
+    for (uint32_t y = 0; y < height; ++y)
+    {
+        const uint64_t* serials = &tileSerial[(size_t)(y / kTileSize) * tilesX];
+        for (uint32_t tx = 0; tx < tilesX;)
+        {
+            if (serials[tx] <= since)
+            {
+                ++tx;
+                continue;
+            }
+            const uint32_t first = tx;
+            while (tx < tilesX && serials[tx] > since)
+                ++tx;
+            const size_t begin = ((size_t)y * width + first * kTileSize) * sizeof(uint32_t);
+            const size_t end = ((size_t)y * width + std::min(tx * kTileSize, width)) * sizeof(uint32_t);
+            if (!ranges.empty() && ranges.back().offset + ranges.back().length == begin)
+                ranges.back().length += end - begin;
+            else
+                ranges.push_back({ begin, end - begin });
+        }
+    }
+}
+
+LifeSimulation::LifeSimulation(const JDLVState& state)
+    : _engine(state)
+    , _serial(0)
+    , _dirty(false)
+    , _resync(true)
+    , _touchAll(false)
+    , _publishedRevision(_engine.revision())
+    , _tileSerial(tileCount(state), 0)
+    , _frames(blankFrame(state))
+    , _generationsPerSecond(kDefaultGenerationsPerSecond)
+    , _publishRate(kDefaultPublishRate)
+    , _paused(false)
+    , _generation(0)
+    , _settled(false)
+    , _historyOldest(0)
+    , _historyNewest(0)
+    , _stop(false)
+{
+}
+
+LifeSimulation::~LifeSimulation()
+{
+    stop();
+}
+
+void LifeSimulation::start()
+{
+    if (running())
+        return;
+    _stop = false;
+    _thread = std::thread(&LifeSimulation::threadMain, this);
+}
+
+void LifeSimulation::stop()
+{
+    if (!running())
+        return;
+    {
+        std::lock_guard<std::mutex> guard(_taskLock);
+        _stop = true;
+    }
+    _wake.notify_all();
+    _thread.join();
+    if (_eventLog)
+    {
+        _eventLog->end(boardGeneration());
+        _eventLog.reset();
+    }
+}
+
+void LifeSimulation::post(std::function<void()> task)
+{
+    {
+        std::lock_guard<std::mutex> guard(_taskLock);
+        _tasks.push_back(std::move(task));
+    }
+    _wake.notify_all();
+}
+
+void LifeSimulation::edit(LifeEdit edit)
+{
+    if (!_edits.push(std::move(edit)))
+        return;
+    // First edit since the last drain: the thread may be asleep. Taking the
+    // lock orders the push before its wait predicate, so the wake is not lost.
+    {
+        std::lock_guard<std::mutex> guard(_taskLock);
+    }
+    _wake.notify_all();
+}
+
+void LifeSimulation::setHistory(uint32_t keyframeInterval, size_t budgetBytes)
+{
+    post([this, keyframeInterval, budgetBytes]
+    {
+        if (keyframeInterval == 0)
+            _history.reset();
+        else if (!_history || _history->keyframeInterval() != keyframeInterval)
+            _history.reset(new LifeHistory(keyframeInterval, budgetBytes));
+        else
+            _history->setBudgetBytes(budgetBytes);
+    });
+}
+
+void LifeSimulation::seekHistory(uint64_t generation)
+{
+    post([this, generation]
+    {
+        if (!_history || _multiState || !_history->seek(generation, _engine))
+        {
+            printf("LifeSimulation: generation %llu is not in the history\n", (unsigned long long)generation);
+            return;
+        }
+        _generation.store(generation, std::memory_order_relaxed);
+        _dirty = true;
+        if (_eventLog)
+        {
+            std::vector<uint32_t> grid((size_t)_engine.width() * _engine.height());
+            _engine.exportGrid(grid.data());
+            _eventLog->grid(generation, grid.data());
+        }
+    });
+}
+
+void LifeSimulation::setEventLog(std::shared_ptr<LifeEventLog> log)
+{
+    post([this, log]
+    {
+        if (_eventLog)
+            _eventLog->end(boardGeneration());
+        _eventLog = log;
+        if (_eventLog)
+            logBoard();
+    });
+}
+
+uint64_t LifeSimulation::boardGeneration() const
+{
+    return (_multiState ? _multiState->generation() : _engine.generation());
+}
+
+// The starting point a replay needs: topology, rule, then the cells.
+void LifeSimulation::logBoard()
+{
+    const uint64_t generation = boardGeneration();
+    _eventLog->topology(generation, _engine.topology(), _engine.state().paddingState);
+    if (_multiState)
+        _eventLog->ruleTable(generation, _multiState->table());
+    else
+        _eventLog->rule(generation, _engine.rule());
+    std::vector<uint32_t> grid((size_t)_engine.width() * _engine.height());
+    life_board::exportGrid(_engine, _multiState.get(), grid.data());
+    _eventLog->grid(generation, grid.data());
+}
+
+void LifeSimulation::setGenerationsPerSecond(double generationsPerSecond)
+{
+    _generationsPerSecond.store(std::max(generationsPerSecond, 0.0));
+    post([this] { _resync = true; });
+}
+
+void LifeSimulation::setPaused(bool paused)
+{
+    _paused.store(paused);
+    post([this] { _resync = true; });
+}
+
+bool LifeSimulation::setRule(const LifeRule& rule)
+{
+    if (rule.states < 2 || rule.bornFromNothing())
+    {
+        printf("LifeSimulation: rule %s is not supported\n", rule.toString().c_str());
+        return (false);
+    }
+    post([this, rule]
+    {
+        if (_eventLog)
+            _eventLog->rule(boardGeneration(), rule);
+        applyRule(rule);
+    });
+    return (true);
+}
+
+void LifeSimulation::setRuleTable(const RuleTable& table)
+{
+    post([this, table]
+    {
+        if (_eventLog)
+            _eventLog->ruleTable(boardGeneration(), table);
+        applyRuleTable(table);
+    });
+}
+
+void LifeSimulation::setTopology(JDLVTopology topology, uint32_t paddingState)
+{
+    post([this, topology, paddingState]
+    {
+        if (_eventLog)
+            _eventLog->topology(boardGeneration(), topology, paddingState);
+        life_board::setTopology(_engine, _multiState.get(), topology, paddingState);
+        _dirty = true;
+    });
+}
+
+void LifeSimulation::loadGrid(const uint32_t* grid, uint64_t generation)
+{
+    std::shared_ptr<std::vector<uint32_t>> copy = std::make_shared<std::vector<uint32_t>>(
+        grid, grid + (size_t)_engine.width() * _engine.height());
+    post([this, copy, generation]
+    {
+        life_board::importGrid(_engine, _multiState.get(), copy->data(), generation);
+        _touchAll |= _multiState != nullptr;
+        _generation.store(generation, std::memory_order_relaxed);
+        _dirty = true;
+        if (_eventLog)
+            _eventLog->grid(generation, copy->data());
+    });
+}
+
+void LifeSimulation::applyRule(const LifeRule& rule)
+{
+    life_board::applyRule(_engine, _multiState, rule);
+    _touchAll |= _multiState != nullptr;
+    _dirty = true;
+}
+
+void LifeSimulation::applyRuleTable(const RuleTable& table)
+{
+    life_board::applyRuleTable(_engine, _multiState, table);
+    _touchAll = true;
+    _dirty = true;
+}
+
+void LifeSimulation::stepBoard(uint64_t generations)
+{
+    if (_multiState)
+    {
+        _multiState->step(generations);
+        _generation.store(_multiState->generation(), std::memory_order_relaxed);
+        _touchAll = true;
+        _dirty = true;
+        return;
+    }
+
+    const uint64_t target = _engine.generation() + generations;
+    while (_engine.generation() < target)
+    {
+        if (_settled.load(std::memory_order_relaxed))
+        {
+            _engine.setGeneration(target);
+            recordHistory();
+            break;
+        }
+        _engine.step();
+        recordHistory();
+        const LifeCycleDetector::State state = _detector.observe(_engine);
+        if (state == LifeCycleDetector::State::Extinct || state == LifeCycleDetector::State::StillLife)
+            _settled.store(true, std::memory_order_relaxed);
+    }
+    _generation.store(_engine.generation(), std::memory_order_relaxed);
+    _dirty = true;
+}
+
+void LifeSimulation::publish()
+{
+    LifeFrame& frame = _frames.back();
+    // This slot's grid and density still hold publish `since`.
+    const uint64_t since = frame.serial;
+    frame.state = _engine.state();
+    frame.serial = ++_serial;
+
+    // The packed engine stamps the tiles it changes; the byte engine is marked by hand.
+    if (_touchAll)
+        std::fill(_tileSerial.begin(), _tileSerial.end(), _serial);
+    else if (!_multiState)
+    {
+        const uint32_t tilesX = _engine.tilesX(), tilesY = _engine.tilesY();
+        for (uint32_t ty = 0; ty < tilesY; ++ty)
+            for (uint32_t tx = 0; tx < tilesX; ++tx)
+                if (_engine.tileRevision(tx, ty) > _publishedRevision)
+                    _tileSerial[(size_t)ty * tilesX + tx] = _serial;
+    }
+    _publishedRevision = _engine.revision();
+    _touchAll = false;
+    frame.tileSerial = _tileSerial;
+
+    if (_multiState)
+    {
+        frame.generation = _multiState->generation();
+        _multiState->exportGrid(frame.grid.data());
+        frame.population = std::count(frame.grid.begin(), frame.grid.end(), 1u);
+    }
+    else
+    {
+        frame.generation = _engine.generation();
+        frame.population = _engine.population();
+        _engine.exportGrid(frame.grid.data());
+    }
+    frame.density.update(frame.state, frame.grid.data(), _tileSerial, since);
+    _frames.publish();
+    _dirty = false;
+}
+
+void LifeSimulation::runTasks()
+{
+    std::vector<std::function<void()>> tasks;
+    {
+        std::lock_guard<std::mutex> guard(_taskLock);
+        tasks.swap(_tasks);
+    }
+    for (std::function<void()>& task : tasks)
+        task();
+    const bool edited = applyEdits();
+    // Any task may have touched the board: look for a still life afresh.
+    if (!tasks.empty() || edited)
+    {
+        recordHistory();
+        _detector.reset();
+        _settled.store(false, std::memory_order_relaxed);
+    }
+}
+
+void LifeSimulation::recordHistory()
+{
+    if (!_history)
+    {
+        _historyOldest.store(0, std::memory_order_relaxed);
+        _historyNewest.store(0, std::memory_order_relaxed);
+        return;
+    }
+    // Only the packed board is recorded; a multi-state run starts the history over.
+    if (_multiState)
+        _history->clear();
+    else
+        _history->record(_engine);
+    _historyOldest.store(_history->oldestGeneration(), std::memory_order_relaxed);
+    _historyNewest.store(_history->newestGeneration(), std::memory_order_relaxed);
+}
+
+bool LifeSimulation::applyEdits()
+{
+    _editBatch.clear();
+    if (_edits.drain(_editBatch) == 0)
+        return (false);
+
+    const uint32_t width = _engine.width(), height = _engine.height();
+    const uint32_t tilesX = (width + LifeFrame::kTileSize - 1) / LifeFrame::kTileSize;
+    for (const LifeEdit& edit : _editBatch)
+    {
+        if (_eventLog)
+            _eventLog->edit(boardGeneration(), edit);
+        edit.forEachSpan(width, height, [&](uint32_t y, uint32_t x0, uint32_t x1, uint32_t state)
+        {
+            life_board::fillSpan(_engine, _multiState.get(), y, x0, x1, state);
+            if (!_multiState)
+                return;
+            uint64_t* serials = &_tileSerial[(size_t)(y / LifeFrame::kTileSize) * tilesX];
+            for (uint32_t tx = x0 / LifeFrame::kTileSize; tx <= (x1 - 1) / LifeFrame::kTileSize; ++tx)
+                serials[tx] = _serial + 1;
+        });
+    }
+    _editBatch.clear();
+    _dirty = true;
+    return (true);
+}
+
+void LifeSimulation::threadMain()
+{
+    SimulationClock::time_point epoch = SimulationClock::now();
+    SimulationClock::time_point lastPublish = epoch;
+    uint64_t stepped = 0;     // generations since epoch
+
+    for (;;)
+    {
+        runTasks();
+
+        const SimulationClock::time_point now = SimulationClock::now();
+        const double publishRate = _publishRate.load();
+        const bool publishDue = publishRate <= 0 || now - lastPublish >= std::chrono::duration<double>(1.0 / publishRate);
+        if (_dirty && (publishDue || _paused.load()))
+        {
+            publish();
+            lastPublish = now;
+        }
+
+        if (_resync)
+        {
+            epoch = now;
+            stepped = 0;
+            _resync = false;
+        }
+
+        // Work out how many generations are due, or how long to sleep.
+        const double generationsPerSecond = _generationsPerSecond.load();
+        uint64_t due = 0;
+        SimulationClock::time_point wakeAt = SimulationClock::time_point::max();
+        if (!_paused.load())
+        {
+            if (generationsPerSecond <= 0)
+                due = kMaxBatch;
+            else
+            {
+                const double elapsed = std::chrono::duration<double>(now - epoch).count();
+                const uint64_t target = (uint64_t)(elapsed * generationsPerSecond);
+                if (target > stepped + (uint64_t)(kMaxLagSeconds * generationsPerSecond) + 1)
+                {
+                    epoch = now;
+                    stepped = 0;
+                    due = 1;
+                }
+                else if (target > stepped)
+                    due = std::min(target - stepped, kMaxBatch);
+                else
+                    wakeAt = epoch + std::chrono::duration_cast<SimulationClock::duration>(
+                        std::chrono::duration<double>((stepped + 1) / generationsPerSecond));
+            }
+        }
+        if (_dirty && publishRate > 0 && due == 0)
+            wakeAt = std::min(wakeAt, lastPublish + std::chrono::duration_cast<SimulationClock::duration>(
+                std::chrono::duration<double>(1.0 / publishRate)));
+
+        if (due > 0)
+        {
+            stepBoard(due);
+            stepped += due;
+            std::lock_guard<std::mutex> guard(_taskLock);
+            if (_stop)
+                return;
+            continue;
+        }
+
+        std::unique_lock<std::mutex> guard(_taskLock);
+        const auto woken = [this] { return (_stop || !_tasks.empty() || !_edits.empty()); };
+        if (wakeAt == SimulationClock::time_point::max())
+            _wake.wait(guard, woken);
+        else
+            _wake.wait_until(guard, wakeAt, woken);
+        if (_stop)
+            return;
+    }
+}
@@ -0,0 +1,175 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: RMDLLifeSimulation.hpp        +++     +++     **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 18/10/2026 14:12:07      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef RMDLLIFESIMULATION_HPP
+# define RMDLLIFESIMULATION_HPP
+
+# include <atomic>
+# include <condition_variable>
+# include <cstdint>
+# include <functional>
+# include <memory>
+# include <mutex>
+# include <thread>
+# include <vector>
+
+# include "JDLV_shared.h"
+# include "NonCopyable.h"
+# include "RMDLLifeCycleDetector.hpp"
+# include "RMDLLifeDensityPyramid.hpp"
+# include "RMDLLifeEditQueue.hpp"
+# include "RMDLLifeEventLog.hpp"
+# include "RMDLLifeEngine.hpp"
+# include "RMDLLifeHistory.hpp"
+# include "RMDLRuleTableEngine.hpp"
+# include "RMDLTripleBuffer.hpp"
+
+/// Bytes of LifeFrame::grid.
+struct LifeGridRange
+{
+    size_t  offset;
+    size_t  length;
+};
+
+/// A finished generation as the renderer sees it: the JDLV grid layout
+/// (one uint32_t per cell) plus the state it was stepped under.
+struct LifeFrame
+{
+    static constexpr uint32_t kTileSize = LifeEngine::kTileRows;
+
+    JDLVState               state;
+    uint64_t                generation;
+    uint64_t                serial;     // bumped by every publish, 0 before the first
+    uint64_t                population; // live cells; on a multi-state board, cells in state 1
+    std::vector<uint32_t>   grid;
+    std::vector<uint64_t>   tileSerial; // per 64x64 tile, row-major: the publish that last changed it
+    LifeDensityPyramid      density;    // live counts of grid, kept in step with it tile by tile
+
+    /// Replaces `ranges` with the bytes of grid that changed after publish
+    /// `since`, row runs of dirty tiles, adjacent runs merged.
+    void    dirtyRanges(uint64_t since, std::vector<LifeGridRange>& ranges) const;
+};
+
+/// Owns the authoritative board and steps it on its own thread at a fixed
+/// rate, independent of the display. Finished generations are handed to the
+/// renderer through a TripleBuffer, at most publishRate() times per second,
+/// so neither side ever waits for the other.
+/// Two-state rules run on the packed LifeEngine; Generations rules and
+/// rule tables (WireWorld, Golly .rule files) on the byte-per-cell
+/// RuleTableEngine. Every setter is queued and applied on the simulation
+/// thread between generations.
+/// Brush strokes, stamps and clears go through a lock-free LifeEditQueue
+/// instead, so painting never takes the lock the stepper sleeps on; they
+/// land as span writes into the tiles they cover, and each published frame
+/// says which tiles changed so the renderer only uploads those.
+/// Once a two-state board dies out or becomes a still life it is no longer
+/// stepped: only the generation count moves, until the next edit.
+/// With a history set, every generation and edit of a two-state board is
+/// recorded into a LifeHistory and seekHistory() rewinds to any of them.
+/// With an event log set, every board change is logged by the simulation
+/// thread with the generation it lands at, after a snapshot of the board.
+class LifeSimulation : public NonCopyable
+{
+public:
+    static constexpr double kDefaultGenerationsPerSecond = 60.0;
+    static constexpr double kDefaultPublishRate = 240.0;
+
+    explicit LifeSimulation(const JDLVState& state);
+    ~LifeSimulation();
+
+    void        start();
+    void        stop();
+    bool        running() const                 { return _thread.joinable(); }
+
+    /// 0 steps as fast as the CPU allows.
+    void        setGenerationsPerSecond(double generationsPerSecond);
+    double      generationsPerSecond() const    { return _generationsPerSecond.load(); }
+    void        setPaused(bool paused);
+    bool        paused() const                  { return _paused.load(); }
+    void        setPublishRate(double framesPerSecond) { _publishRate.store(framesPerSecond); }
+    double      publishRate() const             { return _publishRate.load(); }
+
+    bool        setRule(const LifeRule& rule);
+    /// Runs `table` on the byte-per-cell engine until the next setRule.
+    void        setRuleTable(const RuleTable& table);
+    void        setTopology(JDLVTopology topology, uint32_t paddingState = 0);
+    /// Replaces the board (width x height cells, JDLV layout).
+    void        loadGrid(const uint32_t* grid, uint64_t generation = 0);
+    /// Runs `task` on the simulation thread between generations.
+    void        post(std::function<void()> task);
+    /// Queues a brush stroke, stamp or clear for the next gap between generations.
+    void        edit(LifeEdit edit);
+
+    /// Keeps a rewind history of two-state boards; an interval of 0 turns it off.
+    void        setHistory(uint32_t keyframeInterval, size_t budgetBytes = LifeHistory::kDefaultBudgetBytes);
+    /// Puts the board back as it was at `generation`; stepping on from there
+    /// drops the generations after it. Pause first to scrub.
+    void        seekHistory(uint64_t generation);
+    /// Generations seekHistory() can reach; both 0 without a history.
+    uint64_t    historyOldest() const           { return _historyOldest.load(std::memory_order_relaxed); }
+    uint64_t    historyNewest() const           { return _historyNewest.load(std::memory_order_relaxed); }
+
+    /// Logs the board, rule and topology, then every change, to `log`; null
+    /// ends the session with an End event.
+    void        setEventLog(std::shared_ptr<LifeEventLog> log);
+
+    /// Generations stepped so far, as seen from any thread.
+    uint64_t    generation() const              { return _generation.load(std::memory_order_relaxed); }
+    /// True while the board is extinct or a still life and stepping is skipped.
+    bool        settled() const                 { return _settled.load(std::memory_order_relaxed); }
+
+    /// Renderer side: true when frame() now holds a newer generation.
+    bool        acquireFrame()                  { return _frames.update(); }
+    const LifeFrame& frame() const              { return _frames.front(); }
+
+private:
+    void        threadMain();
+    void        runTasks();
+    bool        applyEdits();
+    void        recordHistory();
+    uint64_t    boardGeneration() const;
+    void        logBoard();
+    void        applyRule(const LifeRule& rule);
+    void        applyRuleTable(const RuleTable& table);
+    void        stepBoard(uint64_t generations);
+    void        publish();
+
+    // Owned by the simulation thread once started.
+    LifeEngine                      _engine;
+    std::unique_ptr<RuleTableEngine> _multiState;   // set while a Generations rule or a rule table runs
+    LifeCycleDetector               _detector;
+    uint64_t                        _serial;
+    bool                            _dirty;
+    bool                            _resync;        // restart the step clock
+    bool                            _touchAll;      // every tile changed since the last publish
+    uint64_t                        _publishedRevision; // _engine.revision() at the last publish
+    std::vector<uint64_t>           _tileSerial;
+    std::vector<LifeEdit>           _editBatch;
+    std::unique_ptr<LifeHistory>    _history;
+    std::shared_ptr<LifeEventLog>   _eventLog;
+
+    TripleBuffer<LifeFrame>         _frames;
+    std::atomic<double>             _generationsPerSecond;
+    std::atomic<double>             _publishRate;
+    std::atomic<bool>               _paused;
+    std::atomic<uint64_t>           _generation;
+    std::atomic<bool>               _settled;
+    std::atomic<uint64_t>           _historyOldest;
+    std::atomic<uint64_t>           _historyNewest;
+
+    std::thread                     _thread;
+    std::mutex                      _taskLock;
+    std::condition_variable         _wake;
+    std::vector<std::function<void()>> _tasks;
+    bool                            _stop;
+    LifeEditQueue                   _edits;
+};
+
+#endif /* RMDLLIFESIMULATION_HPP */
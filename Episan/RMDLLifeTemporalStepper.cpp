@@ -0,0 +1,287 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: RMDLLifeTemporalStepper.cpp     +++     +++   **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 18/10/2026 15:20:40      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <unistd.h>
+#if defined(__APPLE__)
+# include <sys/sysctl.h>
+#endif
+
+#include "RMDLLifeTemporalStepper.hpp"
+#include "RMDLLifeTopology.hpp"
+
+static constexpr uint32_t kMaxDepth = 16;
+// A block's halo is one word either side of its tile, which covers kMaxDepth generations.
+static_assert(kMaxDepth <= 64, "deeper passes need wider tile halos");
+
+LifeTemporalStepper::LifeTemporalStepper(uint32_t depth, size_t cacheBytes)
+    : _depthHint(std::min(depth, kMaxDepth))
+    , _cacheBytes(cacheBytes ? cacheBytes : cacheSize())
+    , _depth(0)
+    , _bandRows(0)
+    , _tileWords(0)
+    , _width(0)
+    , _height(0)
+    , _stride(0)
+    , _rowWords(0)
+    , _state()
+    , _pending(0)
+{
+}
+
+LifeTemporalStepper::~LifeTemporalStepper()
+{
+}
+
+size_t LifeTemporalStepper::cacheSize()
+{
+    size_t bytes = 0;
+#if defined(__APPLE__)
+    // Apple silicon reports the performance cluster's L2, shared by its cores.
+    uint64_t value = 0;
+    size_t length = sizeof(value);
+    if (sysctlbyname("hw.perflevel0.l2cachesize", &value, &length, nullptr, 0) == 0 && value)
+    {
+        uint64_t cores = 0;
+        length = sizeof(cores);
+        if (sysctlbyname("hw.perflevel0.cpusperl2", &cores, &length, nullptr, 0) == 0 && cores > 1)
+            value /= cores;
+        bytes = (size_t)value;
+    }
+    else if (length = sizeof(value), sysctlbyname("hw.l2cachesize", &value, &length, nullptr, 0) == 0)
+        bytes = (size_t)value;
+#elif defined(_SC_LEVEL2_CACHE_SIZE)
+    const long value = sysconf(_SC_LEVEL2_CACHE_SIZE);
+    if (value > 0)
+        bytes = (size_t)value;
+#endif
+    return (bytes ? bytes : 512 * 1024);
+}
+
+void LifeTemporalStepper::layout(const LifeEngine& engine, uint32_t workers)
+{
+    if (engine.width() == _width && engine.height() == _height && _scratch.size() == workers)
+        return;
+
+    _width = engine.width();
+    _height = engine.height();
+    _stride = engine.stride();
+    const size_t words = engine.wordsPerRow();
+
+    // Half the cache for the two scratch buffers; the rest is for the board rows
+    // streaming through and whatever else lives there. Tiles are cut so that a
+    // block of the deepest wanted pass still fits: about 6 * depth rows.
+    const size_t budget = _cacheBytes / 2 / (2 * sizeof(uint64_t));
+    const uint32_t wanted = _depthHint ? _depthHint : kMaxDepth;
+    const size_t tileWords = std::max<size_t>(12, budget / (6 * wanted)) - 4;
+
+    _columns.clear();
+    if (words < 2 * tileWords)
+    {
+        _tileWords = words;
+        _rowWords = words + 2;
+        Column column = {};
+        column.pieces[0] = { 0, words, 0, words, 1 };
+        column.pieceCount = 1;
+        column.edges = true;
+        _columns.push_back(column);
+    }
+    else
+    {
+        // The first and last half tiles make one block, so its side halo sees both ends of each row.
+        _tileWords = tileWords;
+        _rowWords = tileWords + 4;
+        const size_t west = tileWords / 2, east = tileWords - west;
+        const size_t eastFirst = words - east;
+        Column seam = {};
+        seam.pieces[0] = { 0, west + 1, 0, west, 1 };
+        seam.pieces[1] = { eastFirst - 1, east + 1, eastFirst, east, west + 2 };
+        seam.pieceCount = 2;
+        seam.edges = true;
+        _columns.push_back(seam);
+
+        // The words between in near-equal tiles, each loaded with the word either side.
+        const size_t inner = eastFirst - west;
+        const size_t tiles = (inner + tileWords - 1) / tileWords;
+        for (size_t t = 0; t < tiles; ++t)
+        {
+            const size_t x0 = west + inner * t / tiles, x1 = west + inner * (t + 1) / tiles;
+            Column column = {};
+            column.pieces[0] = { x0 - 1, x1 - x0 + 2, x0, x1 - x0, 1 };
+            column.pieceCount = 1;
+            _columns.push_back(column);
+        }
+    }
+
+    const uint32_t rowsFit = (uint32_t)std::max<size_t>(6, budget / _rowWords);
+    // Bands of four times the depth keep the redundant halo work near 2 * depth / bandRows.
+    _depth = _depthHint ? _depthHint : std::min<uint32_t>(kMaxDepth, std::max<uint32_t>(1, rowsFit / 6));
+    _bandRows = std::max<uint32_t>(_depth, rowsFit > 2 * _depth ? rowsFit - 2 * _depth : _depth);
+    _bandRows = std::min(_bandRows, std::max<uint32_t>(1, _height));
+
+    _scratch.resize(workers);
+    for (Scratch& scratch : _scratch)
+        scratch.mirrored.assign(words, 0);
+    for (int b = 0; b < 2; ++b)
+    {
+        for (Scratch& scratch : _scratch)
+            scratch.rows[b].assign((size_t)(_bandRows + 2 * _depth) * _rowWords, 0);
+        _boards[b].assign((size_t)_height * _stride, 0);
+        _edge[b].assign(_stride, 0);
+    }
+}
+
+// A piece of row y of the unrolled board, y possibly far outside [0, height):
+// wrapped on a torus, wrapped and mirrored once per seam crossed on a Klein
+// bottle, the constant edge row otherwise.
+void LifeTemporalStepper::loadRow(const LifeEngine& engine, Scratch& scratch, const uint64_t* board, int64_t y,
+                                  const Piece& piece, uint64_t* dst)
+{
+    const size_t bytes = piece.count * sizeof(uint64_t);
+    const int64_t height = (int64_t)_height;
+
+    if (y >= 0 && y < height)
+    {
+        memcpy(dst, board + (size_t)y * _stride + piece.first, bytes);
+        return;
+    }
+    if (!life_topology::wrapsVertically(_state))
+    {
+        memcpy(dst, _edge[y < 0 ? 0 : 1].data() + 1 + piece.first, bytes);
+        return;
+    }
+    const int64_t turns = y < 0 ? -((-y + height - 1) / height) : y / height;
+    const uint64_t* src = board + (size_t)(y - turns * height) * _stride;
+    if (_state.topology == JDLVTopologyKleinBottle && (turns & 1))
+    {
+        // Mirroring moves cells across the row: the piece comes from the other end.
+        life_topology::mirrorRow(src, scratch.mirrored.data(), engine.wordsPerRow(), _width);
+        src = scratch.mirrored.data();
+    }
+    memcpy(dst, src + piece.first, bytes);
+}
+
+void LifeTemporalStepper::stepBlock(const LifeEngine& engine, Scratch& scratch, const uint64_t* board, uint64_t* out,
+                                    uint32_t y0, uint32_t rows, const Column& column, uint32_t depth)
+{
+    const size_t words = engine.wordsPerRow();
+    const uint64_t lastMask = engine.lastWordMask();
+    const life_kernels::StepRowFn stepRow = engine.stepRowFunction();
+    const LifeRule& rule = engine.rule();
+    const bool wraps = life_topology::wrapsVertically(_state);
+    const uint32_t total = rows + 2 * depth;
+    const Piece* pieces = column.pieces;
+    const Piece& eastPiece = pieces[column.pieceCount - 1];
+
+    // Scratch row i is board row y0 - depth + i. Rows outside a plane or padded
+    // board never change, so both buffers get them and they are never stepped.
+    for (uint32_t i = 0; i < total; ++i)
+    {
+        const int64_t y = (int64_t)y0 - depth + i;
+        for (uint32_t p = 0; p < column.pieceCount; ++p)
+            loadRow(engine, scratch, board, y, pieces[p], scratchRow(scratch, 0, i) + pieces[p].offset);
+        if (!wraps && (y < 0 || y >= (int64_t)_height))
+            memcpy(scratchRow(scratch, 1, i), scratchRow(scratch, 0, i), _rowWords * sizeof(uint64_t));
+    }
+
+    // Cells next to a tile's halo word go stale one per generation, but never past that word.
+    const uint32_t firstFixed = wraps ? total : (uint32_t)std::max<int64_t>(0, (int64_t)_height - y0 + depth);
+    const uint32_t lastFixed = wraps ? 0 : (uint32_t)std::max<int64_t>(0, (int64_t)depth - y0);
+    for (uint32_t s = 1; s <= depth; ++s)
+    {
+        const uint32_t src = (s - 1) & 1;
+        const uint32_t dst = src ^ 1;
+        // Rows s - 1 .. total - s are read this generation.
+        for (uint32_t i = s - 1; column.edges && i <= total - s; ++i)
+        {
+            uint64_t* row = scratchRow(scratch, src, i);
+            life_topology::fillSideHalo(row + pieces[0].offset, row + eastPiece.offset, eastPiece.first, _state);
+        }
+        const uint32_t begin = std::max(s, lastFixed);
+        const uint32_t end = std::min(total - s, firstFixed);
+        for (uint32_t i = begin; i < end; ++i)
+        {
+            for (uint32_t p = 0; p < column.pieceCount; ++p)
+            {
+                const uint64_t* r = scratchRow(scratch, src, i) + pieces[p].offset;
+                uint64_t* o = scratchRow(scratch, dst, i) + pieces[p].offset;
+                stepRow(r - _rowWords, r, r + _rowWords, o, pieces[p].count, rule);
+                if (pieces[p].first + pieces[p].count == words)
+                    o[pieces[p].count - 1] &= lastMask;
+            }
+        }
+    }
+
+    const uint32_t result = depth & 1;
+    for (uint32_t y = 0; y < rows; ++y)
+        for (uint32_t p = 0; p < column.pieceCount; ++p)
+            memcpy(out + (size_t)(y0 + y) * _stride + pieces[p].keep,
+                   scratchRow(scratch, result, depth + y) + pieces[p].offset + (pieces[p].keep - pieces[p].first),
+                   pieces[p].keepCount * sizeof(uint64_t));
+}
+
+void LifeTemporalStepper::run(LifeEngine& engine, uint64_t generations, WorkStealingPool* pool)
+{
+    assert(!pool || pool->currentWorker() < 0);
+    if (generations == 0 || engine.height() == 0)
+        return;
+
+    layout(engine, pool ? pool->threadCount() : 1);
+    _state = engine.state();
+    engine.fillHalo();
+    memcpy(_edge[0].data(), engine.row(-1) - 1, _stride * sizeof(uint64_t));
+    memcpy(_edge[1].data(), engine.row((int32_t)_height) - 1, _stride * sizeof(uint64_t));
+
+    // The first pass reads the engine in place; the rest ping-pong between our boards.
+    const uint64_t* board = engine.row(0);
+    const uint32_t columns = (uint32_t)_columns.size();
+    uint32_t target = 0;
+    for (uint64_t done = 0; done < generations; )
+    {
+        const uint32_t depth = (uint32_t)std::min<uint64_t>(_depth, generations - done);
+        uint64_t* out = _boards[target].data() + 1;
+        if (!pool)
+        {
+            for (uint32_t y0 = 0; y0 < _height; y0 += _bandRows)
+                for (uint32_t c = 0; c < columns; ++c)
+                    stepBlock(engine, _scratch[0], board, out, y0, std::min(_bandRows, _height - y0), _columns[c], depth);
+        }
+        else
+        {
+            // Blocks of a pass only share the board they read, so a pass is one fork and one join.
+            _pending.store((_height + _bandRows - 1) / _bandRows * columns);
+            for (uint32_t y0 = 0; y0 < _height; y0 += _bandRows)
+            {
+                for (uint32_t c = 0; c < columns; ++c)
+                {
+                    pool->submit([this, pool, &engine, board, out, y0, c, depth]
+                    {
+                        stepBlock(engine, _scratch[pool->currentWorker()], board, out,
+                                  y0, std::min(_bandRows, _height - y0), _columns[c], depth);
+                        // Under the lock, or run() could return and free the stepper before the notify.
+                        std::lock_guard<std::mutex> guard(_doneLock);
+                        if (_pending.fetch_sub(1) == 1)
+                            _doneSignal.notify_all();
+                    });
+                }
+            }
+            std::unique_lock<std::mutex> guard(_doneLock);
+            _doneSignal.wait(guard, [this] { return (_pending.load() == 0); });
+        }
+        board = out;
+        target ^= 1;
+        done += depth;
+    }
+
+    engine.writeRows(0, _height, board, _stride);
+    engine.setGeneration(engine.generation() + generations);
+}
@@ -0,0 +1,105 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: RMDLLifeTemporalStepper.hpp     +++     +++   **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 18/10/2026 15:20:33      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef RMDLLIFETEMPORALSTEPPER_HPP
+# define RMDLLIFETEMPORALSTEPPER_HPP
+
+# include <atomic>
+# include <condition_variable>
+# include <cstddef>
+# include <cstdint>
+# include <mutex>
+# include <vector>
+
+# include "RMDLLifeEngine.hpp"
+# include "RMDLWorkStealingPool.hpp"
+
+/// Temporally blocked stepping of a LifeEngine. The board is cut into
+/// blocks of rows by column tiles; each block is loaded with `depth` extra
+/// rows above and below and one extra word (64 cells) either side into a
+/// cache-sized scratch, advanced `depth` generations there (the valid region
+/// shrinks by one cell per generation) and written back once. DRAM sees the
+/// board about twice per `depth` generations instead of twice per
+/// generation, for some redundant work on the overlapping cells.
+/// Tiles are only as narrow as the cache needs for a deep block, so narrow
+/// boards keep full-width bands; on wider ones the first and last tiles
+/// share a block, whose side halo is then filled as on a full row.
+/// With a pool the blocks of a pass run in parallel, one scratch per worker.
+class LifeTemporalStepper : public NonCopyable
+{
+public:
+    /// depth == 0 and cacheBytes == 0 are picked from the CPU's L2 size.
+    explicit LifeTemporalStepper(uint32_t depth = 0, size_t cacheBytes = 0);
+    ~LifeTemporalStepper();
+
+    /// Not callable from a pool worker.
+    void        run(LifeEngine& engine, uint64_t generations, WorkStealingPool* pool = nullptr);
+
+    /// Generations per pass, interior rows per band and words per column tile
+    /// (the whole row on a narrow board), as chosen for the last board.
+    uint32_t    depth() const       { return _depth; }
+    uint32_t    bandRows() const    { return _bandRows; }
+    size_t      tileWords() const   { return _tileWords; }
+
+    /// Per-core L2 data cache size, or a conservative guess.
+    static size_t   cacheSize();
+
+private:
+    // Board words [first, first + count) of a block row, stored from `offset` of a scratch row.
+    struct Piece
+    {
+        size_t  first;
+        size_t  count;
+        size_t  keep;           // words [keep, keep + keepCount) are written back
+        size_t  keepCount;
+        size_t  offset;
+    };
+
+    struct Column
+    {
+        Piece       pieces[2];
+        uint32_t    pieceCount;
+        bool        edges;      // holds both ends of the rows: the side halo is filled here
+    };
+
+    struct Scratch
+    {
+        std::vector<uint64_t>   rows[2];    // (bandRows + 2 * depth) x _rowWords
+        std::vector<uint64_t>   mirrored;   // a Klein bottle row, before its pieces are cut out
+    };
+
+    void        layout(const LifeEngine& engine, uint32_t workers);
+    void        loadRow(const LifeEngine& engine, Scratch& scratch, const uint64_t* board, int64_t y,
+                        const Piece& piece, uint64_t* dst);
+    void        stepBlock(const LifeEngine& engine, Scratch& scratch, const uint64_t* board, uint64_t* out,
+                          uint32_t y0, uint32_t rows, const Column& column, uint32_t depth);
+    uint64_t*   scratchRow(Scratch& scratch, uint32_t buffer, uint32_t y) { return scratch.rows[buffer].data() + (size_t)y * _rowWords; }
+
+    uint32_t                _depthHint;
+    size_t                  _cacheBytes;
+    uint32_t                _depth;
+    uint32_t                _bandRows;
+    size_t                  _tileWords;
+    uint32_t                _width;
+    uint32_t                _height;
+    size_t                  _stride;
+    size_t                  _rowWords;      // of a scratch row
+    JDLVState               _state;
+    std::vector<Column>     _columns;
+    std::vector<Scratch>    _scratch;       // one per pool worker, or one for the caller
+    std::vector<uint64_t>   _boards[2];     // height x stride, ping-pong between passes
+    std::vector<uint64_t>   _edge[2];       // fixed rows outside a plane or padded board
+
+    std::atomic<uint32_t>   _pending;       // blocks of the current pass not yet written
+    std::mutex              _doneLock;
+    std::condition_variable _doneSignal;
+};
+
+#endif /* RMDLLIFETEMPORALSTEPPER_HPP */
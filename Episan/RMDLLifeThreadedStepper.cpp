@@ -0,0 +1,207 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: RMDLLifeThreadedStepper.cpp     +++     +++   **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 17/10/2026 17:48:16      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+#include "RMDLLifeThreadedStepper.hpp"
+#include "RMDLLifeTopology.hpp"
+
+LifeThreadedStepper::LifeThreadedStepper(WorkStealingPool& pool, uint32_t bandRows)
+    : _pool(pool)
+    , _bandRowsHint(bandRows)
+    , _width(0)
+    , _height(0)
+    , _state()
+    , _wordsPerRow(0)
+    , _stride(0)
+    , _lastWordMask(0)
+    , _target(0)
+    , _stepRow(nullptr)
+    , _rule(LifeRule::conway())
+    , _inFlight(0)
+{
+}
+
+LifeThreadedStepper::~LifeThreadedStepper()
+{
+}
+
+void LifeThreadedStepper::layout(const LifeEngine& engine)
+{
+    if (engine.width() == _width && engine.height() == _height && !_bands.empty())
+        return;
+
+    _width = engine.width();
+    _height = engine.height();
+    _wordsPerRow = engine.wordsPerRow();
+    _stride = engine.stride();
+    _lastWordMask = engine.lastWordMask();
+
+    // Around eight bands per worker keeps everyone busy while the wavefront
+    // of generations ripples through the board.
+    uint32_t rows = _bandRowsHint;
+    if (rows == 0)
+        rows = std::max<uint32_t>(4, _height / (_pool.threadCount() * 8));
+    rows = std::min(rows, std::max<uint32_t>(1, _height));
+
+    _bands.clear();
+    for (uint32_t y = 0; y < _height; y += rows)
+    {
+        Band band;
+        band.y0 = y;
+        band.rows = std::min(rows, _height - y);
+        band.cells[0].assign((band.rows + 2) * _stride, 0);
+        band.cells[1].assign((band.rows + 2) * _stride, 0);
+        _bands.push_back(std::move(band));
+    }
+    _sync = std::vector<BandSync>(_bands.size());
+}
+
+int32_t LifeThreadedStepper::neighbour(int32_t band, int32_t delta) const
+{
+    const int32_t count = (int32_t)_bands.size();
+    const int32_t other = band + delta;
+    if (other >= 0 && other < count)
+        return (other);
+    if (!life_topology::wrapsVertically(_state))
+        return (-1);
+    return ((other + count) % count);
+}
+
+void LifeThreadedStepper::trySchedule(int32_t band)
+{
+    if (band < 0 || band >= (int32_t)_bands.size())
+        return;
+
+    BandSync& self = _sync[band];
+    const uint64_t done = self.done.load();
+    if (done >= _target || self.claimed.load() != done)
+        return;
+    const int32_t above = neighbour(band, -1);
+    const int32_t below = neighbour(band, 1);
+    if (above >= 0 && _sync[above].done.load() < done)
+        return;
+    if (below >= 0 && _sync[below].done.load() < done)
+        return;
+
+    uint64_t expected = done;
+    if (!self.claimed.compare_exchange_strong(expected, done + 1))
+        return;
+    _inFlight.fetch_add(1);
+    _pool.submit([this, band] { stepBand((uint32_t)band); });
+}
+
+void LifeThreadedStepper::stepBand(uint32_t band)
+{
+    Band& b = _bands[band];
+    const uint64_t generation = _sync[band].done.load();
+    const uint32_t src = generation & 1;
+    const uint32_t dst = src ^ 1;
+
+    // Our own ghost rows are settled for this generation; only the side halo is left.
+    for (int32_t y = -1; y <= (int32_t)b.rows; ++y)
+        life_topology::fillSideHalo(bandRow(band, src, y), _state);
+
+    for (uint32_t y = 0; y < b.rows; ++y)
+    {
+        const uint64_t* r = bandRow(band, src, (int32_t)y);
+        uint64_t* out = bandRow(band, dst, (int32_t)y);
+        _stepRow(r - _stride, r, r + _stride, out, _wordsPerRow, _rule);
+        out[_wordsPerRow - 1] &= _lastWordMask;
+    }
+
+    // Halo exchange: our edge rows become the neighbours' ghost rows for the same generation.
+    // Across the wrap seam fillEdgeRow applies the topology (mirrored on a Klein bottle).
+    const size_t rowBytes = _wordsPerRow * sizeof(uint64_t);
+    const int32_t above = neighbour((int32_t)band, -1);
+    const int32_t below = neighbour((int32_t)band, 1);
+    if (above >= 0)
+    {
+        uint64_t* ghost = bandRow(above, dst, (int32_t)_bands[above].rows);
+        if (band == 0)
+            life_topology::fillEdgeRow(ghost, bandRow(band, dst, 0), _wordsPerRow, _state);
+        else
+            memcpy(ghost, bandRow(band, dst, 0), rowBytes);
+    }
+    if (below >= 0)
+    {
+        uint64_t* ghost = bandRow(below, dst, -1);
+        if (band + 1 == _bands.size())
+            life_topology::fillEdgeRow(ghost, bandRow(band, dst, (int32_t)b.rows - 1), _wordsPerRow, _state);
+        else
+            memcpy(ghost, bandRow(band, dst, (int32_t)b.rows - 1), rowBytes);
+    }
+
+    _sync[band].done.store(generation + 1);
+
+    // Pushed last so this worker picks its own band up again while it is cache-warm.
+    trySchedule(above);
+    trySchedule(below);
+    trySchedule((int32_t)band);
+
+    release();
+}
+
+void LifeThreadedStepper::release()
+{
+    // Last thing a task does. The decrement happens under the lock run() waits with, so
+    // run() cannot see zero, return and free the stepper while this task still holds it.
+    std::lock_guard<std::mutex> guard(_doneLock);
+    if (_inFlight.fetch_sub(1) == 1)
+        _doneSignal.notify_all();
+}
+
+void LifeThreadedStepper::run(LifeEngine& engine, uint64_t generations)
+{
+    assert(_pool.currentWorker() < 0);
+    if (generations == 0 || engine.height() == 0)
+        return;
+
+    layout(engine);
+    _state = engine.state();
+    _stepRow = engine.stepRowFunction();
+    _rule = engine.rule();
+    _target = generations;
+    // run() holds one reference itself so early tasks cannot hit zero during the initial scheduling.
+    _inFlight.store(1);
+
+    // Scatter: interior rows plus the ghost rows taken straight from the engine once its
+    // halo is filled. Both buffers get them: on a plane or padded board the outer ghost
+    // rows never change.
+    engine.fillHalo();
+    const size_t rowBytes = _stride * sizeof(uint64_t);
+    for (uint32_t i = 0; i < _bands.size(); ++i)
+    {
+        Band& b = _bands[i];
+        for (int32_t y = -1; y <= (int32_t)b.rows; ++y)
+        {
+            memcpy(bandRow(i, 0, y) - 1, engine.row((int32_t)b.y0 + y) - 1, rowBytes);
+            memcpy(bandRow(i, 1, y) - 1, engine.row((int32_t)b.y0 + y) - 1, rowBytes);
+        }
+        _sync[i].done.store(0);
+        _sync[i].claimed.store(0);
+    }
+
+    for (uint32_t i = 0; i < _bands.size(); ++i)
+        trySchedule((int32_t)i);
+    release();
+
+    {
+        std::unique_lock<std::mutex> guard(_doneLock);
+        _doneSignal.wait(guard, [this] { return (_inFlight.load() == 0); });
+    }
+
+    const uint32_t last = generations & 1;
+    for (uint32_t i = 0; i < _bands.size(); ++i)
+        engine.writeRows(_bands[i].y0, _bands[i].rows, bandRow(i, last, 0), _stride);
+    engine.setGeneration(engine.generation() + generations);
+}
@@ -0,0 +1,80 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: RMDLLifeThreadedStepper.hpp     +++     +++   **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 17/10/2026 17:48:10      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef RMDLLIFETHREADEDSTEPPER_HPP
+# define RMDLLIFETHREADEDSTEPPER_HPP
+
+# include <atomic>
+# include <condition_variable>
+# include <cstdint>
+# include <mutex>
+# include <vector>
+
+# include "RMDLLifeEngine.hpp"
+# include "RMDLWorkStealingPool.hpp"
+
+/// Steps a LifeEngine on a WorkStealingPool. The board is cut into row bands,
+/// each with private ping-pong buffers and one ghost row above and below.
+/// There is no global barrier: band b runs generation g + 1 as soon as bands
+/// b - 1, b and b + 1 have published generation g (and their edge rows).
+/// On a torus or Klein bottle the first and last bands are neighbours.
+class LifeThreadedStepper : public NonCopyable
+{
+public:
+    /// bandRows == 0 picks a size that gives every worker several bands.
+    explicit LifeThreadedStepper(WorkStealingPool& pool, uint32_t bandRows = 0);
+    ~LifeThreadedStepper();
+
+    /// Blocks until `engine` is `generations` further. Not callable from a pool worker.
+    void        run(LifeEngine& engine, uint64_t generations);
+
+    uint32_t    bandCount() const { return (uint32_t)_bands.size(); }
+
+private:
+    struct Band
+    {
+        uint32_t                y0;
+        uint32_t                rows;
+        std::vector<uint64_t>   cells[2];   // (rows + 2) x stride, ghost rows at 0 and rows + 1
+    };
+
+    struct alignas(64) BandSync
+    {
+        std::atomic<uint64_t>   done;       // generations published
+        std::atomic<uint64_t>   claimed;    // generations handed to the pool
+    };
+
+    void        layout(const LifeEngine& engine);
+    int32_t     neighbour(int32_t band, int32_t delta) const;
+    void        trySchedule(int32_t band);
+    void        stepBand(uint32_t band);
+    void        release();
+    uint64_t*   bandRow(uint32_t band, uint32_t buffer, int32_t y) { return _bands[band].cells[buffer].data() + (size_t)(y + 1) * _stride + 1; }
+
+    WorkStealingPool&           _pool;
+    uint32_t                    _bandRowsHint;
+    std::vector<Band>           _bands;
+    std::vector<BandSync>       _sync;
+    uint32_t                    _width;
+    uint32_t                    _height;
+    JDLVState                   _state;
+    size_t                      _wordsPerRow;
+    size_t                      _stride;
+    uint64_t                    _lastWordMask;
+    uint64_t                    _target;
+    life_kernels::StepRowFn     _stepRow;
+    LifeRule                    _rule;
+
+    std::atomic<uint32_t>       _inFlight;     // queued or running band tasks
+    std::mutex                  _doneLock;
+    std::condition_variable     _doneSignal;
+};
+
+#endif /* RMDLLIFETHREADEDSTEPPER_HPP */
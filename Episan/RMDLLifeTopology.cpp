@@ -0,0 +1,97 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: RMDLLifeTopology.cpp          +++     +++     **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 17/10/2026 20:05:44      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include <cstring>
+
+#include "RMDLLifeTopology.hpp"
+
+namespace life_topology
+{
+
+static inline uint64_t reverseBits(uint64_t v)
+{
+    v = ((v >> 1) & 0x5555555555555555ull) | ((v & 0x5555555555555555ull) << 1);
+    v = ((v >> 2) & 0x3333333333333333ull) | ((v & 0x3333333333333333ull) << 2);
+    v = ((v >> 4) & 0x0F0F0F0F0F0F0F0Full) | ((v & 0x0F0F0F0F0F0F0F0Full) << 4);
+    return (__builtin_bswap64(v));
+}
+
+bool wrapsVertically(const JDLVState& state)
+{
+    return (state.topology == JDLVTopologyTorus || state.topology == JDLVTopologyKleinBottle);
+}
+
+void mirrorRow(const uint64_t* src, uint64_t* dst, size_t words, uint32_t width)
+{
+    // Reversing all words puts cell x at (64 * words - 1 - x); shift down to (width - 1 - x).
+    for (size_t i = 0; i < words; ++i)
+        dst[i] = reverseBits(src[words - 1 - i]);
+
+    const uint32_t shift = (uint32_t)(words * 64 - width);
+    if (shift == 0)
+        return;
+    for (size_t i = 0; i + 1 < words; ++i)
+        dst[i] = (dst[i] >> shift) | (dst[i + 1] << (64 - shift));
+    dst[words - 1] >>= shift;
+}
+
+void fillEdgeRow(uint64_t* halo, const uint64_t* opposite, size_t words, const JDLVState& state)
+{
+    switch (state.topology)
+    {
+        case JDLVTopologyTorus:
+            memcpy(halo, opposite, words * sizeof(uint64_t));
+            break;
+        case JDLVTopologyKleinBottle:
+            mirrorRow(opposite, halo, words, state.width);
+            break;
+        case JDLVTopologyPadded:
+            // Bits past the width only feed cells that get masked off.
+            memset(halo, state.paddingState == 1 ? 0xFF : 0x00, words * sizeof(uint64_t));
+            break;
+        default:
+            memset(halo, 0, words * sizeof(uint64_t));
+            break;
+    }
+}
+
+void fillSideHalo(uint64_t* row, const JDLVState& state)
+{
+    fillSideHalo(row, row, 0, state);
+}
+
+void fillSideHalo(uint64_t* westRow, uint64_t* eastRow, size_t eastFirst, const JDLVState& state)
+{
+    const uint32_t width = state.width;
+    uint64_t west = 0;
+    uint64_t east = 0;
+
+    switch (state.topology)
+    {
+        case JDLVTopologyTorus:
+        case JDLVTopologyKleinBottle:
+            west = (eastRow[((width - 1) >> 6) - eastFirst] >> ((width - 1) & 63)) & 1;
+            east = westRow[0] & 1;
+            break;
+        case JDLVTopologyPadded:
+            west = east = (state.paddingState == 1);
+            break;
+        default:
+            break;
+    }
+
+    westRow[-1] = west << 63;
+    // Cell `width` is the halo word when the row is full, else a spare bit of the last word.
+    uint64_t& word = eastRow[(width >> 6) - eastFirst];
+    const uint64_t bit = uint64_t(1) << (width & 63);
+    word = (word & ~bit) | (east ? bit : 0);
+}
+
+}
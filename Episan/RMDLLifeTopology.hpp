@@ -0,0 +1,43 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: RMDLLifeTopology.hpp          +++     +++     **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 17/10/2026 20:05:41      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef RMDLLIFETOPOLOGY_HPP
+# define RMDLLIFETOPOLOGY_HPP
+
+# include <cstddef>
+# include <cstdint>
+
+# include "JDLV_shared.h"
+
+/// Halo fills for the packed layout of LifeEngine: the topology is paid for
+/// once per edge row before a step, the kernels themselves never wrap.
+/// Row pointers are to the first real word, with one halo word either side.
+namespace life_topology
+{
+    /// True when the top and bottom edges see each other.
+    bool    wrapsVertically(const JDLVState& state);
+
+    /// Fills a halo row from the real row on the opposite edge (ignored for
+    /// the plane and padded modes). Only the real words are written.
+    void    fillEdgeRow(uint64_t* halo, const uint64_t* opposite, size_t words, const JDLVState& state);
+
+    /// Sets the cells just left and right of the row: bit 63 of the left
+    /// halo word and bit `width`, which is in the last word when the width
+    /// is not a multiple of 64.
+    void    fillSideHalo(uint64_t* row, const JDLVState& state);
+    /// The same for a row kept in two pieces: `west` is word 0 (halo at -1),
+    /// `east` is word `eastFirst`, up to the word holding cell `width`.
+    void    fillSideHalo(uint64_t* west, uint64_t* east, size_t eastFirst, const JDLVState& state);
+
+    /// Bit-reverses the first `width` cells of `src` into `dst`.
+    void    mirrorRow(const uint64_t* src, uint64_t* dst, size_t words, uint32_t width);
+}
+
+#endif /* RMDLLIFETOPOLOGY_HPP */
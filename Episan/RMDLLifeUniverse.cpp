@@ -0,0 +1,321 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: RMDLLifeUniverse.cpp            +++     +++   **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 17/10/2026 15:21:14      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include <algorithm>
+#include <cstring>
+
+#include "RMDLLifeUniverse.hpp"
+
+static const uint64_t kZeroRows[LifeUniverse::kTileSize] = {};
+
+LifeUniverse::LifeUniverse()
+    : _generation(0)
+    , _rule(LifeRule::conway())
+    , _stepRow(life_kernels::stepRowFunction(LifeKernel::Scalar, _rule))
+{
+}
+
+LifeUniverse::~LifeUniverse()
+{
+}
+
+bool LifeUniverse::setRule(const LifeRule& rule)
+{
+    if (!rule.isTwoState() || rule.bornFromNothing())
+        return (false);
+    _rule = rule;
+    _stepRow = life_kernels::stepRowFunction(LifeKernel::Scalar, rule);
+    // Every populated tile may behave differently under the new rule.
+    for (const auto& entry : _index)
+        markActive(entry.first);
+    return (true);
+}
+
+void LifeUniverse::clear()
+{
+    _index.clear();
+    _tiles.clear();
+    _freeTiles.clear();
+    _active.clear();
+    _generation = 0;
+}
+
+LifeUniverse::Tile* LifeUniverse::findTile(uint64_t key)
+{
+    auto it = _index.find(key);
+    return (it == _index.end() ? nullptr : &_tiles[it->second]);
+}
+
+const LifeUniverse::Tile* LifeUniverse::findTile(uint64_t key) const
+{
+    auto it = _index.find(key);
+    return (it == _index.end() ? nullptr : &_tiles[it->second]);
+}
+
+LifeUniverse::Tile* LifeUniverse::createTile(uint64_t key)
+{
+    uint32_t slot;
+    if (!_freeTiles.empty())
+    {
+        slot = _freeTiles.back();
+        _freeTiles.pop_back();
+    }
+    else
+    {
+        slot = (uint32_t)_tiles.size();
+        _tiles.emplace_back();
+    }
+    Tile& tile = _tiles[slot];
+    memset(tile.rows, 0, sizeof(tile.rows));
+    tile.key = key;
+    _index.emplace(key, slot);
+    return (&tile);
+}
+
+void LifeUniverse::destroyTile(uint64_t key)
+{
+    auto it = _index.find(key);
+    if (it == _index.end())
+        return;
+    _freeTiles.push_back(it->second);
+    _index.erase(it);
+}
+
+void LifeUniverse::markActive(uint64_t key)
+{
+    _active.push_back(key);
+}
+
+void LifeUniverse::tileKeys(std::vector<uint64_t>& keys) const
+{
+    keys.clear();
+    keys.reserve(_index.size());
+    for (const auto& entry : _index)
+        keys.push_back(entry.first);
+}
+
+const uint64_t* LifeUniverse::tileRows(int32_t tx, int32_t ty) const
+{
+    const Tile* tile = findTile(tileKey(tx, ty));
+    return (tile ? tile->rows : nullptr);
+}
+
+void LifeUniverse::setCell(int64_t x, int64_t y, bool alive)
+{
+    const uint64_t key = tileKey((int32_t)(x >> 6), (int32_t)(y >> 6));
+    Tile* tile = findTile(key);
+    if (!tile)
+    {
+        if (!alive)
+            return;
+        tile = createTile(key);
+    }
+    uint64_t& word = tile->rows[y & 63];
+    const uint64_t bit = uint64_t(1) << (x & 63);
+    word = alive ? (word | bit) : (word & ~bit);
+    markActive(key);
+}
+
+void LifeUniverse::setRun(int64_t x, int64_t y, uint64_t length)
+{
+    while (length)
+    {
+        const uint32_t bit = (uint32_t)(x & 63);
+        const uint32_t n = (uint32_t)std::min<uint64_t>(length, 64 - bit);
+        const uint64_t key = tileKey((int32_t)(x >> 6), (int32_t)(y >> 6));
+        Tile* tile = findTile(key);
+        if (!tile)
+            tile = createTile(key);
+        tile->rows[y & 63] |= (n == 64 ? ~uint64_t(0) : ((uint64_t(1) << n) - 1)) << bit;
+        markActive(key);
+        x += n;
+        length -= n;
+    }
+}
+
+bool LifeUniverse::cell(int64_t x, int64_t y) const
+{
+    const Tile* tile = findTile(tileKey((int32_t)(x >> 6), (int32_t)(y >> 6)));
+    return (tile && ((tile->rows[y & 63] >> (x & 63)) & 1));
+}
+
+void LifeUniverse::importGrid(const JDLVState& state, const uint32_t* grid, int64_t originX, int64_t originY)
+{
+    clear();
+    for (uint32_t y = 0; y < state.height; ++y)
+    {
+        const uint32_t* src = grid + (size_t)y * state.width;
+        for (uint32_t x = 0; x < state.width; ++x)
+            if (src[x] > 0)
+                setCell(originX + x, originY + y, true);
+    }
+}
+
+void LifeUniverse::exportWindow(int64_t x0, int64_t y0, const JDLVState& window, uint32_t* grid) const
+{
+    std::fill(grid, grid + (size_t)window.width * window.height, 0u);
+    if (!window.width || !window.height)
+        return;
+
+    const int64_t x1 = x0 + window.width;
+    const int64_t y1 = y0 + window.height;
+    auto copyTile = [&](const Tile& tile)
+    {
+        const int64_t tx = (int64_t)tileX(tile.key) * kTileSize;
+        const int64_t ty = (int64_t)tileY(tile.key) * kTileSize;
+        const int64_t ya = std::max(ty, y0), yb = std::min(ty + kTileSize, y1);
+        const int64_t xa = std::max(tx, x0), xb = std::min(tx + kTileSize, x1);
+        for (int64_t y = ya; y < yb; ++y)
+        {
+            const uint64_t word = tile.rows[y - ty];
+            if (!word)
+                continue;
+            uint32_t* dst = grid + (size_t)(y - y0) * window.width;
+            for (int64_t x = xa; x < xb; ++x)
+                dst[x - x0] = (uint32_t)((word >> (x - tx)) & 1);
+        }
+    };
+
+    const int64_t tilesWide = ((x1 - 1) >> 6) - (x0 >> 6) + 1;
+    const int64_t tilesHigh = ((y1 - 1) >> 6) - (y0 >> 6) + 1;
+    if ((uint64_t)(tilesWide * tilesHigh) > _index.size())
+    {
+        for (const auto& entry : _index)
+            copyTile(_tiles[entry.second]);
+        return;
+    }
+    for (int64_t ty = y0 >> 6; ty <= (y1 - 1) >> 6; ++ty)
+        for (int64_t tx = x0 >> 6; tx <= (x1 - 1) >> 6; ++tx)
+            if (const Tile* tile = findTile(tileKey((int32_t)tx, (int32_t)ty)))
+                copyTile(*tile);
+}
+
+void LifeUniverse::step()
+{
+    _generation += 1;
+    if (_active.empty())
+        return;
+
+    // A tile can only change if something in its 3x3 tile neighbourhood changed last generation.
+    std::sort(_active.begin(), _active.end());
+    _active.erase(std::unique(_active.begin(), _active.end()), _active.end());
+    _candidates.clear();
+    for (uint64_t key : _active)
+    {
+        const int32_t tx = tileX(key), ty = tileY(key);
+        for (int32_t dy = -1; dy <= 1; ++dy)
+            for (int32_t dx = -1; dx <= 1; ++dx)
+                _candidates.push_back(tileKey(tx + dx, ty + dy));
+    }
+    std::sort(_candidates.begin(), _candidates.end());
+    _candidates.erase(std::unique(_candidates.begin(), _candidates.end()), _candidates.end());
+
+    _nextRows.resize(_candidates.size() * kTileSize);
+    std::vector<uint8_t> changed(_candidates.size(), 0);
+
+    // 66 rows of [west, centre, east]: the centre tile plus a one-cell halo all around.
+    uint64_t halo[(kTileSize + 2) * 3];
+    for (size_t i = 0; i < _candidates.size(); ++i)
+    {
+        const int32_t tx = tileX(_candidates[i]), ty = tileY(_candidates[i]);
+        const uint64_t* n[3][3];
+        bool any = false;
+        for (int32_t dy = -1; dy <= 1; ++dy)
+        {
+            for (int32_t dx = -1; dx <= 1; ++dx)
+            {
+                const Tile* tile = findTile(tileKey(tx + dx, ty + dy));
+                n[dy + 1][dx + 1] = tile ? tile->rows : kZeroRows;
+                any |= tile != nullptr;
+            }
+        }
+        uint64_t* out = &_nextRows[i * kTileSize];
+        if (!any)
+        {
+            memset(out, 0, kTileSize * sizeof(uint64_t));
+            continue;
+        }
+
+        for (int c = 0; c < 3; ++c)
+        {
+            halo[c] = n[0][c][kTileSize - 1];
+            for (int32_t y = 0; y < kTileSize; ++y)
+                halo[(y + 1) * 3 + c] = n[1][c][y];
+            halo[(kTileSize + 1) * 3 + c] = n[2][c][0];
+        }
+
+        const uint64_t* old = n[1][1];
+        uint64_t diff = 0;
+        for (int32_t y = 0; y < kTileSize; ++y)
+        {
+            const uint64_t* r = &halo[(y + 1) * 3 + 1];
+            _stepRow(r - 3, r, r + 3, &out[y], 1, _rule);
+            diff |= out[y] ^ old[y];
+        }
+        changed[i] = diff != 0;
+    }
+
+    _active.clear();
+    for (size_t i = 0; i < _candidates.size(); ++i)
+    {
+        if (!changed[i])
+            continue;
+        const uint64_t key = _candidates[i];
+        const uint64_t* rows = &_nextRows[i * kTileSize];
+        uint64_t live = 0;
+        for (int32_t y = 0; y < kTileSize; ++y)
+            live |= rows[y];
+
+        Tile* tile = findTile(key);
+        if (!live)
+            destroyTile(key);
+        else
+        {
+            if (!tile)
+                tile = createTile(key);
+            memcpy(tile->rows, rows, sizeof(tile->rows));
+        }
+        markActive(key);
+    }
+}
+
+void LifeUniverse::step(uint64_t generations)
+{
+    while (generations--)
+        step();
+}
+
+uint64_t LifeUniverse::population() const
+{
+    uint64_t total = 0;
+    for (const auto& entry : _index)
+        for (uint64_t word : _tiles[entry.second].rows)
+            total += (uint64_t)__builtin_popcountll(word);
+    return (total);
+}
+
+bool LifeUniverse::bounds(int64_t& x0, int64_t& y0, int64_t& x1, int64_t& y1) const
+{
+    if (_index.empty())
+        return (false);
+    int32_t minX = INT32_MAX, minY = INT32_MAX, maxX = INT32_MIN, maxY = INT32_MIN;
+    for (const auto& entry : _index)
+    {
+        minX = std::min(minX, tileX(entry.first));
+        maxX = std::max(maxX, tileX(entry.first));
+        minY = std::min(minY, tileY(entry.first));
+        maxY = std::max(maxY, tileY(entry.first));
+    }
+    x0 = (int64_t)minX * kTileSize;
+    y0 = (int64_t)minY * kTileSize;
+    x1 = (int64_t)maxX * kTileSize + kTileSize - 1;
+    y1 = (int64_t)maxY * kTileSize + kTileSize - 1;
+    return (true);
+}
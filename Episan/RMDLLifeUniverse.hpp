@@ -0,0 +1,89 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: RMDLLifeUniverse.hpp            +++     +++   **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 17/10/2026 15:21:09      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef RMDLLIFEUNIVERSE_HPP
+# define RMDLLIFEUNIVERSE_HPP
+
+# include <cstddef>
+# include <cstdint>
+# include <unordered_map>
+# include <vector>
+
+# include "JDLV_shared.h"
+# include "RMDLLifeKernels.hpp"
+
+/// Unbounded Life universe made of 64x64 tiles (one uint64_t per tile row).
+/// Only tiles whose 3x3 tile neighbourhood changed last generation are
+/// recomputed, so the cost follows the activity, not the board area.
+class LifeUniverse
+{
+public:
+    static constexpr int32_t kTileSize = 64;
+
+    LifeUniverse();
+    ~LifeUniverse();
+
+    void        clear();
+    void        setCell(int64_t x, int64_t y, bool alive);
+    bool        cell(int64_t x, int64_t y) const;
+    /// Sets `length` live cells from (x, y) rightwards, one tile lookup per word.
+    void        setRun(int64_t x, int64_t y, uint64_t length);
+
+    void        importGrid(const JDLVState& state, const uint32_t* grid, int64_t originX = 0, int64_t originY = 0);
+    void        exportWindow(int64_t x0, int64_t y0, const JDLVState& window, uint32_t* grid) const;
+
+    void        step();
+    void        step(uint64_t generations);
+
+    const LifeRule& rule() const            { return _rule; }
+    /// Two-state rules without B0: an unbounded universe cannot be born from nothing.
+    bool        setRule(const LifeRule& rule);
+
+    uint64_t    generation() const          { return _generation; }
+    uint64_t    population() const;
+    size_t      tileCount() const           { return _index.size(); }
+    size_t      activeTileCount() const     { return _active.size(); }
+    /// Inclusive tile-aligned bounds of the live area, false if the universe is empty.
+    bool        bounds(int64_t& x0, int64_t& y0, int64_t& x1, int64_t& y1) const;
+
+    static uint64_t tileKey(int32_t tx, int32_t ty) { return ((uint64_t)(uint32_t)tx << 32) | (uint32_t)ty; }
+    static int32_t  tileX(uint64_t key)              { return (int32_t)(uint32_t)(key >> 32); }
+    static int32_t  tileY(uint64_t key)              { return (int32_t)(uint32_t)key; }
+
+    /// Keys of every allocated tile, in no particular order.
+    void        tileKeys(std::vector<uint64_t>& keys) const;
+    /// Current rows of a tile, nullptr when the tile is empty/absent.
+    const uint64_t* tileRows(int32_t tx, int32_t ty) const;
+
+private:
+    struct Tile
+    {
+        uint64_t    rows[kTileSize];
+        uint64_t    key;
+    };
+
+    Tile*       findTile(uint64_t key);
+    const Tile* findTile(uint64_t key) const;
+    Tile*       createTile(uint64_t key);
+    void        destroyTile(uint64_t key);
+    void        markActive(uint64_t key);
+
+    std::unordered_map<uint64_t, uint32_t>  _index;
+    std::vector<Tile>                       _tiles;
+    std::vector<uint32_t>                   _freeTiles;
+    std::vector<uint64_t>                   _active;
+    std::vector<uint64_t>                   _candidates;
+    std::vector<uint64_t>                   _nextRows;
+    uint64_t                                _generation;
+    LifeRule                                _rule;
+    life_kernels::StepRowFn                 _stepRow;
+};
+
+#endif /* RMDLLIFEUNIVERSE_HPP */
@@ -10,6 +10,8 @@
 
 #include <simd/simd.h>
 
+#include "JDLV_shared.h"
+
 struct RMDLCameraUniforms
 {
     simd::float4x4      viewMatrix;
@@ -109,12 +111,6 @@ typedef struct
     simd_float4 color;
 } VertexData;
 
-struct JDLVState
-{
-    uint32_t width;
-    uint32_t height;
-};
-
 struct TextVertex
 {
     simd::float2 pos;
@@ -0,0 +1,97 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: RMDLMappedFile.cpp            +++     +++     **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 17/10/2026 21:14:12      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "RMDLMappedFile.hpp"
+
+MappedFile::MappedFile()
+    : _data(nullptr)
+    , _size(0)
+    , _access(Access::ReadOnly)
+{
+}
+
+MappedFile::~MappedFile()
+{
+    close();
+}
+
+bool MappedFile::map(int fd, size_t size, Access access)
+{
+    _access = access;
+    // An empty file is valid, it just has nothing to map.
+    if (size == 0)
+        return (true);
+    const int protection = access == Access::ReadOnly ? PROT_READ : PROT_READ | PROT_WRITE;
+    const int flags = access == Access::ReadWrite ? MAP_SHARED : MAP_PRIVATE;
+    void* p = mmap(nullptr, size, protection, flags, fd, 0);
+    if (p == MAP_FAILED)
+        return (false);
+    if (access == Access::ReadOnly)
+        madvise(p, size, MADV_SEQUENTIAL);
+    _data = static_cast<char*>(p);
+    _size = size;
+    return (true);
+}
+
+bool MappedFile::open(const char* path, Access access)
+{
+    close();
+    const int fd = ::open(path, access == Access::ReadWrite ? O_RDWR : O_RDONLY);
+    if (fd < 0)
+    {
+        printf("MappedFile: cannot open %s\n", path);
+        return (false);
+    }
+    struct stat st;
+    const bool ok = fstat(fd, &st) == 0 && map(fd, (size_t)st.st_size, access);
+    if (!ok)
+        printf("MappedFile: mmap failed for %s\n", path);
+    ::close(fd);
+    return (ok);
+}
+
+bool MappedFile::create(const char* path, size_t size)
+{
+    close();
+    const int fd = ::open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0)
+    {
+        printf("MappedFile: cannot create %s\n", path);
+        return (false);
+    }
+    const bool ok = ftruncate(fd, (off_t)size) == 0 && map(fd, size, Access::ReadWrite);
+    if (!ok)
+        printf("MappedFile: cannot map %zu bytes for %s\n", size, path);
+    ::close(fd);
+    return (ok);
+}
+
+bool MappedFile::sync(size_t offset, size_t length, bool async)
+{
+    if (_access != Access::ReadWrite || length == 0)
+        return (true);
+    const size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    const size_t begin = offset & ~(page - 1);
+    return (msync(_data + begin, offset + length - begin, async ? MS_ASYNC : MS_SYNC) == 0);
+}
+
+void MappedFile::close()
+{
+    if (_data)
+        munmap(_data, _size);
+    _data = nullptr;
+    _size = 0;
+}
@@ -0,0 +1,55 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: RMDLMappedFile.hpp            +++     +++     **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 17/10/2026 21:14:09      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef RMDLMAPPEDFILE_HPP
+# define RMDLMAPPEDFILE_HPP
+
+# include <cstddef>
+# include <cstdint>
+
+# include "NonCopyable.h"
+
+/// mmap of a whole file. The pages are faulted in on demand, so a parser
+/// can walk a multi-gigabyte file without copying it.
+class MappedFile : public NonCopyable
+{
+public:
+    enum class Access
+    {
+        ReadOnly,
+        CopyOnWrite,    // writable, changes stay private to the process
+        ReadWrite       // shared, changes reach the file (see sync)
+    };
+
+    MappedFile();
+    ~MappedFile();
+
+    bool            open(const char* path, Access access = Access::ReadOnly);
+    /// Creates or truncates `path` to `size` bytes and maps it ReadWrite.
+    bool            create(const char* path, size_t size);
+    void            close();
+
+    /// msync of the pages covering [offset, offset + length).
+    bool            sync(size_t offset, size_t length, bool async = false);
+
+    const char*     data() const        { return _data; }
+    /// nullptr for a ReadOnly mapping.
+    char*           mutableData() const { return (_access == Access::ReadOnly ? nullptr : _data); }
+    size_t          size() const        { return _size; }
+
+private:
+    bool            map(int fd, size_t size, Access access);
+
+    char*           _data;
+    size_t          _size;
+    Access          _access;
+};
+
+#endif /* RMDLMAPPEDFILE_HPP */
@@ -0,0 +1,914 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: RMDLPatternIO.cpp             +++     +++     **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 17/10/2026 21:31:07      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "RMDLPatternIO.hpp"
+#include "RMDLMappedFile.hpp"
+#include "RMDLLifeEngine.hpp"
+#include "RMDLLifeUniverse.hpp"
+#include "RMDLHashLife.hpp"
+
+namespace pattern_io
+{
+
+static inline uint64_t lowMask(uint32_t n)
+{
+    return (n >= 64 ? ~uint64_t(0) : (uint64_t(1) << n) - 1);
+}
+
+static inline const char* skipLine(const char* p, const char* end)
+{
+    const char* nl = static_cast<const char*>(memchr(p, '\n', (size_t)(end - p)));
+    return (nl ? nl + 1 : end);
+}
+
+static inline const char* skipBlanks(const char* p, const char* end)
+{
+    while (p < end && (*p == ' ' || *p == '\t' || *p == '\r'))
+        ++p;
+    return (p);
+}
+
+static bool parseInt(const char*& p, const char* end, int64_t& value)
+{
+    bool negative = false;
+    if (p < end && (*p == '-' || *p == '+'))
+        negative = (*p++ == '-');
+    if (p >= end || *p < '0' || *p > '9')
+        return (false);
+    uint64_t v = 0;
+    while (p < end && *p >= '0' && *p <= '9')
+        v = v * 10 + (uint64_t)(*p++ - '0');
+    value = negative ? -(int64_t)v : (int64_t)v;
+    return (true);
+}
+
+/// Rule text up to the end of the line; Golly's ":T" bounded-grid suffix is dropped.
+static bool parseRule(const char* p, const char* end, LifeRule& rule)
+{
+    p = skipBlanks(p, end);
+    const char* q = p;
+    while (q < end && *q != '\n' && *q != '\r' && *q != ',' && *q != ':' && *q != ' ')
+        ++q;
+    return (LifeRule::parse(std::string(p, q), rule));
+}
+
+static void resetInfo(PatternInfo& info)
+{
+    info.originX = 0;
+    info.originY = 0;
+    info.width = 0;
+    info.height = 0;
+    info.rule = LifeRule::conway();
+    info.hasRule = false;
+    info.generation = 0;
+}
+
+// ---------------------------------------------------------------------------
+// Sinks
+
+GridSink::GridSink(const JDLVState& state, uint32_t* grid, bool centre)
+    : _state(state)
+    , _grid(grid)
+    , _centre(centre)
+    , _offsetX(0)
+    , _offsetY(0)
+{
+}
+
+void GridSink::begin(const PatternInfo& info)
+{
+    if (!_centre)
+        return;
+    _offsetX = (int64_t)_state.width / 2 - (info.originX + info.width / 2);
+    _offsetY = (int64_t)_state.height / 2 - (info.originY + info.height / 2);
+}
+
+void GridSink::run(int64_t x, int64_t y, uint64_t length, uint32_t state)
+{
+    x += _offsetX;
+    y += _offsetY;
+    if (y < 0 || y >= (int64_t)_state.height)
+        return;
+    const int64_t x0 = std::max<int64_t>(x, 0);
+    const int64_t x1 = std::min<int64_t>(x + (int64_t)length, _state.width);
+    if (x0 < x1)
+        std::fill(_grid + (size_t)y * _state.width + x0, _grid + (size_t)y * _state.width + x1, state);
+}
+
+bool GridSink::window(int64_t& x0, int64_t& y0, int64_t& x1, int64_t& y1) const
+{
+    x0 = -_offsetX;
+    y0 = -_offsetY;
+    x1 = (int64_t)_state.width - 1 - _offsetX;
+    y1 = (int64_t)_state.height - 1 - _offsetY;
+    return (true);
+}
+
+LifeEngineSink::LifeEngineSink(LifeEngine& engine)
+    : _engine(engine)
+{
+}
+
+void LifeEngineSink::run(int64_t x, int64_t y, uint64_t length, uint32_t state)
+{
+    if (state != 1 || y < 0 || y >= (int64_t)_engine.height())
+        return;
+    int64_t x0 = std::max<int64_t>(x, 0);
+    const int64_t x1 = std::min<int64_t>(x + (int64_t)length, _engine.width());
+    uint64_t* row = _engine.row((int32_t)y);
+    while (x0 < x1)
+    {
+        const uint32_t bit = (uint32_t)(x0 & 63);
+        const uint32_t n = (uint32_t)std::min<int64_t>(64 - bit, x1 - x0);
+        row[x0 >> 6] |= lowMask(n) << bit;
+        x0 += n;
+    }
+}
+
+bool LifeEngineSink::window(int64_t& x0, int64_t& y0, int64_t& x1, int64_t& y1) const
+{
+    x0 = 0;
+    y0 = 0;
+    x1 = (int64_t)_engine.width() - 1;
+    y1 = (int64_t)_engine.height() - 1;
+    return (true);
+}
+
+void LifeEngineSink::finish()
+{
+    _engine.markAllDirty();
+}
+
+void LifeUniverseSink::run(int64_t x, int64_t y, uint64_t length, uint32_t state)
+{
+    if (state == 1)
+        _universe.setRun(x, y, length);
+}
+
+void HashLifeSink::run(int64_t x, int64_t y, uint64_t length, uint32_t state)
+{
+    if (state != 1)
+        return;
+    while (length)
+    {
+        const uint32_t bit = (uint32_t)(x & 7);
+        const uint32_t n = (uint32_t)std::min<uint64_t>(length, 8 - bit);
+        const uint64_t key = ((uint64_t)(uint32_t)(x >> 3) << 32) | (uint32_t)(y >> 3);
+        _leaves[key] |= (lowMask(n) << bit) << ((y & 7) * 8);
+        x += n;
+        length -= n;
+    }
+}
+
+struct Leaf
+{
+    int64_t     x;      // top-left cell
+    int64_t     y;
+    uint64_t    bits;   // bit 8 * row + column
+};
+
+static uint32_t leafNode(HashLife& life, uint64_t bits, uint32_t level, uint32_t x, uint32_t y)
+{
+    if (level == 0)
+        return ((bits >> (y * 8 + x)) & 1);
+    if (level == 3 && bits == 0)
+        return (life.emptyNode(3));
+    const uint32_t half = 1u << (level - 1);
+    return (life.makeNode(leafNode(life, bits, level - 1, x, y),
+                          leafNode(life, bits, level - 1, x + half, y),
+                          leafNode(life, bits, level - 1, x, y + half),
+                          leafNode(life, bits, level - 1, x + half, y + half)));
+}
+
+static uint32_t buildTree(HashLife& life, Leaf* first, Leaf* last, uint32_t level, int64_t x, int64_t y)
+{
+    if (first == last)
+        return (life.emptyNode(level));
+    if (level == 3)
+        return (leafNode(life, first->bits, 3, 0, 0));
+    const int64_t half = int64_t(1) << (level - 1);
+    Leaf* south = std::partition(first, last, [&](const Leaf& l) { return (l.y < y + half); });
+    Leaf* ne = std::partition(first, south, [&](const Leaf& l) { return (l.x < x + half); });
+    Leaf* se = std::partition(south, last, [&](const Leaf& l) { return (l.x < x + half); });
+    const uint32_t nw = buildTree(life, first, ne, level - 1, x, y);
+    const uint32_t nee = buildTree(life, ne, south, level - 1, x + half, y);
+    const uint32_t sw = buildTree(life, south, se, level - 1, x, y + half);
+    const uint32_t see = buildTree(life, se, last, level - 1, x + half, y + half);
+    return (life.makeNode(nw, nee, sw, see));
+}
+
+void HashLifeSink::finish()
+{
+    std::vector<Leaf> leaves;
+    leaves.reserve(_leaves.size());
+    int64_t extent = 0;
+    for (const auto& entry : _leaves)
+    {
+        if (!entry.second)
+            continue;
+        const Leaf leaf = { (int64_t)(int32_t)(entry.first >> 32) * 8, (int64_t)(int32_t)entry.first * 8, entry.second };
+        extent = std::max({ extent, -leaf.x, -leaf.y, leaf.x + 8, leaf.y + 8 });
+        leaves.push_back(leaf);
+    }
+    _leaves.clear();
+
+    uint32_t level = 4;
+    while ((int64_t(1) << (level - 1)) < extent)
+        ++level;
+    const int64_t half = int64_t(1) << (level - 1);
+
+    _life.clear();
+    _life.setRoot(buildTree(_life, leaves.data(), leaves.data() + leaves.size(), level, -half, -half), 0);
+}
+
+// ---------------------------------------------------------------------------
+// RLE
+
+bool readRLE(const char* data, size_t size, PatternSink& sink, PatternInfo& info, int64_t originX, int64_t originY)
+{
+    resetInfo(info);
+    const char* p = data;
+    const char* end = data + size;
+
+    // Header: comment lines, then the optional "x = .., y = .., rule = .." line.
+    int64_t posX = 0;
+    int64_t posY = 0;
+    for (;;)
+    {
+        p = skipBlanks(p, end);
+        if (p < end && *p == '\n')
+        {
+            ++p;
+            continue;
+        }
+        if (p < end && *p == '#')
+        {
+            const char* line = skipLine(p, end);
+            if (line - p > 7 && !memcmp(p, "#CXRLE", 6))
+            {
+                for (const char* q = p + 6; q + 4 < line; ++q)
+                {
+                    const char* v = q + 4;
+                    if (!memcmp(q, "Pos=", 4) && parseInt(v, line, posX) && v < line && *v++ == ',')
+                        parseInt(v, line, posY);
+                    v = q + 4;
+                    int64_t gen = 0;
+                    if (!memcmp(q, "Gen=", 4) && parseInt(v, line, gen))
+                        info.generation = (uint64_t)gen;
+                }
+            }
+            else if (line - p > 2 && (p[1] == 'r' || p[1] == 'R'))
+                info.hasRule = parseRule(p + 2, line, info.rule);
+            p = line;
+            continue;
+        }
+        break;
+    }
+    if (p < end && *p == 'x')
+    {
+        const char* line = skipLine(p, end);
+        while (p < line)
+        {
+            p = skipBlanks(p, line);
+            const char* key = p;
+            while (p < line && *p >= 'a' && *p <= 'z')
+                ++p;
+            const size_t keyLength = (size_t)(p - key);
+            p = skipBlanks(p, line);
+            if (p >= line || *p != '=')
+                break;
+            p = skipBlanks(p + 1, line);
+            if (keyLength == 1 && *key == 'x')
+                parseInt(p, line, info.width);
+            else if (keyLength == 1 && *key == 'y')
+                parseInt(p, line, info.height);
+            else if (keyLength == 4 && !memcmp(key, "rule", 4))
+                info.hasRule = parseRule(p, line, info.rule);
+            while (p < line && *p != ',')
+                ++p;
+            ++p;
+        }
+        p = line;
+    }
+    info.originX = originX + posX;
+    info.originY = originY + posY;
+    sink.begin(info);
+
+    // Body: [count] tag, where b/. is dead, o is state 1, A..X (with p..y prefixes) are states.
+    int64_t x = 0;
+    int64_t y = 0;
+    uint64_t count = 0;
+    uint32_t prefix = 0;
+    while (p < end)
+    {
+        const char c = *p++;
+        if (c >= '0' && c <= '9')
+        {
+            count = count * 10 + (uint64_t)(c - '0');
+            continue;
+        }
+        const uint64_t n = count ? count : 1;
+        uint32_t state = 0;
+        if (c == 'b' || c == '.')
+            x += (int64_t)n;
+        else if (c == 'o')
+            state = 1;
+        else if (c >= 'A' && c <= 'X')
+            state = prefix * 24 + (uint32_t)(c - 'A') + 1;
+        else if (c >= 'p' && c <= 'y')
+        {
+            prefix = (uint32_t)(c - 'p') + 1;
+            continue;
+        }
+        else if (c == '$')
+        {
+            y += (int64_t)n;
+            x = 0;
+        }
+        else if (c == '!')
+            break;
+        else if (c == ' ' || c == '\t' || c == '\r' || c == '\n')
+            continue;
+        else if (c == '#')
+        {
+            p = skipLine(p, end);
+            continue;
+        }
+        else
+        {
+            printf("RLE: unexpected '%c'\n", c);
+            return (false);
+        }
+        if (state)
+        {
+            sink.run(info.originX + x, info.originY + y, n, state);
+            x += (int64_t)n;
+        }
+        count = 0;
+        prefix = 0;
+    }
+    sink.finish();
+    return (true);
+}
+
+// ---------------------------------------------------------------------------
+// Macrocell
+
+struct MacroNode
+{
+    uint32_t    level;
+    uint32_t    child[4];   // 1-based line numbers, 0 for empty
+    uint64_t    bits;       // level 3 leaves only
+};
+
+bool isMacrocell(const char* data, size_t size)
+{
+    return (size >= 4 && !memcmp(data, "[M2]", 4));
+}
+
+/// Walks the file once. onLeaf/onNode get every node line in order.
+template <typename OnLeaf, typename OnNode>
+static bool parseMacrocell(const char* data, size_t size, PatternInfo& info, OnLeaf onLeaf, OnNode onNode)
+{
+    resetInfo(info);
+    if (!isMacrocell(data, size))
+        return (false);
+    const char* end = data + size;
+    const char* p = skipLine(data, end);
+    uint32_t count = 0;
+    std::vector<uint8_t> levels(1, 0);
+
+    while (p < end)
+    {
+        const char* line = skipLine(p, end);
+        const char c = *p;
+        if (c == '#')
+        {
+            if (line - p > 2 && p[1] == 'R')
+                info.hasRule = parseRule(p + 2, line, info.rule);
+            else if (line - p > 2 && p[1] == 'G')
+            {
+                const char* v = skipBlanks(p + 2, line);
+                int64_t gen = 0;
+                if (parseInt(v, line, gen))
+                    info.generation = (uint64_t)gen;
+            }
+        }
+        else if (c == '.' || c == '*' || c == '$')
+        {
+            uint64_t bits = 0;
+            uint32_t x = 0;
+            uint32_t y = 0;
+            for (const char* q = p; q < line && *q != '\n' && *q != '\r'; ++q)
+            {
+                if (*q == '$')
+                {
+                    ++y;
+                    x = 0;
+                }
+                else if (x >= 8 || y >= 8)
+                    return (false);
+                else
+                {
+                    bits |= (uint64_t)(*q == '*') << (y * 8 + x);
+                    ++x;
+                }
+            }
+            onLeaf(++count, bits);
+            levels.push_back(3);
+        }
+        else if (c >= '0' && c <= '9')
+        {
+            int64_t level = 0;
+            int64_t child[4] = {};
+            const char* q = p;
+            if (!parseInt(q, line, level) || level < 4 || level > 62)
+            {
+                printf("Macrocell: only two-state files with 8x8 leaves are supported\n");
+                return (false);
+            }
+            for (int i = 0; i < 4; ++i)
+            {
+                q = skipBlanks(q, line);
+                if (!parseInt(q, line, child[i]) || child[i] < 0 || child[i] > (int64_t)count ||
+                    (child[i] && levels[child[i]] != level - 1))
+                    return (false);
+            }
+            ++count;
+            onNode(count, (uint32_t)level, (uint32_t)child[0], (uint32_t)child[1], (uint32_t)child[2], (uint32_t)child[3]);
+            levels.push_back((uint8_t)level);
+        }
+        p = line;
+    }
+    if (count == 0)
+        return (false);
+    info.width = int64_t(1) << levels.back();
+    info.height = info.width;
+    info.originX = -info.width / 2;
+    info.originY = -info.height / 2;
+    return (true);
+}
+
+static void emitLeaf(PatternSink& sink, uint64_t bits, int64_t x, int64_t y)
+{
+    for (uint32_t r = 0; r < 8; ++r)
+    {
+        uint32_t row = (uint32_t)(bits >> (r * 8)) & 0xFF;
+        while (row)
+        {
+            const uint32_t start = (uint32_t)__builtin_ctz(row);
+            const uint32_t length = (uint32_t)__builtin_ctz(~(row >> start));
+            sink.run(x + start, y + r, length, 1);
+            row &= ~(((1u << length) - 1) << start);
+        }
+    }
+}
+
+static void emitNode(PatternSink& sink, const std::vector<MacroNode>& nodes, uint32_t index, int64_t x, int64_t y,
+                     bool clip, int64_t x0, int64_t y0, int64_t x1, int64_t y1)
+{
+    if (index == 0)
+        return;
+    const MacroNode& n = nodes[index];
+    const int64_t size = int64_t(1) << n.level;
+    if (clip && (x > x1 || y > y1 || x + size - 1 < x0 || y + size - 1 < y0))
+        return;
+    if (n.level == 3)
+    {
+        emitLeaf(sink, n.bits, x, y);
+        return;
+    }
+    const int64_t half = size >> 1;
+    emitNode(sink, nodes, n.child[0], x, y, clip, x0, y0, x1, y1);
+    emitNode(sink, nodes, n.child[1], x + half, y, clip, x0, y0, x1, y1);
+    emitNode(sink, nodes, n.child[2], x, y + half, clip, x0, y0, x1, y1);
+    emitNode(sink, nodes, n.child[3], x + half, y + half, clip, x0, y0, x1, y1);
+}
+
+bool readMacrocell(const char* data, size_t size, PatternSink& sink, PatternInfo& info, int64_t originX, int64_t originY)
+{
+    std::vector<MacroNode> nodes(1);
+    const bool ok = parseMacrocell(data, size, info,
+        [&](uint32_t, uint64_t bits) { nodes.push_back({ 3, { 0, 0, 0, 0 }, bits }); },
+        [&](uint32_t, uint32_t level, uint32_t nw, uint32_t ne, uint32_t sw, uint32_t se) { nodes.push_back({ level, { nw, ne, sw, se }, 0 }); });
+    if (!ok)
+        return (false);
+
+    info.originX += originX;
+    info.originY += originY;
+    sink.begin(info);
+    int64_t x0 = 0, y0 = 0, x1 = 0, y1 = 0;
+    const bool clip = sink.window(x0, y0, x1, y1);
+    emitNode(sink, nodes, (uint32_t)nodes.size() - 1, info.originX, info.originY, clip, x0, y0, x1, y1);
+    sink.finish();
+    return (true);
+}
+
+bool readMacrocell(const char* data, size_t size, HashLife& life, PatternInfo& info)
+{
+    life.clear();
+    std::vector<uint32_t> ids(1, 0);
+    const bool ok = parseMacrocell(data, size, info,
+        [&](uint32_t, uint64_t bits) { ids.push_back(leafNode(life, bits, 3, 0, 0)); },
+        [&](uint32_t, uint32_t level, uint32_t nw, uint32_t ne, uint32_t sw, uint32_t se)
+        {
+            const uint32_t e = life.emptyNode(level - 1);
+            ids.push_back(life.makeNode(nw ? ids[nw] : e, ne ? ids[ne] : e, sw ? ids[sw] : e, se ? ids[se] : e));
+        });
+    if (!ok)
+    {
+        life.clear();
+        return (false);
+    }
+    if (info.hasRule && !life.setRule(info.rule))
+        printf("Macrocell: rule %s not supported by HashLife, keeping %s\n", info.rule.toString().c_str(), life.rule().toString().c_str());
+    life.setRoot(ids.back(), info.generation);
+    return (true);
+}
+
+// ---------------------------------------------------------------------------
+// Loading
+
+bool loadPattern(const char* path, PatternSink& sink, PatternInfo& info, int64_t originX, int64_t originY)
+{
+    MappedFile file;
+    if (!file.open(path))
+        return (false);
+    if (isMacrocell(file.data(), file.size()))
+        return (readMacrocell(file.data(), file.size(), sink, info, originX, originY));
+    return (readRLE(file.data(), file.size(), sink, info, originX, originY));
+}
+
+bool loadPattern(const char* path, HashLife& life, PatternInfo& info)
+{
+    MappedFile file;
+    if (!file.open(path))
+        return (false);
+    if (isMacrocell(file.data(), file.size()))
+        return (readMacrocell(file.data(), file.size(), life, info));
+
+    HashLifeSink sink(life);
+    if (!readRLE(file.data(), file.size(), sink, info))
+        return (false);
+    if (info.hasRule && !life.setRule(info.rule))
+        printf("RLE: rule %s not supported by HashLife, keeping %s\n", info.rule.toString().c_str(), life.rule().toString().c_str());
+    return (true);
+}
+
+// ---------------------------------------------------------------------------
+// Saving
+
+/// fwrite in 64 KiB chunks; nothing is formatted through the C stdio per token.
+class OutputStream
+{
+public:
+    OutputStream() : _file(nullptr), _buffer(1 << 16), _used(0) {}
+    ~OutputStream() { close(); }
+
+    bool open(const char* path)
+    {
+        _file = fopen(path, "wb");
+        if (!_file)
+            printf("Pattern: cannot write %s\n", path);
+        return (_file != nullptr);
+    }
+
+    bool close()
+    {
+        if (!_file)
+            return (false);
+        flush();
+        const bool ok = !ferror(_file);
+        fclose(_file);
+        _file = nullptr;
+        return (ok);
+    }
+
+    void put(char c)
+    {
+        if (_used == _buffer.size())
+            flush();
+        _buffer[_used++] = c;
+    }
+
+    void write(const char* text, size_t length)
+    {
+        for (size_t i = 0; i < length; ++i)
+            put(text[i]);
+    }
+
+    void write(const char* text)            { write(text, strlen(text)); }
+    void write(const std::string& text)     { write(text.data(), text.size()); }
+
+    /// Decimal digits of `value` into `text` (at least 20 bytes), returns the length.
+    static size_t format(uint64_t value, char* text)
+    {
+        char digits[20];
+        size_t n = 0;
+        do
+        {
+            digits[n++] = (char)('0' + value % 10);
+            value /= 10;
+        } while (value);
+        for (size_t i = 0; i < n; ++i)
+            text[i] = digits[n - 1 - i];
+        return (n);
+    }
+
+    void number(int64_t value)
+    {
+        char text[21];
+        if (value < 0)
+            put('-');
+        write(text, format(value < 0 ? (uint64_t)0 - (uint64_t)value : (uint64_t)value, text));
+    }
+
+private:
+    void flush()
+    {
+        if (_used)
+            fwrite(_buffer.data(), 1, _used, _file);
+        _used = 0;
+    }
+
+    FILE*               _file;
+    std::vector<char>   _buffer;
+    size_t              _used;
+};
+
+/// Turns row-major runs of live cells into RLE tokens, 70 columns per line.
+class RLEWriter
+{
+public:
+    RLEWriter(OutputStream& out, int64_t x0, int64_t y0)
+        : _out(out), _x0(x0), _x(x0), _y(y0), _runX(0), _runY(0), _runLength(0), _column(0)
+    {
+    }
+
+    void header(int64_t width, int64_t height, const LifeRule& rule, uint64_t generation)
+    {
+        _out.write("#CXRLE Pos=");
+        _out.number(_x0);
+        _out.put(',');
+        _out.number(_y);
+        if (generation)
+        {
+            _out.write(" Gen=");
+            _out.number((int64_t)generation);
+        }
+        _out.write("\nx = ");
+        _out.number(width);
+        _out.write(", y = ");
+        _out.number(height);
+        _out.write(", rule = ");
+        _out.write(rule.toString());
+        _out.put('\n');
+    }
+
+    void run(int64_t x, int64_t y, uint64_t length)
+    {
+        if (_runLength && y == _runY && x == _runX + (int64_t)_runLength)
+        {
+            _runLength += length;
+            return;
+        }
+        flushRun();
+        if (y != _y)
+        {
+            token((uint64_t)(y - _y), '$');
+            _y = y;
+            _x = _x0;
+        }
+        if (x > _x)
+            token((uint64_t)(x - _x), 'b');
+        _runX = x;
+        _runY = y;
+        _runLength = length;
+    }
+
+    void finish()
+    {
+        flushRun();
+        token(1, '!');
+        _out.put('\n');
+    }
+
+private:
+    void token(uint64_t count, char tag)
+    {
+        char text[22];
+        size_t length = count > 1 ? OutputStream::format(count, text) : 0;
+        text[length++] = tag;
+        if (_column + length > 70)
+        {
+            _out.put('\n');
+            _column = 0;
+        }
+        _out.write(text, length);
+        _column += length;
+    }
+
+    void flushRun()
+    {
+        if (!_runLength)
+            return;
+        token(_runLength, 'o');
+        _x = _runX + (int64_t)_runLength;
+        _runLength = 0;
+    }
+
+    OutputStream&   _out;
+    int64_t         _x0;
+    int64_t         _x;
+    int64_t         _y;
+    int64_t         _runX;
+    int64_t         _runY;
+    uint64_t        _runLength;
+    size_t          _column;
+};
+
+static void emitWord(RLEWriter& writer, uint64_t word, int64_t x, int64_t y)
+{
+    while (word)
+    {
+        const uint32_t start = (uint32_t)__builtin_ctzll(word);
+        const uint64_t rest = ~(word >> start);
+        const uint32_t length = rest ? (uint32_t)__builtin_ctzll(rest) : 64 - start;
+        writer.run(x + start, y, length);
+        word &= ~(lowMask(length) << start);
+    }
+}
+
+bool saveRLE(const char* path, const LifeEngine& engine)
+{
+    OutputStream out;
+    if (!out.open(path))
+        return (false);
+    RLEWriter writer(out, 0, 0);
+    writer.header(engine.width(), engine.height(), engine.rule(), engine.generation());
+    for (uint32_t y = 0; y < engine.height(); ++y)
+    {
+        const uint64_t* row = engine.row((int32_t)y);
+        for (size_t w = 0; w < engine.wordsPerRow(); ++w)
+            emitWord(writer, row[w] & (w + 1 == engine.wordsPerRow() ? engine.lastWordMask() : ~uint64_t(0)), (int64_t)w * 64, y);
+    }
+    writer.finish();
+    return (out.close());
+}
+
+bool saveRLE(const char* path, const LifeUniverse& universe)
+{
+    std::vector<uint64_t> keys;
+    universe.tileKeys(keys);
+    std::sort(keys.begin(), keys.end(), [](uint64_t a, uint64_t b)
+    {
+        const int32_t ay = LifeUniverse::tileY(a), by = LifeUniverse::tileY(b);
+        return (ay != by ? ay < by : LifeUniverse::tileX(a) < LifeUniverse::tileX(b));
+    });
+
+    // Tight bounds, so the header matches what Golly would write.
+    int64_t x0 = INT64_MAX, y0 = INT64_MAX, x1 = INT64_MIN, y1 = INT64_MIN;
+    for (uint64_t key : keys)
+    {
+        const int32_t tx = LifeUniverse::tileX(key), ty = LifeUniverse::tileY(key);
+        const uint64_t* rows = universe.tileRows(tx, ty);
+        uint64_t columns = 0;
+        for (int32_t r = 0; r < LifeUniverse::kTileSize; ++r)
+        {
+            if (!rows[r])
+                continue;
+            columns |= rows[r];
+            y0 = std::min<int64_t>(y0, (int64_t)ty * 64 + r);
+            y1 = std::max<int64_t>(y1, (int64_t)ty * 64 + r);
+        }
+        if (!columns)
+            continue;
+        x0 = std::min<int64_t>(x0, (int64_t)tx * 64 + __builtin_ctzll(columns));
+        x1 = std::max<int64_t>(x1, (int64_t)tx * 64 + 63 - __builtin_clzll(columns));
+    }
+    if (x0 > x1)
+        x0 = y0 = x1 = y1 = 0;
+
+    OutputStream out;
+    if (!out.open(path))
+        return (false);
+    RLEWriter writer(out, x0, y0);
+    writer.header(x1 - x0 + 1, y1 - y0 + 1, universe.rule(), universe.generation());
+    for (size_t first = 0; first < keys.size();)
+    {
+        // One band of tiles sharing a tile row, written row by row.
+        const int32_t ty = LifeUniverse::tileY(keys[first]);
+        size_t last = first;
+        while (last < keys.size() && LifeUniverse::tileY(keys[last]) == ty)
+            ++last;
+        for (int32_t r = 0; r < LifeUniverse::kTileSize; ++r)
+        {
+            for (size_t i = first; i < last; ++i)
+            {
+                const int32_t tx = LifeUniverse::tileX(keys[i]);
+                emitWord(writer, universe.tileRows(tx, ty)[r], (int64_t)tx * 64, (int64_t)ty * 64 + r);
+            }
+        }
+        first = last;
+    }
+    writer.finish();
+    return (out.close());
+}
+
+static void leafBits(const HashLife& life, uint32_t id, uint32_t level, uint32_t x, uint32_t y, uint64_t& bits)
+{
+    if (level == 0)
+    {
+        bits |= (uint64_t)(id == 1) << (y * 8 + x);
+        return;
+    }
+    if (life.nodePopulation(id) == 0)
+        return;
+    uint32_t children[4];
+    life.nodeChildren(id, children);
+    const uint32_t half = 1u << (level - 1);
+    leafBits(life, children[0], level - 1, x, y, bits);
+    leafBits(life, children[1], level - 1, x + half, y, bits);
+    leafBits(life, children[2], level - 1, x, y + half, bits);
+    leafBits(life, children[3], level - 1, x + half, y + half, bits);
+}
+
+/// Post-order, each shared node once. Returns its 1-based line, 0 for an empty node.
+static uint32_t writeMacroNode(const HashLife& life, uint32_t id, std::vector<uint32_t>& lines, uint32_t& count, OutputStream& out)
+{
+    if (life.nodePopulation(id) == 0)
+        return (0);
+    if (lines[id])
+        return (lines[id]);
+
+    const uint32_t level = life.nodeLevel(id);
+    if (level == 3)
+    {
+        uint64_t bits = 0;
+        leafBits(life, id, 3, 0, 0, bits);
+        const uint32_t rows = 8 - (uint32_t)(__builtin_clzll(bits) / 8);
+        for (uint32_t r = 0; r < rows; ++r)
+        {
+            const uint32_t row = (uint32_t)(bits >> (r * 8)) & 0xFF;
+            const uint32_t columns = row ? 32 - (uint32_t)__builtin_clz(row) : 0;
+            for (uint32_t c = 0; c < columns; ++c)
+                out.put(((row >> c) & 1) ? '*' : '.');
+            out.put('$');
+        }
+        out.put('\n');
+    }
+    else
+    {
+        uint32_t children[4];
+        life.nodeChildren(id, children);
+        uint32_t childLines[4];
+        for (int i = 0; i < 4; ++i)
+            childLines[i] = writeMacroNode(life, children[i], lines, count, out);
+        out.number(level);
+        for (int i = 0; i < 4; ++i)
+        {
+            out.put(' ');
+            out.number(childLines[i]);
+        }
+        out.put('\n');
+    }
+    lines[id] = ++count;
+    return (count);
+}
+
+bool saveMacrocell(const char* path, const HashLife& life)
+{
+    OutputStream out;
+    if (!out.open(path))
+        return (false);
+    out.write("[M2] (Episan)\n#R ");
+    out.write(life.rule().toString());
+    out.write("\n#G ");
+    out.number((int64_t)life.generation());
+    out.put('\n');
+
+    if (life.population() == 0)
+        out.write("$\n");
+    else
+    {
+        std::vector<uint32_t> lines(life.nodeIdLimit(), 0);
+        uint32_t count = 0;
+        writeMacroNode(life, life.root(), lines, count, out);
+    }
+    return (out.close());
+}
+
+}
@@ -0,0 +1,133 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: RMDLPatternIO.hpp             +++     +++     **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 17/10/2026 21:30:52      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef RMDLPATTERNIO_HPP
+# define RMDLPATTERNIO_HPP
+
+# include <cstddef>
+# include <cstdint>
+# include <unordered_map>
+
+# include "JDLV_shared.h"
+# include "RMDLLifeRule.hpp"
+
+class LifeEngine;
+class LifeUniverse;
+class HashLife;
+
+/// RLE and Macrocell (.mc) readers and writers. Readers parse the mapped
+/// file in place and hand runs of cells to a PatternSink, which writes them
+/// straight into a board; writers stream through a fixed-size buffer.
+namespace pattern_io
+{
+    struct PatternInfo
+    {
+        int64_t     originX;        // top-left cell of the pattern
+        int64_t     originY;
+        int64_t     width;          // RLE header size, 2^level for Macrocell
+        int64_t     height;
+        LifeRule    rule;
+        bool        hasRule;
+        uint64_t    generation;     // Macrocell #G line
+    };
+
+    class PatternSink
+    {
+    public:
+        virtual ~PatternSink() {}
+
+        /// Called once the header is known, before the first run.
+        virtual void    begin(const PatternInfo& info) { (void)info; }
+        /// `length` cells of `state` (> 0) from (x, y) rightwards.
+        virtual void    run(int64_t x, int64_t y, uint64_t length, uint32_t state) = 0;
+        /// Inclusive area worth reading; Macrocell subtrees outside it are skipped.
+        virtual bool    window(int64_t& x0, int64_t& y0, int64_t& x1, int64_t& y1) const { (void)x0; (void)y0; (void)x1; (void)y1; return (false); }
+        virtual void    finish() {}
+    };
+
+    /// One uint32_t per cell, the _pGridBuffer_A/_B layout. Keeps Generations states.
+    class GridSink : public PatternSink
+    {
+    public:
+        /// `centre` moves the pattern to the middle of the grid.
+        GridSink(const JDLVState& state, uint32_t* grid, bool centre);
+
+        void    begin(const PatternInfo& info) override;
+        void    run(int64_t x, int64_t y, uint64_t length, uint32_t state) override;
+        bool    window(int64_t& x0, int64_t& y0, int64_t& x1, int64_t& y1) const override;
+
+    private:
+        JDLVState   _state;
+        uint32_t*   _grid;
+        bool        _centre;
+        int64_t     _offsetX;
+        int64_t     _offsetY;
+    };
+
+    /// Packed bits of a LifeEngine, whole words at a time. State 1 only.
+    class LifeEngineSink : public PatternSink
+    {
+    public:
+        explicit LifeEngineSink(LifeEngine& engine);
+
+        void    run(int64_t x, int64_t y, uint64_t length, uint32_t state) override;
+        bool    window(int64_t& x0, int64_t& y0, int64_t& x1, int64_t& y1) const override;
+        void    finish() override;
+
+    private:
+        LifeEngine& _engine;
+    };
+
+    class LifeUniverseSink : public PatternSink
+    {
+    public:
+        explicit LifeUniverseSink(LifeUniverse& universe) : _universe(universe) {}
+
+        void    run(int64_t x, int64_t y, uint64_t length, uint32_t state) override;
+
+    private:
+        LifeUniverse& _universe;
+    };
+
+    /// Gathers 8x8 leaves and builds the quadtree bottom-up in finish(),
+    /// replacing the HashLife universe (setCell per cell would rebuild a path each time).
+    class HashLifeSink : public PatternSink
+    {
+    public:
+        explicit HashLifeSink(HashLife& life) : _life(life) {}
+
+        void    run(int64_t x, int64_t y, uint64_t length, uint32_t state) override;
+        void    finish() override;
+
+    private:
+        HashLife&                               _life;
+        std::unordered_map<uint64_t, uint64_t>  _leaves;    // (x >> 3, y >> 3) -> 8x8 bits
+    };
+
+    bool    isMacrocell(const char* data, size_t size);
+
+    /// Cell (0, 0) of the pattern (or its #CXRLE Pos) lands on (originX, originY).
+    bool    readRLE(const char* data, size_t size, PatternSink& sink, PatternInfo& info, int64_t originX = 0, int64_t originY = 0);
+    /// The root is centred on (originX, originY), as HashLife does.
+    bool    readMacrocell(const char* data, size_t size, PatternSink& sink, PatternInfo& info, int64_t originX = 0, int64_t originY = 0);
+    /// Rebuilds the quadtree node for node, no cell is ever expanded.
+    bool    readMacrocell(const char* data, size_t size, HashLife& life, PatternInfo& info);
+
+    /// Maps the file and picks the reader from its contents.
+    bool    loadPattern(const char* path, PatternSink& sink, PatternInfo& info, int64_t originX = 0, int64_t originY = 0);
+    /// Also applies the rule and the Macrocell generation.
+    bool    loadPattern(const char* path, HashLife& life, PatternInfo& info);
+
+    bool    saveRLE(const char* path, const LifeEngine& engine);
+    bool    saveRLE(const char* path, const LifeUniverse& universe);
+    bool    saveMacrocell(const char* path, const HashLife& life);
+}
+
+#endif /* RMDLPATTERNIO_HPP */
@@ -0,0 +1,767 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: RMDLRuleTable.cpp               +++     +++   **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 18/10/2026 21:12:46      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <functional>
+#include <map>
+#include <set>
+#include <unordered_map>
+
+#include "RMDLMappedFile.hpp"
+#include "RMDLRuleTable.hpp"
+
+// Largest table (states * classes^neighbours bytes) the compiler will build.
+static constexpr uint64_t kMaxTableEntries = 1ull << 26;
+
+// Golly's WireWorld: 0 empty, 1 electron head, 2 electron tail, 3 conductor.
+static const char* const kWireWorld =
+    "@RULE WireWorld\n"
+    "@TABLE\n"
+    "n_states:4\n"
+    "neighborhood:Moore\n"
+    "symmetries:permute\n"
+    "var a={0,1,2,3}\n"
+    "var b=a\nvar c=a\nvar d=a\nvar e=a\nvar f=a\nvar g=a\nvar h=a\n"
+    "var p={0,2,3}\n"
+    "var q=p\nvar r=p\nvar s=p\nvar t=p\nvar u=p\nvar v=p\n"
+    "1,a,b,c,d,e,f,g,h,2\n"
+    "2,a,b,c,d,e,f,g,h,3\n"
+    "3,1,p,q,r,s,t,u,v,1\n"
+    "3,1,1,p,q,r,s,t,u,1\n";
+
+static std::string trim(const std::string& text)
+{
+    size_t begin = 0, end = text.size();
+    while (begin < end && isspace((unsigned char)text[begin]))
+        ++begin;
+    while (end > begin && isspace((unsigned char)text[end - 1]))
+        --end;
+    return (text.substr(begin, end - begin));
+}
+
+static std::string lower(std::string text)
+{
+    for (char& c : text)
+        c = (char)tolower((unsigned char)c);
+    return (text);
+}
+
+static bool parseState(const std::string& token, uint32_t& state)
+{
+    if (token.empty() || token.size() > 3)
+        return (false);
+    state = 0;
+    for (char c : token)
+    {
+        if (!isdigit((unsigned char)c))
+            return (false);
+        state = state * 10 + (uint32_t)(c - '0');
+    }
+    return (true);
+}
+
+/// Parses the @TABLE section and compiles it. States that no transition
+/// tells apart as a neighbour are first split into coarse classes, so the
+/// transitions expand over their variables and symmetries into a
+/// states * classes^k table (last transition first, so the first match in
+/// the file wins) rather than states^(k+1). Classes the table still cannot
+/// tell apart are then merged.
+class RuleTableCompiler
+{
+public:
+    explicit RuleTableCompiler(RuleTable& table) : _table(table), _states(0), _moore(true), _symmetry("none") {}
+
+    bool parse(const std::string& text);
+    bool compile();
+
+private:
+    struct Transition
+    {
+        std::vector<int32_t> slots;     // centre, neighbours, output: a state, or -1 - variable
+        uint32_t line;
+    };
+
+    bool header(const std::string& key, const std::string& value, uint32_t line);
+    bool variable(const std::string& definition, uint32_t line);
+    bool transition(const std::string& text, uint32_t line);
+    bool token(const std::string& text, int32_t& slot, uint32_t line) const;
+    bool symmetries(std::vector<std::vector<uint32_t>>& permutations) const;
+    void expand(const Transition& transition, const std::vector<std::vector<uint32_t>>& permutations);
+    void expandPermute();
+    void partition();
+    void reduce();
+
+    uint32_t neighbours() const { return (_moore ? 8 : 4); }
+    uint64_t index(uint32_t centre, const uint32_t* classes) const;
+
+    RuleTable&                                  _table;
+    uint32_t                                    _states;
+    bool                                        _moore;
+    std::string                                 _symmetry;
+    std::map<std::string, uint32_t>             _variableIndex;
+    std::vector<std::vector<uint8_t>>           _variables;
+    std::vector<Transition>                     _transitions;
+    std::vector<uint8_t>                        _coarseClass;   // per state
+    std::vector<std::vector<uint8_t>>           _distinct;      // each variable, one state per coarse class
+    uint32_t                                    _coarseClasses;
+    std::vector<uint8_t>                        _coarse;        // indexed by centre state and coarse classes
+    std::vector<uint64_t>                       _power;         // coarse classes^i
+};
+
+bool RuleTableCompiler::parse(const std::string& text)
+{
+    // A file without any @ section is a bare .table.
+    bool inTable = text.find('@') == std::string::npos;
+    bool sawTable = inTable, sawTree = false;
+    uint32_t line = 0;
+    size_t begin = 0;
+
+    while (begin <= text.size())
+    {
+        size_t end = text.find('\n', begin);
+        if (end == std::string::npos)
+            end = text.size();
+        std::string content = text.substr(begin, end - begin);
+        begin = end + 1;
+        ++line;
+
+        const size_t comment = content.find('#');
+        if (comment != std::string::npos)
+            content.resize(comment);
+        content = trim(content);
+        if (content.empty())
+            continue;
+
+        if (content[0] == '@')
+        {
+            const std::string section = content.substr(0, content.find_first_of(" \t"));
+            inTable = section == "@TABLE";
+            sawTable |= inTable;
+            sawTree |= section == "@TREE";
+            if (section == "@RULE")
+                _table._name = trim(content.substr(section.size()));
+            continue;
+        }
+        if (!inTable)
+            continue;
+
+        const size_t colon = content.find(':');
+        bool ok;
+        if (colon != std::string::npos)
+            ok = header(lower(trim(content.substr(0, colon))), trim(content.substr(colon + 1)), line);
+        else if (content.compare(0, 4, "var ") == 0 || content.compare(0, 4, "var\t") == 0)
+            ok = variable(content.substr(4), line);
+        else
+            ok = transition(content, line);
+        if (!ok)
+            return (false);
+    }
+
+    if (!sawTable)
+    {
+        printf("RuleTable: %s\n", sawTree ? "@TREE rules are not supported" : "no @TABLE section");
+        return (false);
+    }
+    if (_states == 0)
+    {
+        printf("RuleTable: missing n_states\n");
+        return (false);
+    }
+    return (true);
+}
+
+bool RuleTableCompiler::header(const std::string& key, const std::string& value, uint32_t line)
+{
+    if (key == "n_states")
+    {
+        if (!parseState(value, _states) || _states < 2 || _states > 256)
+        {
+            printf("RuleTable: line %u: n_states must be in 2..256\n", line);
+            return (false);
+        }
+    }
+    else if (key == "neighborhood")
+    {
+        const std::string name = lower(value);
+        if (name != "moore" && name != "vonneumann")
+        {
+            printf("RuleTable: line %u: unsupported neighborhood %s\n", line, value.c_str());
+            return (false);
+        }
+        _moore = name == "moore";
+    }
+    else if (key == "symmetries")
+        _symmetry = lower(value);
+    else
+    {
+        printf("RuleTable: line %u: unknown key %s\n", line, key.c_str());
+        return (false);
+    }
+    if (!_transitions.empty() || !_variables.empty())
+    {
+        printf("RuleTable: line %u: %s after the first var or transition\n", line, key.c_str());
+        return (false);
+    }
+    return (true);
+}
+
+bool RuleTableCompiler::variable(const std::string& definition, uint32_t line)
+{
+    const size_t equals = definition.find('=');
+    if (equals == std::string::npos || _states == 0)
+    {
+        printf("RuleTable: line %u: bad var\n", line);
+        return (false);
+    }
+    const std::string name = trim(definition.substr(0, equals));
+    std::string body = trim(definition.substr(equals + 1));
+    uint32_t state;
+    if (name.empty() || parseState(name, state) || _variableIndex.count(name))
+    {
+        printf("RuleTable: line %u: bad or duplicate var name '%s'\n", line, name.c_str());
+        return (false);
+    }
+
+    // "var b=a" copies a; otherwise a brace list of states and earlier variables.
+    if (body.size() >= 2 && body.front() == '{' && body.back() == '}')
+        body = body.substr(1, body.size() - 2);
+    std::vector<uint8_t> values;
+    size_t begin = 0;
+    while (begin <= body.size())
+    {
+        size_t end = body.find(',', begin);
+        if (end == std::string::npos)
+            end = body.size();
+        const std::string item = trim(body.substr(begin, end - begin));
+        begin = end + 1;
+        if (parseState(item, state) && state < _states)
+            values.push_back((uint8_t)state);
+        else if (_variableIndex.count(item))
+        {
+            const std::vector<uint8_t>& other = _variables[_variableIndex[item]];
+            values.insert(values.end(), other.begin(), other.end());
+        }
+        else
+        {
+            printf("RuleTable: line %u: bad value '%s' in var %s\n", line, item.c_str(), name.c_str());
+            return (false);
+        }
+    }
+    std::sort(values.begin(), values.end());
+    values.erase(std::unique(values.begin(), values.end()), values.end());
+
+    _variableIndex[name] = (uint32_t)_variables.size();
+    _variables.push_back(values);
+    return (true);
+}
+
+bool RuleTableCompiler::token(const std::string& text, int32_t& slot, uint32_t line) const
+{
+    uint32_t state;
+    if (parseState(text, state))
+    {
+        if (state >= _states)
+        {
+            printf("RuleTable: line %u: state %u out of range\n", line, state);
+            return (false);
+        }
+        slot = (int32_t)state;
+        return (true);
+    }
+    const std::map<std::string, uint32_t>::const_iterator found = _variableIndex.find(text);
+    if (found == _variableIndex.end())
+    {
+        printf("RuleTable: line %u: unknown variable '%s'\n", line, text.c_str());
+        return (false);
+    }
+    slot = -1 - (int32_t)found->second;
+    return (true);
+}
+
+bool RuleTableCompiler::transition(const std::string& text, uint32_t line)
+{
+    if (_states == 0)
+    {
+        printf("RuleTable: line %u: transition before n_states\n", line);
+        return (false);
+    }
+
+    // Comma separated, or one character per state when every state is a digit.
+    std::vector<std::string> tokens;
+    if (text.find(',') != std::string::npos)
+    {
+        size_t begin = 0;
+        while (begin <= text.size())
+        {
+            size_t end = text.find(',', begin);
+            if (end == std::string::npos)
+                end = text.size();
+            tokens.push_back(trim(text.substr(begin, end - begin)));
+            begin = end + 1;
+        }
+    }
+    else if (_states <= 10)
+    {
+        for (char c : text)
+            if (!isspace((unsigned char)c))
+                tokens.push_back(std::string(1, c));
+    }
+
+    Transition entry;
+    entry.line = line;
+    if (tokens.size() != neighbours() + 2)
+    {
+        printf("RuleTable: line %u: expected %u fields\n", line, neighbours() + 2);
+        return (false);
+    }
+    entry.slots.resize(tokens.size());
+    for (size_t i = 0; i < tokens.size(); ++i)
+        if (!token(tokens[i], entry.slots[i], line))
+            return (false);
+
+    // The output may only name a variable the inputs have already bound.
+    const int32_t output = entry.slots.back();
+    if (output < 0 && std::find(entry.slots.begin(), entry.slots.end() - 1, output) == entry.slots.end() - 1)
+    {
+        printf("RuleTable: line %u: output variable is not bound\n", line);
+        return (false);
+    }
+    _transitions.push_back(entry);
+    return (true);
+}
+
+bool RuleTableCompiler::symmetries(std::vector<std::vector<uint32_t>>& permutations) const
+{
+    // Neighbour i of a transition lands on position permutation[i].
+    const uint32_t k = neighbours();
+    const uint32_t quarter = k / 4;
+    std::vector<uint32_t> identity(k), reflection(k);
+    for (uint32_t i = 0; i < k; ++i)
+    {
+        identity[i] = i;
+        reflection[i] = (k - i) % k;        // mirror through the N-S axis
+    }
+
+    uint32_t rotationStep;
+    bool reflect;
+    if (_symmetry == "none")
+        rotationStep = k, reflect = false;
+    else if (_symmetry == "rotate4")
+        rotationStep = quarter, reflect = false;
+    else if (_symmetry == "rotate8" && _moore)
+        rotationStep = 1, reflect = false;
+    else if (_symmetry == "reflect_horizontal")
+        rotationStep = k, reflect = true;
+    else if (_symmetry == "rotate4reflect")
+        rotationStep = quarter, reflect = true;
+    else if (_symmetry == "rotate8reflect" && _moore)
+        rotationStep = 1, reflect = true;
+    else
+    {
+        printf("RuleTable: unsupported symmetries %s\n", _symmetry.c_str());
+        return (false);
+    }
+
+    for (uint32_t r = 0; r < k; r += rotationStep)
+    {
+        std::vector<uint32_t> rotated(k);
+        for (uint32_t i = 0; i < k; ++i)
+            rotated[i] = (i + r) % k;
+        permutations.push_back(rotated);
+        if (reflect)
+        {
+            std::vector<uint32_t> mirrored(k);
+            for (uint32_t i = 0; i < k; ++i)
+                mirrored[i] = reflection[rotated[i]];
+            permutations.push_back(mirrored);
+        }
+    }
+    return (true);
+}
+
+uint64_t RuleTableCompiler::index(uint32_t centre, const uint32_t* classes) const
+{
+    uint64_t index = centre * _power[neighbours()];
+    for (uint32_t i = 0; i < neighbours(); ++i)
+        index += classes[i] * _power[i];
+    return (index);
+}
+
+// Walks every binding of the transition's variables (a repeated variable takes one value).
+// The centre's variable runs over all its states, the others over `distinct`.
+static void bindings(const std::vector<int32_t>& slots, const std::vector<std::vector<uint8_t>>& variables,
+                     const std::vector<std::vector<uint8_t>>& distinct,
+                     const std::function<void(const std::vector<uint32_t>&)>& visit)
+{
+    std::vector<int32_t> free;
+    std::vector<const std::vector<uint8_t>*> domain;
+    for (int32_t slot : slots)
+        if (slot < 0 && std::find(free.begin(), free.end(), slot) == free.end())
+        {
+            free.push_back(slot);
+            domain.push_back(slot == slots[0] ? &variables[(size_t)(-1 - slot)] : &distinct[(size_t)(-1 - slot)]);
+        }
+
+    std::vector<size_t> choice(free.size(), 0);
+    std::vector<uint32_t> values(slots.size());
+    for (;;)
+    {
+        for (size_t i = 0; i < slots.size(); ++i)
+        {
+            if (slots[i] >= 0)
+                values[i] = (uint32_t)slots[i];
+            else
+            {
+                const size_t bound = std::find(free.begin(), free.end(), slots[i]) - free.begin();
+                values[i] = (*domain[bound])[choice[bound]];
+            }
+        }
+        visit(values);
+
+        size_t digit = 0;
+        while (digit < free.size() && ++choice[digit] == domain[digit]->size())
+            choice[digit++] = 0;
+        if (digit == free.size())
+            return;
+    }
+}
+
+void RuleTableCompiler::expand(const Transition& transition, const std::vector<std::vector<uint32_t>>& permutations)
+{
+    const uint32_t k = neighbours();
+    std::vector<uint32_t> placed(k);
+
+    bindings(transition.slots, _variables, _distinct, [&](const std::vector<uint32_t>& values)
+    {
+        for (const std::vector<uint32_t>& permutation : permutations)
+        {
+            for (uint32_t i = 0; i < k; ++i)
+                placed[permutation[i]] = _coarseClass[values[1 + i]];
+            _coarse[index(values[0], placed.data())] = (uint8_t)values[k + 1];
+        }
+    });
+}
+
+void RuleTableCompiler::expandPermute()
+{
+    // Key on the centre and the sorted neighbour classes; the first transition to claim a key keeps it.
+    const uint32_t k = neighbours();
+    std::unordered_map<uint64_t, uint8_t> outputs;
+    std::vector<uint32_t> sorted(k);
+
+    for (const Transition& transition : _transitions)
+    {
+        bindings(transition.slots, _variables, _distinct, [&](const std::vector<uint32_t>& values)
+        {
+            for (uint32_t i = 0; i < k; ++i)
+                sorted[i] = _coarseClass[values[1 + i]];
+            std::sort(sorted.begin(), sorted.end());
+            outputs.emplace(index(values[0], sorted.data()), (uint8_t)values[k + 1]);
+        });
+    }
+
+    for (uint64_t i = 0; i < _coarse.size(); ++i)
+    {
+        uint64_t rest = i;
+        for (uint32_t p = 0; p < k; ++p)
+        {
+            sorted[p] = (uint32_t)(rest % _coarseClasses);
+            rest /= _coarseClasses;
+        }
+        std::sort(sorted.begin(), sorted.end());
+        const std::unordered_map<uint64_t, uint8_t>::const_iterator found = outputs.find(index((uint32_t)rest, sorted.data()));
+        if (found != outputs.end())
+            _coarse[i] = found->second;
+    }
+}
+
+void RuleTableCompiler::partition()
+{
+    // Two states stay together while every neighbour slot of every transition
+    // accepts both or neither. A variable repeated in a transition ties its
+    // neighbour to another slot, so there each of its states is told apart.
+    const uint32_t k = neighbours();
+    std::set<std::pair<int32_t, bool>> seen;
+    _coarseClass.assign(_states, 0);
+    _coarseClasses = 1;
+
+    for (const Transition& transition : _transitions)
+    {
+        for (uint32_t i = 1; i <= k; ++i)
+        {
+            const int32_t slot = transition.slots[i];
+            const bool tied = slot < 0 && std::count(transition.slots.begin(), transition.slots.end(), slot) > 1;
+            if (!seen.insert(std::make_pair(slot, tied)).second)
+                continue;
+            std::map<std::pair<uint32_t, uint32_t>, uint32_t> split;
+            for (uint32_t s = 0; s < _states; ++s)
+            {
+                uint32_t key = s == (uint32_t)slot;
+                if (slot < 0)
+                {
+                    const std::vector<uint8_t>& values = _variables[(size_t)(-1 - slot)];
+                    key = !std::binary_search(values.begin(), values.end(), (uint8_t)s) ? 0 : tied ? 1 + s : 1;
+                }
+                const uint32_t fresh = (uint32_t)split.size();
+                _coarseClass[s] = (uint8_t)split.emplace(std::make_pair((uint32_t)_coarseClass[s], key), fresh).first->second;
+            }
+            _coarseClasses = (uint32_t)split.size();
+        }
+    }
+
+    _distinct.assign(_variables.size(), std::vector<uint8_t>());
+    for (size_t v = 0; v < _variables.size(); ++v)
+    {
+        std::vector<bool> taken(_coarseClasses, false);
+        for (uint8_t s : _variables[v])
+            if (!taken[_coarseClass[s]])
+            {
+                taken[_coarseClass[s]] = true;
+                _distinct[v].push_back(s);
+            }
+    }
+}
+
+void RuleTableCompiler::reduce()
+{
+    // Coarse class s joins r's class when swapping r for s at any one neighbour position never changes the output.
+    const uint32_t k = neighbours();
+    std::vector<uint32_t> representative;
+    std::vector<uint8_t> merge(_coarseClasses, 0);
+
+    for (uint32_t s = 0; s < _coarseClasses; ++s)
+    {
+        bool merged = false;
+        for (uint32_t c = 0; c < representative.size() && !merged; ++c)
+        {
+            const uint32_t r = representative[c];
+            bool same = true;
+            for (uint32_t p = 0; p < k && same; ++p)
+            {
+                const uint64_t low = _power[p], high = _power[p + 1];
+                for (uint64_t h = 0; h < _coarse.size() && same; h += high)
+                    for (uint64_t l = 0; l < low && same; ++l)
+                        same = _coarse[h + r * low + l] == _coarse[h + s * low + l];
+            }
+            if (same)
+            {
+                merge[s] = (uint8_t)c;
+                merged = true;
+            }
+        }
+        if (!merged)
+        {
+            merge[s] = (uint8_t)representative.size();
+            representative.push_back(s);
+        }
+    }
+    for (uint32_t s = 0; s < _states; ++s)
+        _table._class[s] = merge[_coarseClass[s]];
+
+    const uint32_t m = (uint32_t)representative.size();
+    _table._classes = m;
+    uint32_t weight = 1;
+    for (uint32_t i = 0; i < k; ++i, weight *= m)
+        _table._weight[i] = weight;
+    _table._weight[k] = weight;
+
+    _table._lookup.assign((size_t)_states * weight + 3, 0);
+    std::vector<uint32_t> neighbourClasses(k);
+    for (uint32_t centre = 0; centre < _states; ++centre)
+    {
+        for (uint32_t i = 0; i < weight; ++i)
+        {
+            uint32_t rest = i;
+            for (uint32_t p = 0; p < k; ++p, rest /= m)
+                neighbourClasses[p] = representative[rest % m];
+            _table._lookup[(size_t)centre * weight + i] = _coarse[index(centre, neighbourClasses.data())];
+        }
+    }
+}
+
+bool RuleTableCompiler::compile()
+{
+    const uint32_t k = neighbours();
+    partition();
+    _power.assign(k + 1, 1);
+    for (uint32_t i = 1; i <= k; ++i)
+    {
+        _power[i] = _power[i - 1] * _coarseClasses;
+        if (_power[i] * _states > kMaxTableEntries)
+        {
+            printf("RuleTable: %u states in %u neighbour classes are too many to compile\n", _states, _coarseClasses);
+            return (false);
+        }
+    }
+
+    _coarse.resize(_states * _power[k]);
+    for (uint64_t i = 0; i < _coarse.size(); ++i)
+        _coarse[i] = (uint8_t)(i / _power[k]);     // no transition: the cell keeps its state
+
+    if (_symmetry == "permute")
+        expandPermute();
+    else
+    {
+        std::vector<std::vector<uint32_t>> permutations;
+        if (!symmetries(permutations))
+            return (false);
+        for (size_t t = _transitions.size(); t-- > 0;)
+            expand(_transitions[t], permutations);
+    }
+
+    _table._states = _states;
+    _table._neighbourhood = _moore ? RuleTable::Neighbourhood::Moore : RuleTable::Neighbourhood::VonNeumann;
+    reduce();
+    // Cells past the last state read as state 0.
+    for (uint32_t s = _states; s < 256; ++s)
+        _table._class[s] = _table._class[0];
+    return (true);
+}
+
+RuleTable::RuleTable()
+{
+    fromLifeRule(LifeRule::conway(), *this);
+}
+
+bool RuleTable::parse(const std::string& text, RuleTable& table)
+{
+    RuleTable out;
+    out._name.clear();
+    RuleTableCompiler compiler(out);
+    if (!compiler.parse(text) || !compiler.compile())
+        return (false);
+    table = out;
+    return (true);
+}
+
+bool RuleTable::load(const char* path, RuleTable& table)
+{
+    MappedFile file;
+    if (!file.open(path))
+        return (false);
+    return (parse(std::string(file.data(), file.size()), table));
+}
+
+bool RuleTable::fromLifeRule(const LifeRule& rule, RuleTable& table)
+{
+    const uint32_t states = std::max<uint32_t>(rule.states, 2);
+    if (states > 256)
+    {
+        printf("RuleTable: rule %s has too many states\n", rule.toString().c_str());
+        return (false);
+    }
+
+    // Only state 1 counts as a neighbour: two classes, one bit per neighbour.
+    table._name = rule.toString();
+    table._states = states;
+    table._neighbourhood = Neighbourhood::Moore;
+    table._classes = 2;
+    for (uint32_t s = 0; s < 256; ++s)
+        table._class[s] = s == 1;
+    for (uint32_t i = 0; i < 9; ++i)
+        table._weight[i] = 1u << i;
+
+    table._lookup.assign((size_t)states * 256 + 3, 0);
+    for (uint32_t centre = 0; centre < states; ++centre)
+    {
+        for (uint32_t neighbours = 0; neighbours < 256; ++neighbours)
+        {
+            const uint32_t live = (uint32_t)__builtin_popcount(neighbours);
+            const uint32_t mask = centre == 1 ? rule.survive : rule.birth;
+            const bool alive = ((mask >> live) & 1) != 0 && centre <= 1;
+            const uint32_t aged = centre == 0 ? 0 : (centre + 1) % states;
+            table._lookup[(size_t)centre * 256 + neighbours] = (uint8_t)(alive ? 1 : aged);
+        }
+    }
+    return (true);
+}
+
+RuleTable RuleTable::wireWorld()
+{
+    RuleTable table;
+    parse(kWireWorld, table);
+    return (table);
+}
+
+static void putWord(std::vector<uint8_t>& out, uint32_t value)
+{
+    for (uint32_t i = 0; i < 4; ++i)
+        out.push_back((uint8_t)(value >> (8 * i)));
+}
+
+static bool getWord(const uint8_t*& data, const uint8_t* end, uint32_t& value)
+{
+    if (end - data < 4)
+        return (false);
+    value = (uint32_t)data[0] | ((uint32_t)data[1] << 8) | ((uint32_t)data[2] << 16) | ((uint32_t)data[3] << 24);
+    data += 4;
+    return (true);
+}
+
+// [name length] [name] [states] [neighbourhood] [classes] [class x 256] [weight x 9] [lookup size] [lookup]
+void RuleTable::serialize(std::vector<uint8_t>& out) const
+{
+    putWord(out, (uint32_t)_name.size());
+    out.insert(out.end(), _name.begin(), _name.end());
+    putWord(out, _states);
+    putWord(out, _neighbourhood == Neighbourhood::Moore ? 0 : 1);
+    putWord(out, _classes);
+    out.insert(out.end(), _class, _class + 256);
+    for (uint32_t i = 0; i < 9; ++i)
+        putWord(out, _weight[i]);
+    putWord(out, (uint32_t)lookupSize());
+    out.insert(out.end(), _lookup.begin(), _lookup.begin() + lookupSize());
+}
+
+bool RuleTable::deserialize(const uint8_t* data, size_t size, RuleTable& table)
+{
+    const uint8_t* end = data + size;
+    RuleTable out;
+    uint32_t length, neighbourhood, lookup;
+    if (!getWord(data, end, length) || (size_t)(end - data) < length)
+        return (false);
+    out._name.assign((const char*)data, length);
+    data += length;
+    if (!getWord(data, end, out._states) || !getWord(data, end, neighbourhood) || !getWord(data, end, out._classes)
+        || end - data < 256)
+        return (false);
+    std::copy(data, data + 256, out._class);
+    data += 256;
+    for (uint32_t i = 0; i < 9; ++i)
+        if (!getWord(data, end, out._weight[i]))
+            return (false);
+    if (!getWord(data, end, lookup) || (size_t)(end - data) != lookup)
+        return (false);
+    out._neighbourhood = neighbourhood == 0 ? Neighbourhood::Moore : Neighbourhood::VonNeumann;
+    // Every index next() can form must stay inside the table.
+    bool valid = out._states >= 2 && out._states <= 256 && out._classes > 0
+        && (size_t)out._states * out._weight[out.neighbours()] == lookup;
+    for (uint32_t s = 0; s < 256 && valid; ++s)
+        valid = out._class[s] < out._classes;
+    if (!valid)
+    {
+        printf("RuleTable: malformed serialized table\n");
+        return (false);
+    }
+    out._lookup.assign(data, data + lookup);
+    out._lookup.insert(out._lookup.end(), 3, 0);
+    table = std::move(out);
+    return (true);
+}
+
+uint8_t RuleTable::next(uint8_t centre, const uint8_t* neighbours) const
+{
+    size_t index = (size_t)centre * _weight[this->neighbours()];
+    for (uint32_t i = 0; i < this->neighbours(); ++i)
+        index += _class[neighbours[i]] * _weight[i];
+    return (_lookup[index]);
+}
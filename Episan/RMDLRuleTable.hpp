@@ -0,0 +1,81 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: RMDLRuleTable.hpp               +++     +++   **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 18/10/2026 21:12:40      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef RMDLRULETABLE_HPP
+# define RMDLRULETABLE_HPP
+
+# include <cstddef>
+# include <cstdint>
+# include <string>
+# include <vector>
+
+# include "RMDLLifeRule.hpp"
+
+/// A cellular automaton over up to 256 states on a Moore or von Neumann
+/// neighbourhood, compiled to one dense byte table. States the rule cannot
+/// tell apart as neighbours share a class, and the table is indexed by
+///     centre * m^k + sum(class(neighbour i) * m^i)
+/// for m classes and k neighbours in Golly order (N, NE, E, SE, S, SW, W, NW,
+/// or N, E, S, W). WireWorld and every Generations rule have two classes,
+/// so their tables are 256 bytes per state. The compiler never builds the
+/// states^(k+1) table either, so what limits a rule is its class count
+/// (states * m^k must stay under 64 MB), not its state count.
+class RuleTable
+{
+public:
+    enum class Neighbourhood
+    {
+        Moore,
+        VonNeumann
+    };
+
+    /// Conway's Life.
+    RuleTable();
+
+    /// Golly .rule text (its @TABLE section) or a bare .table file. @TREE is not supported.
+    static bool parse(const std::string& text, RuleTable& table);
+    static bool load(const char* path, RuleTable& table);
+    /// Life-like and Generations rules, with the semantics of JDLVReference.
+    static bool fromLifeRule(const LifeRule& rule, RuleTable& table);
+    static RuleTable wireWorld();
+    /// The compiled table as bytes, for logs; deserialize() takes it back without recompiling.
+    void                serialize(std::vector<uint8_t>& out) const;
+    static bool         deserialize(const uint8_t* data, size_t size, RuleTable& table);
+
+    const std::string&  name() const            { return _name; }
+    uint32_t            states() const          { return _states; }
+    Neighbourhood       neighbourhood() const   { return _neighbourhood; }
+    uint32_t            neighbours() const      { return (_neighbourhood == Neighbourhood::Moore ? 8 : 4); }
+    uint32_t            classes() const         { return _classes; }
+    /// States past states() behave like state 0.
+    uint8_t             stateClass(uint8_t state) const { return _class[state]; }
+    /// Table weight of neighbour `position`, or of the centre for position == neighbours().
+    uint32_t            weight(uint32_t position) const { return _weight[position]; }
+
+    /// lookupSize() bytes, followed by three zero bytes so 32-bit gathers stay in bounds.
+    const uint8_t*      lookup() const          { return _lookup.data(); }
+    size_t              lookupSize() const      { return _lookup.size() - 3; }
+
+    /// Next state of `centre` given its neighbours in Golly order.
+    uint8_t             next(uint8_t centre, const uint8_t* neighbours) const;
+
+private:
+    std::string             _name;
+    uint32_t                _states;
+    Neighbourhood           _neighbourhood;
+    uint32_t                _classes;
+    uint8_t                 _class[256];
+    uint32_t                _weight[9];
+    std::vector<uint8_t>    _lookup;
+
+    friend class RuleTableCompiler;
+};
+
+#endif /* RMDLRULETABLE_HPP */
@@ -0,0 +1,253 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: RMDLRuleTableEngine.cpp         +++     +++   **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 18/10/2026 22:03:24      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include <algorithm>
+#include <cstring>
+
+#include "RMDLRuleTableEngine.hpp"
+
+#if defined(__AVX2__)
+# define RMDL_LIFE_HAS_AVX2 1
+# include <immintrin.h>
+#endif
+
+// The gather kernel maps states to classes with one 16-entry byte shuffle
+// and sums the index in 16-bit lanes.
+static constexpr uint32_t kGatherMaxStates = 16;
+static constexpr size_t kGatherMaxTable = 1 << 16;
+static constexpr uint32_t kGatherCells = 16;
+
+RuleTableEngine::RuleTableEngine(const JDLVState& state, const RuleTable& table)
+    : _state(state)
+    , _stride((size_t)state.width + 2)
+    , _table(table)
+    , _current(0)
+    , _generation(0)
+    , _kernel(life_kernels::best())
+{
+    _cells[0].assign(_stride * ((size_t)state.height + 2), 0);
+    _cells[1].assign(_stride * ((size_t)state.height + 2), 0);
+    buildIndexTables();
+}
+
+void RuleTableEngine::setTopology(JDLVTopology topology, uint32_t paddingState)
+{
+    _state.topology = topology;
+    _state.paddingState = paddingState;
+}
+
+bool RuleTableEngine::setKernel(LifeKernel kernel)
+{
+    if (!life_kernels::available(kernel))
+        return (false);
+    _kernel = kernel;
+    return (true);
+}
+
+bool RuleTableEngine::vectorised() const
+{
+#if RMDL_LIFE_HAS_AVX2
+    return (_kernel == LifeKernel::AVX2 && _table.states() <= kGatherMaxStates && _table.lookupSize() <= kGatherMaxTable);
+#else
+    return (false);
+#endif
+}
+
+void RuleTableEngine::setTable(const RuleTable& table)
+{
+    _table = table;
+    buildIndexTables();
+    for (uint32_t y = 0; y < _state.height; ++y)
+    {
+        uint8_t* r = row((int32_t)y);
+        for (uint32_t x = 0; x < _state.width; ++x)
+            if (r[x] >= table.states())
+                r[x] = 0;
+    }
+}
+
+void RuleTableEngine::buildIndexTables()
+{
+    const uint32_t k = _table.neighbours();
+    for (uint32_t p = 0; p < k; ++p)
+        for (uint32_t s = 0; s < 256; ++s)
+            _index[p][s] = _table.stateClass((uint8_t)s) * _table.weight(p);
+    for (uint32_t s = 0; s < 256; ++s)
+        _index[k][s] = s < _table.states() ? s * _table.weight(k) : 0;
+}
+
+void RuleTableEngine::clear()
+{
+    std::fill(_cells[0].begin(), _cells[0].end(), 0);
+    std::fill(_cells[1].begin(), _cells[1].end(), 0);
+    _generation = 0;
+}
+
+void RuleTableEngine::setCell(uint32_t x, uint32_t y, uint8_t state)
+{
+    row((int32_t)y)[x] = state < _table.states() ? state : 0;
+}
+
+void RuleTableEngine::importGrid(const uint32_t* grid)
+{
+    for (uint32_t y = 0; y < _state.height; ++y)
+    {
+        uint8_t* r = row((int32_t)y);
+        const uint32_t* src = grid + (size_t)y * _state.width;
+        for (uint32_t x = 0; x < _state.width; ++x)
+            r[x] = src[x] < _table.states() ? (uint8_t)src[x] : 0;
+    }
+}
+
+void RuleTableEngine::exportGrid(uint32_t* grid) const
+{
+    for (uint32_t y = 0; y < _state.height; ++y)
+    {
+        const uint8_t* r = row((int32_t)y);
+        uint32_t* dst = grid + (size_t)y * _state.width;
+        for (uint32_t x = 0; x < _state.width; ++x)
+            dst[x] = r[x];
+    }
+}
+
+// Same cases as JDLVSample; the Klein bottle mirrors x across the top and bottom edges.
+void RuleTableEngine::fillHalo()
+{
+    const uint32_t width = _state.width;
+    const int32_t height = (int32_t)_state.height;
+    if (width == 0 || height == 0)
+        return;
+    uint8_t* top = row(-1);
+    uint8_t* bottom = row(height);
+
+    switch (_state.topology)
+    {
+        case JDLVTopologyTorus:
+            memcpy(top, row(height - 1), width);
+            memcpy(bottom, row(0), width);
+            break;
+        case JDLVTopologyKleinBottle:
+            std::reverse_copy(row(height - 1), row(height - 1) + width, top);
+            std::reverse_copy(row(0), row(0) + width, bottom);
+            break;
+        default:
+        {
+            // Padding past the table's last state is dead, as importGrid reads it.
+            const uint8_t padding = _state.topology == JDLVTopologyPadded && _state.paddingState < _table.states()
+                ? (uint8_t)_state.paddingState : 0;
+            std::fill(top - 1, top + width + 1, padding);
+            std::fill(bottom - 1, bottom + width + 1, padding);
+            for (int32_t y = 0; y < height; ++y)
+            {
+                row(y)[-1] = padding;
+                row(y)[width] = padding;
+            }
+            return;
+        }
+    }
+    // Both wrapping topologies wrap x, corners included (the halo rows are already in place).
+    for (int32_t y = -1; y <= height; ++y)
+    {
+        uint8_t* r = row(y);
+        r[-1] = r[width - 1];
+        r[width] = r[0];
+    }
+}
+
+void RuleTableEngine::stepRowScalar(const uint8_t* above, const uint8_t* centre, const uint8_t* below,
+                                    uint8_t* out, uint32_t begin, uint32_t end) const
+{
+    const uint8_t* lookup = _table.lookup();
+    if (_table.neighbourhood() == RuleTable::Neighbourhood::Moore)
+    {
+        for (ptrdiff_t x = begin; x < (ptrdiff_t)end; ++x)
+            out[x] = lookup[_index[0][above[x]] + _index[1][above[x + 1]] + _index[2][centre[x + 1]]
+                          + _index[3][below[x + 1]] + _index[4][below[x]] + _index[5][below[x - 1]]
+                          + _index[6][centre[x - 1]] + _index[7][above[x - 1]] + _index[8][centre[x]]];
+    }
+    else
+    {
+        for (ptrdiff_t x = begin; x < (ptrdiff_t)end; ++x)
+            out[x] = lookup[_index[0][above[x]] + _index[1][centre[x + 1]] + _index[2][below[x]]
+                          + _index[3][centre[x - 1]] + _index[4][centre[x]]];
+    }
+}
+
+// Returns how many cells it stepped, a multiple of kGatherCells; the scalar kernel does the rest.
+uint32_t RuleTableEngine::stepRowGather(const uint8_t* above, const uint8_t* centre, const uint8_t* below, uint8_t* out) const
+{
+#if RMDL_LIFE_HAS_AVX2
+    const bool moore = _table.neighbourhood() == RuleTable::Neighbourhood::Moore;
+    const uint32_t k = _table.neighbours();
+    // Golly order: N, NE, E, SE, S, SW, W, NW, or N, E, S, W.
+    const uint8_t* mooreSources[8] = { above, above + 1, centre + 1, below + 1, below, below - 1, centre - 1, above - 1 };
+    const uint8_t* vonNeumannSources[4] = { above, centre + 1, below, centre - 1 };
+    const uint8_t* const* sources = moore ? mooreSources : vonNeumannSources;
+
+    uint8_t classes[16];
+    for (uint32_t s = 0; s < 16; ++s)
+        classes[s] = _table.stateClass((uint8_t)s);
+    const __m128i classOf = _mm_loadu_si128((const __m128i*)classes);
+    __m256i weights[9];
+    for (uint32_t p = 0; p <= k; ++p)
+        weights[p] = _mm256_set1_epi16((short)_table.weight(p));
+    const int* lookup = (const int*)_table.lookup();
+    const __m256i low = _mm256_set1_epi32(0xFF);
+
+    const uint32_t cells = _state.width / kGatherCells * kGatherCells;
+    for (uint32_t x = 0; x < cells; x += kGatherCells)
+    {
+        __m256i index = _mm256_mullo_epi16(_mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*)(centre + x))), weights[k]);
+        for (uint32_t p = 0; p < k; ++p)
+        {
+            const __m128i states = _mm_loadu_si128((const __m128i*)(sources[p] + x));
+            const __m256i cls = _mm256_cvtepu8_epi16(_mm_shuffle_epi8(classOf, states));
+            index = _mm256_add_epi16(index, _mm256_mullo_epi16(cls, weights[p]));
+        }
+
+        const __m256i first = _mm256_cvtepu16_epi32(_mm256_castsi256_si128(index));
+        const __m256i second = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(index, 1));
+        const __m256i next0 = _mm256_and_si256(_mm256_i32gather_epi32(lookup, first, 1), low);
+        const __m256i next1 = _mm256_and_si256(_mm256_i32gather_epi32(lookup, second, 1), low);
+        // packus interleaves the 128-bit lanes; the permute puts the 16 words back in order.
+        const __m256i words = _mm256_permute4x64_epi64(_mm256_packus_epi32(next0, next1), 0xD8);
+        const __m128i bytes = _mm_packus_epi16(_mm256_castsi256_si128(words), _mm256_extracti128_si256(words, 1));
+        _mm_storeu_si128((__m128i*)(out + x), bytes);
+    }
+    return (cells);
+#else
+    (void)above; (void)centre; (void)below; (void)out;
+    return (0);
+#endif
+}
+
+void RuleTableEngine::step()
+{
+    fillHalo();
+
+    const bool gather = vectorised();
+    const uint32_t width = _state.width;
+    uint8_t* dst = _cells[_current ^ 1].data() + _stride + 1;
+    for (uint32_t y = 0; y < _state.height; ++y)
+    {
+        const uint8_t* r = row((int32_t)y);
+        uint8_t* out = dst + (size_t)y * _stride;
+        const uint32_t done = gather ? stepRowGather(r - _stride, r, r + _stride, out) : 0;
+        stepRowScalar(r - _stride, r, r + _stride, out, done, width);
+    }
+    _current ^= 1;
+    ++_generation;
+}
+
+void RuleTableEngine::step(uint64_t generations)
+{
+    while (generations--)
+        step();
+}
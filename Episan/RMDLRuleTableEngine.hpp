@@ -0,0 +1,85 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: RMDLRuleTableEngine.hpp         +++     +++   **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 18/10/2026 22:03:17      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef RMDLRULETABLEENGINE_HPP
+# define RMDLRULETABLEENGINE_HPP
+
+# include <cstddef>
+# include <cstdint>
+# include <vector>
+
+# include "JDLV_shared.h"
+# include "NonCopyable.h"
+# include "RMDLLifeKernels.hpp"
+# include "RMDLRuleTable.hpp"
+
+/// Steps any RuleTable on one byte per cell. Rows carry a one-byte halo on
+/// each side and there is a halo row above and below, filled from the
+/// topology once per generation, as in LifeEngine.
+/// The AVX2 kernel does 16 cells at a time: shuffles map states to classes,
+/// the table index is accumulated in 16-bit lanes and the next states are
+/// fetched with two 8-wide gathers. It needs at most 16 states and a table
+/// of at most 64K entries (WireWorld and Generations up to 16 states);
+/// other tables, and the NEON build, which has no gather, step with
+/// per-position index tables.
+class RuleTableEngine : public NonCopyable
+{
+public:
+    explicit RuleTableEngine(const JDLVState& state, const RuleTable& table = RuleTable());
+
+    const JDLVState&    state() const       { return _state; }
+    uint32_t            width() const       { return _state.width; }
+    uint32_t            height() const      { return _state.height; }
+    JDLVTopology        topology() const    { return (JDLVTopology)_state.topology; }
+    void                setTopology(JDLVTopology topology, uint32_t paddingState = 0);
+    uint64_t            generation() const  { return _generation; }
+    void                setGeneration(uint64_t generation) { _generation = generation; }
+    LifeKernel          kernel() const      { return _kernel; }
+    bool                setKernel(LifeKernel kernel);
+    /// True when step() runs the gather kernel for the current table.
+    bool                vectorised() const;
+
+    const RuleTable&    table() const       { return _table; }
+    /// Cells past the new table's last state are cleared.
+    void                setTable(const RuleTable& table);
+
+    void                clear();
+    uint8_t             cell(uint32_t x, uint32_t y) const { return row((int32_t)y)[x]; }
+    void                setCell(uint32_t x, uint32_t y, uint8_t state);
+
+    /// Same layout as _pGridBuffer_A/_B; states past the table's last read as 0.
+    void                importGrid(const uint32_t* grid);
+    void                exportGrid(uint32_t* grid) const;
+
+    void                fillHalo();
+    void                step();
+    void                step(uint64_t generations);
+
+    /// First real cell of row y (y may be -1 or height for the halo rows).
+    const uint8_t*      row(int32_t y) const { return _cells[_current].data() + (size_t)(y + 1) * _stride + 1; }
+    uint8_t*            row(int32_t y)       { return _cells[_current].data() + (size_t)(y + 1) * _stride + 1; }
+
+private:
+    void                buildIndexTables();
+    void                stepRowScalar(const uint8_t* above, const uint8_t* centre, const uint8_t* below,
+                                      uint8_t* out, uint32_t begin, uint32_t end) const;
+    uint32_t            stepRowGather(const uint8_t* above, const uint8_t* centre, const uint8_t* below, uint8_t* out) const;
+
+    JDLVState               _state;
+    size_t                  _stride;
+    RuleTable               _table;
+    uint32_t                _index[9][256];     // class(state) * weight, per neighbour position; raw state for the centre
+    std::vector<uint8_t>    _cells[2];
+    uint8_t                 _current;
+    uint64_t                _generation;
+    LifeKernel              _kernel;
+};
+
+#endif /* RMDLRULETABLEENGINE_HPP */
@@ -0,0 +1,60 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: RMDLTripleBuffer.hpp          +++     +++     **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 18/10/2026 14:05:51      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef RMDLTRIPLEBUFFER_HPP
+# define RMDLTRIPLEBUFFER_HPP
+
+# include <atomic>
+# include <cstdint>
+
+# include "NonCopyable.h"
+
+/// Lock-free single producer / single consumer handoff of the latest value.
+/// The producer fills back() and publishes it; the consumer calls update()
+/// and reads front(). Neither side ever waits: the middle slot is swapped
+/// with one atomic exchange, and a value the consumer never picked up is
+/// simply replaced by the next one.
+template <typename T>
+class TripleBuffer : public NonCopyable
+{
+public:
+    explicit TripleBuffer(const T& initial = T())
+        : _slots{ initial, initial, initial }
+        , _back(0)
+        , _front(1)
+        , _middle(2)
+    {
+    }
+
+    /// Producer side.
+    T&          back()      { return _slots[_back]; }
+    void        publish()   { _back = _middle.exchange(_back | kFresh, std::memory_order_acq_rel) & kIndexMask; }
+
+    /// Consumer side: true when front() changed.
+    bool        update()
+    {
+        if (!(_middle.load(std::memory_order_relaxed) & kFresh))
+            return (false);
+        _front = _middle.exchange(_front, std::memory_order_acq_rel) & kIndexMask;
+        return (true);
+    }
+    const T&    front() const { return _slots[_front]; }
+
+private:
+    static constexpr uint8_t kIndexMask = 0x3;
+    static constexpr uint8_t kFresh = 0x4;
+
+    T                       _slots[3];
+    uint8_t                 _back;      // producer-private
+    uint8_t                 _front;     // consumer-private
+    std::atomic<uint8_t>    _middle;    // slot index | kFresh when not yet consumed
+};
+
+#endif /* RMDLTRIPLEBUFFER_HPP */
@@ -0,0 +1,376 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: RMDLVoxelLife.cpp               +++     +++   **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 19/10/2026 09:14:13      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+
+#include "RMDLVoxelLife.hpp"
+
+static constexpr int32_t kKeyBits = 21;
+static constexpr int64_t kKeyBias = int64_t(1) << (kKeyBits - 1);
+static constexpr uint64_t kKeyMask = (uint64_t(1) << kKeyBits) - 1;
+
+namespace
+{
+    /// Byte lane i of lanes[b] is bit i of b: eight cells of a row, one count per byte.
+    struct SpreadTable
+    {
+        uint64_t lanes[256];
+
+        SpreadTable()
+        {
+            for (uint32_t b = 0; b < 256; ++b)
+            {
+                lanes[b] = 0;
+                for (uint32_t i = 0; i < 8; ++i)
+                    lanes[b] |= (uint64_t)((b >> i) & 1) << (8 * i);
+            }
+        }
+    };
+}
+
+static const SpreadTable kSpread;
+
+static bool parseBound(const std::string& field, uint8_t& bound)
+{
+    if (field.empty() || field.size() > 2)
+        return (false);
+    uint32_t value = 0;
+    for (char c : field)
+    {
+        if (!isdigit((unsigned char)c))
+            return (false);
+        value = value * 10 + (uint32_t)(c - '0');
+    }
+    bound = (uint8_t)value;
+    return (value <= 26);
+}
+
+bool VoxelRule::parse(const std::string& text, VoxelRule& rule)
+{
+    std::vector<std::string> fields(1);
+    for (char c : text)
+    {
+        if (c == '/' || c == ',')
+            fields.emplace_back();
+        else if (!isspace((unsigned char)c))
+            fields.back() += c;
+    }
+    // "4555": one digit per bound.
+    if (fields.size() == 1 && fields[0].size() == 4)
+        fields = { fields[0].substr(0, 1), fields[0].substr(1, 1), fields[0].substr(2, 1), fields[0].substr(3, 1) };
+    if (fields.size() != 4)
+        return (false);
+
+    VoxelRule out;
+    if (!parseBound(fields[0], out.surviveMin) || !parseBound(fields[1], out.surviveMax)
+        || !parseBound(fields[2], out.birthMin) || !parseBound(fields[3], out.birthMax))
+        return (false);
+    if (out.surviveMin > out.surviveMax || out.birthMin > out.birthMax || out.birthMin == 0)
+        return (false);
+    rule = out;
+    return (true);
+}
+
+std::string VoxelRule::toString() const
+{
+    const uint8_t bounds[4] = { surviveMin, surviveMax, birthMin, birthMax };
+    const bool digits = std::all_of(bounds, bounds + 4, [](uint8_t b) { return (b < 10); });
+    std::string text;
+    for (uint32_t i = 0; i < 4; ++i)
+    {
+        if (!digits && i)
+            text += '/';
+        text += std::to_string(bounds[i]);
+    }
+    return (text);
+}
+
+uint64_t VoxelRule::mask() const
+{
+    uint64_t mask = 0;
+    for (uint32_t n = birthMin; n <= birthMax && n <= 26; ++n)
+        mask |= uint64_t(1) << n;
+    for (uint32_t n = surviveMin; n <= surviveMax && n <= 26; ++n)
+        mask |= uint64_t(1) << (32 + n);
+    return (mask);
+}
+
+VoxelLife::BrickKey VoxelLife::key(int32_t bx, int32_t by, int32_t bz)
+{
+    return (((uint64_t)(bx + kKeyBias) & kKeyMask)
+          | (((uint64_t)(by + kKeyBias) & kKeyMask) << kKeyBits)
+          | (((uint64_t)(bz + kKeyBias) & kKeyMask) << (2 * kKeyBits)));
+}
+
+void VoxelLife::coordinates(BrickKey key, int32_t& bx, int32_t& by, int32_t& bz)
+{
+    bx = (int32_t)((int64_t)(key & kKeyMask) - kKeyBias);
+    by = (int32_t)((int64_t)((key >> kKeyBits) & kKeyMask) - kKeyBias);
+    bz = (int32_t)((int64_t)((key >> (2 * kKeyBits)) & kKeyMask) - kKeyBias);
+}
+
+VoxelLife::BrickKey VoxelLife::neighbour(BrickKey key, int32_t dx, int32_t dy, int32_t dz)
+{
+    int32_t bx, by, bz;
+    coordinates(key, bx, by, bz);
+    return (VoxelLife::key(bx + dx, by + dy, bz + dz));
+}
+
+VoxelLife::VoxelLife(const VoxelRule& rule)
+    : _rule(rule)
+    , _mask(rule.mask())
+    , _generation(0)
+    , _population(0)
+{
+}
+
+VoxelLife::~VoxelLife()
+{
+}
+
+void VoxelLife::setRule(const VoxelRule& rule)
+{
+    _rule = rule;
+    _mask = rule.mask();
+    // Every brick may move under the new rule.
+    _active.clear();
+    for (const std::pair<const BrickKey, uint32_t>& entry : _index)
+        _active.push_back(entry.first);
+}
+
+void VoxelLife::clear()
+{
+    for (const std::pair<const BrickKey, uint32_t>& entry : _index)
+        _dirty.push_back(entry.first);
+    _bricks.clear();
+    _free.clear();
+    _index.clear();
+    _active.clear();
+    _generation = 0;
+    _population = 0;
+}
+
+VoxelLife::Brick* VoxelLife::find(BrickKey key)
+{
+    const std::unordered_map<BrickKey, uint32_t>::const_iterator found = _index.find(key);
+    return (found == _index.end() ? nullptr : &_bricks[found->second]);
+}
+
+const VoxelLife::Brick* VoxelLife::brick(BrickKey key) const
+{
+    const std::unordered_map<BrickKey, uint32_t>::const_iterator found = _index.find(key);
+    return (found == _index.end() ? nullptr : &_bricks[found->second]);
+}
+
+VoxelLife::Brick& VoxelLife::obtain(BrickKey key)
+{
+    const std::unordered_map<BrickKey, uint32_t>::const_iterator found = _index.find(key);
+    if (found != _index.end())
+        return (_bricks[found->second]);
+
+    uint32_t slot;
+    if (_free.empty())
+    {
+        slot = (uint32_t)_bricks.size();
+        _bricks.emplace_back();
+    }
+    else
+    {
+        slot = _free.back();
+        _free.pop_back();
+    }
+    Brick& brick = _bricks[slot];
+    brick.key = key;
+    memset(brick.bits, 0, sizeof(brick.bits));
+    brick.population = 0;
+    brick.dirty = false;
+    _index[key] = slot;
+    return (brick);
+}
+
+void VoxelLife::release(BrickKey key)
+{
+    const std::unordered_map<BrickKey, uint32_t>::iterator found = _index.find(key);
+    if (found == _index.end())
+        return;
+    _free.push_back(found->second);
+    _index.erase(found);
+}
+
+void VoxelLife::markDirty(Brick& brick)
+{
+    if (brick.dirty)
+        return;
+    brick.dirty = true;
+    _dirty.push_back(brick.key);
+}
+
+bool VoxelLife::cell(int32_t x, int32_t y, int32_t z) const
+{
+    const Brick* b = brick(key(x >> 3, y >> 3, z >> 3));
+    return (b && ((b->bits[z & 7] >> ((y & 7) * 8 + (x & 7))) & 1));
+}
+
+void VoxelLife::setCell(int32_t x, int32_t y, int32_t z, bool alive)
+{
+    const BrickKey k = key(x >> 3, y >> 3, z >> 3);
+    Brick* b = alive ? &obtain(k) : find(k);
+    if (!b)
+        return;
+    const uint64_t bit = uint64_t(1) << ((y & 7) * 8 + (x & 7));
+    if (((b->bits[z & 7] & bit) != 0) == alive)
+        return;
+
+    b->bits[z & 7] ^= bit;
+    b->population += alive ? 1 : -1;
+    _population += alive ? 1 : -1;
+    markDirty(*b);
+    _active.push_back(k);
+    if (b->population == 0)
+        release(k);
+}
+
+// Counts the 26 neighbours of the brick's 512 cells eight at a time, one
+// count per byte: each 10-cell row (with the x halo) is summed along x
+// through three spread lookups, then rows are summed along y and z.
+void VoxelLife::nextBrick(BrickKey key, uint64_t next[kBrickSize]) const
+{
+    const Brick* around[27];
+    bool any = false;
+    for (int32_t dz = -1; dz <= 1; ++dz)
+        for (int32_t dy = -1; dy <= 1; ++dy)
+            for (int32_t dx = -1; dx <= 1; ++dx)
+            {
+                const Brick* b = brick(neighbour(key, dx, dy, dz));
+                around[(dz + 1) * 9 + (dy + 1) * 3 + dx + 1] = b;
+                any |= b != nullptr;
+            }
+    memset(next, 0, sizeof(uint64_t) * kBrickSize);
+    if (!any)
+        return;
+
+    uint64_t rowSum[kBrickSize + 2][kBrickSize + 2];    // [z + 1][y + 1], summed along x
+    for (int32_t lz = -1; lz <= kBrickSize; ++lz)
+    {
+        const int32_t bz = lz < 0 ? 0 : lz >= kBrickSize ? 2 : 1;
+        for (int32_t ly = -1; ly <= kBrickSize; ++ly)
+        {
+            const int32_t by = ly < 0 ? 0 : ly >= kBrickSize ? 2 : 1;
+            const Brick* const* line = &around[bz * 9 + by * 3];
+            const uint32_t shift = (uint32_t)(ly & 7) * 8;
+            uint32_t row = 0;
+            if (line[0])
+                row |= (uint32_t)(line[0]->bits[lz & 7] >> (shift + 7)) & 1;
+            if (line[1])
+                row |= (uint32_t)((line[1]->bits[lz & 7] >> shift) & 0xFF) << 1;
+            if (line[2])
+                row |= (uint32_t)((line[2]->bits[lz & 7] >> shift) & 1) << 9;
+            rowSum[lz + 1][ly + 1] = kSpread.lanes[row & 0xFF] + kSpread.lanes[(row >> 1) & 0xFF] + kSpread.lanes[(row >> 2) & 0xFF];
+        }
+    }
+
+    uint64_t planeSum[kBrickSize + 2][kBrickSize];      // [z + 1][y], summed along x and y
+    for (int32_t lz = 0; lz < kBrickSize + 2; ++lz)
+        for (int32_t y = 0; y < kBrickSize; ++y)
+            planeSum[lz][y] = rowSum[lz][y] + rowSum[lz][y + 1] + rowSum[lz][y + 2];
+
+    const Brick* centre = around[13];
+    for (int32_t z = 0; z < kBrickSize; ++z)
+    {
+        const uint64_t slab = centre ? centre->bits[z] : 0;
+        uint64_t out = 0;
+        for (int32_t y = 0; y < kBrickSize; ++y)
+        {
+            const uint32_t alive = (uint32_t)(slab >> (y * 8)) & 0xFF;
+            const uint64_t counts = planeSum[z][y] + planeSum[z + 1][y] + planeSum[z + 2][y] - kSpread.lanes[alive];
+            if (counts == 0 && alive == 0)
+                continue;
+            uint32_t bits = 0;
+            for (uint32_t x = 0; x < 8; ++x)
+            {
+                const uint32_t n = (uint32_t)(counts >> (8 * x)) & 0xFF;
+                bits |= (uint32_t)((_mask >> (n + 32 * ((alive >> x) & 1))) & 1) << x;
+            }
+            out |= (uint64_t)bits << (y * 8);
+        }
+        next[z] = out;
+    }
+}
+
+void VoxelLife::step()
+{
+    // Only bricks next to a change can change. Edits may list a brick many times.
+    std::sort(_active.begin(), _active.end());
+    _active.erase(std::unique(_active.begin(), _active.end()), _active.end());
+    std::vector<BrickKey> candidates;
+    candidates.reserve(_active.size() * 27);
+    for (BrickKey k : _active)
+        for (int32_t dz = -1; dz <= 1; ++dz)
+            for (int32_t dy = -1; dy <= 1; ++dy)
+                for (int32_t dx = -1; dx <= 1; ++dx)
+                    candidates.push_back(neighbour(k, dx, dy, dz));
+    std::sort(candidates.begin(), candidates.end());
+    candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+
+    struct Change
+    {
+        BrickKey    key;
+        uint64_t    bits[kBrickSize];
+    };
+    std::vector<Change> changes;
+    for (BrickKey k : candidates)
+    {
+        Change change;
+        change.key = k;
+        nextBrick(k, change.bits);
+        const Brick* b = brick(k);
+        static const uint64_t empty[kBrickSize] = {};
+        if (memcmp(change.bits, b ? b->bits : empty, sizeof(change.bits)) != 0)
+            changes.push_back(change);
+    }
+
+    // Every brick is computed from the old generation before any is written.
+    _active.clear();
+    for (const Change& change : changes)
+    {
+        Brick& b = obtain(change.key);
+        memcpy(b.bits, change.bits, sizeof(b.bits));
+        uint32_t population = 0;
+        for (uint64_t slab : b.bits)
+            population += (uint32_t)__builtin_popcountll(slab);
+        _population += population;
+        _population -= b.population;
+        b.population = population;
+        markDirty(b);
+        _active.push_back(change.key);
+        if (population == 0)
+            release(change.key);
+    }
+    ++_generation;
+}
+
+void VoxelLife::step(uint64_t generations)
+{
+    while (generations--)
+        step();
+}
+
+void VoxelLife::takeDirtyBricks(std::vector<BrickKey>& keys)
+{
+    for (BrickKey k : _dirty)
+    {
+        if (Brick* b = find(k))
+            b->dirty = false;
+        keys.push_back(k);
+    }
+    _dirty.clear();
+}
@@ -0,0 +1,116 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: RMDLVoxelLife.hpp               +++     +++   **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 19/10/2026 09:14:08      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef RMDLVOXELLIFE_HPP
+# define RMDLVOXELLIFE_HPP
+
+# include <cstddef>
+# include <cstdint>
+# include <string>
+# include <unordered_map>
+# include <vector>
+
+# include "NonCopyable.h"
+
+/// Outer-totalistic rule on the 26-cell Moore neighbourhood, in Bays'
+/// notation E_l E_u F_l F_u: a live cell survives with E_l..E_u live
+/// neighbours, a dead cell is born with F_l..F_u.
+struct VoxelRule
+{
+    uint8_t     surviveMin;
+    uint8_t     surviveMax;
+    uint8_t     birthMin;
+    uint8_t     birthMax;
+
+    static VoxelRule bays4555() { return { 4, 5, 5, 5 }; }
+
+    /// Accepts "4555" and "4/5/5/5" (needed once a bound passes 9). Births from 0 neighbours are refused.
+    static bool parse(const std::string& text, VoxelRule& rule);
+    std::string toString() const;
+
+    /// Bit n is set when a dead cell with n neighbours is born; bit 32 + n when a live one survives.
+    uint64_t    mask() const;
+};
+
+/// Unbounded 3D Life on a sparse map of 8x8x8 bricks, one uint64_t per
+/// z slab (bit y * 8 + x). Only bricks that changed last generation, and
+/// their 26 neighbours, are evaluated, so a step costs in proportion to the
+/// active bricks and not to the volume. Bricks that empty out are freed.
+/// Every brick a step or an edit touches is queued once for the mesher
+/// (see takeDirtyBricks).
+class VoxelLife : public NonCopyable
+{
+public:
+    static constexpr int32_t kBrickSize = 8;
+
+    /// Brick coordinates packed 21 bits each (a cell is at brick * 8 + 0..7).
+    typedef uint64_t BrickKey;
+
+    struct Brick
+    {
+        BrickKey    key;
+        uint64_t    bits[kBrickSize];
+        uint32_t    population;
+        bool        dirty;          // queued for the mesher
+    };
+
+    explicit VoxelLife(const VoxelRule& rule = VoxelRule::bays4555());
+    ~VoxelLife();
+
+    const VoxelRule&    rule() const            { return _rule; }
+    void                setRule(const VoxelRule& rule);
+    uint64_t            generation() const      { return _generation; }
+    uint64_t            population() const      { return _population; }
+    size_t              bricks() const          { return _index.size(); }
+    /// Bricks the next step() will look at (before adding their neighbours).
+    size_t              activeBricks() const    { return _active.size(); }
+
+    void                clear();
+    bool                cell(int32_t x, int32_t y, int32_t z) const;
+    void                setCell(int32_t x, int32_t y, int32_t z, bool alive);
+
+    void                step();
+    void                step(uint64_t generations);
+
+    /// nullptr for an empty brick.
+    const Brick*        brick(BrickKey key) const;
+    template <typename Fn>
+    void                forEachBrick(Fn&& fn) const
+    {
+        for (const std::pair<const BrickKey, uint32_t>& entry : _index)
+            fn(_bricks[entry.second]);
+    }
+
+    /// Appends every brick changed, created or freed since the last call.
+    void                takeDirtyBricks(std::vector<BrickKey>& keys);
+
+    static BrickKey     key(int32_t bx, int32_t by, int32_t bz);
+    static void         coordinates(BrickKey key, int32_t& bx, int32_t& by, int32_t& bz);
+    static BrickKey     neighbour(BrickKey key, int32_t dx, int32_t dy, int32_t dz);
+
+private:
+    Brick*              find(BrickKey key);
+    Brick&              obtain(BrickKey key);
+    void                release(BrickKey key);
+    void                markDirty(Brick& brick);
+    void                nextBrick(BrickKey key, uint64_t next[kBrickSize]) const;
+
+    VoxelRule                               _rule;
+    uint64_t                                _mask;
+    std::vector<Brick>                      _bricks;        // slots, some free
+    std::vector<uint32_t>                   _free;
+    std::unordered_map<BrickKey, uint32_t>  _index;
+    std::vector<BrickKey>                   _active;
+    std::vector<BrickKey>                   _dirty;
+    uint64_t                                _generation;
+    uint64_t                                _population;
+};
+
+#endif /* RMDLVOXELLIFE_HPP */
@@ -0,0 +1,164 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: RMDLVoxelMesher.cpp             +++     +++   **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 19/10/2026 10:02:58      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include <algorithm>
+
+#include "RMDLVoxelMesher.hpp"
+
+// Byte masks of the x = 0 and x = 7 columns of a slab.
+static constexpr uint64_t kColumn0 = 0x0101010101010101ull;
+static constexpr uint64_t kColumn7 = 0x8080808080808080ull;
+
+// Face f looks along +axis for even f, -axis for odd f: +x, -x, +y, -y, +z, -z.
+static void emitFace(VoxelMesher::BrickMesh& mesh, uint32_t face, int32_t x, int32_t y, int32_t z)
+{
+    const uint32_t axis = face / 2;
+    const bool positive = (face & 1) == 0;
+    const uint32_t u = (axis + 1) % 3, v = (axis + 2) % 3;
+
+    float base[3] = { (float)x, (float)y, (float)z };
+    if (positive)
+        base[axis] += 1;
+    float normal[3] = { 0, 0, 0 };
+    normal[axis] = positive ? 1.f : -1.f;
+
+    // u x v is +axis, so (0, u, u + v, v) winds counter-clockwise seen from +axis.
+    static const uint32_t kCorners[2][4][2] = { { { 0, 0 }, { 1, 0 }, { 1, 1 }, { 0, 1 } },
+                                                { { 0, 0 }, { 0, 1 }, { 1, 1 }, { 1, 0 } } };
+    const uint32_t first = (uint32_t)mesh.vertices.size();
+    for (uint32_t c = 0; c < 4; ++c)
+    {
+        VoxelVertex vertex;
+        for (uint32_t i = 0; i < 3; ++i)
+        {
+            vertex.position[i] = base[i];
+            vertex.normal[i] = normal[i];
+        }
+        vertex.position[u] += (float)kCorners[positive ? 0 : 1][c][0];
+        vertex.position[v] += (float)kCorners[positive ? 0 : 1][c][1];
+        mesh.vertices.push_back(vertex);
+    }
+    const uint32_t quad[6] = { 0, 1, 2, 0, 2, 3 };
+    for (uint32_t i : quad)
+        mesh.indices.push_back(first + i);
+}
+
+VoxelMesher::VoxelMesher()
+    : _revision(0)
+    , _faces(0)
+{
+}
+
+// One slab at a time: a face shows wherever a live cell's neighbour in that
+// direction, shifted into place (from the next brick at the border), is dead.
+void VoxelMesher::meshBrick(const VoxelLife& life, VoxelLife::BrickKey key, BrickMesh& mesh)
+{
+    mesh.vertices.clear();
+    mesh.indices.clear();
+    const VoxelLife::Brick* brick = life.brick(key);
+    if (!brick)
+        return;
+
+    const VoxelLife::Brick* side[6];
+    for (uint32_t face = 0; face < 6; ++face)
+    {
+        int32_t offset[3] = { 0, 0, 0 };
+        offset[face / 2] = (face & 1) ? -1 : 1;
+        side[face] = life.brick(VoxelLife::neighbour(key, offset[0], offset[1], offset[2]));
+    }
+    int32_t bx, by, bz;
+    VoxelLife::coordinates(key, bx, by, bz);
+    const int32_t size = VoxelLife::kBrickSize;
+    const uint64_t* bits = brick->bits;
+
+    uint64_t shown[VoxelLife::kBrickSize][6];
+    size_t faces = 0;
+    for (int32_t z = 0; z < size; ++z)
+    {
+        const uint64_t a = bits[z];
+        uint64_t beside[6];
+        beside[0] = ((a >> 1) & ~kColumn7) | (side[0] ? (side[0]->bits[z] & kColumn0) << 7 : 0);
+        beside[1] = ((a << 1) & ~kColumn0) | (side[1] ? (side[1]->bits[z] & kColumn7) >> 7 : 0);
+        beside[2] = (a >> 8) | (side[2] ? side[2]->bits[z] << 56 : 0);
+        beside[3] = (a << 8) | (side[3] ? side[3]->bits[z] >> 56 : 0);
+        beside[4] = z + 1 < size ? bits[z + 1] : side[4] ? side[4]->bits[0] : 0;
+        beside[5] = z > 0 ? bits[z - 1] : side[5] ? side[5]->bits[size - 1] : 0;
+        for (uint32_t face = 0; face < 6; ++face)
+        {
+            shown[z][face] = a & ~beside[face];
+            faces += (size_t)__builtin_popcountll(shown[z][face]);
+        }
+    }
+
+    mesh.vertices.reserve(faces * 4);
+    mesh.indices.reserve(faces * 6);
+    for (int32_t z = 0; z < size; ++z)
+        for (uint32_t face = 0; face < 6; ++face)
+            for (uint64_t left = shown[z][face]; left; left &= left - 1)
+            {
+                const int32_t bit = __builtin_ctzll(left);
+                emitFace(mesh, face, bx * size + (bit & 7), by * size + (bit >> 3), bz * size + z);
+            }
+}
+
+uint32_t VoxelMesher::update(VoxelLife& life)
+{
+    _dirty.clear();
+    life.takeDirtyBricks(_dirty);
+    if (_dirty.empty())
+        return (0);
+
+    // A brick's border faces depend on its six face neighbours.
+    const size_t changed = _dirty.size();
+    for (size_t i = 0; i < changed; ++i)
+    {
+        const VoxelLife::BrickKey key = _dirty[i];
+        _dirty.push_back(VoxelLife::neighbour(key, 1, 0, 0));
+        _dirty.push_back(VoxelLife::neighbour(key, -1, 0, 0));
+        _dirty.push_back(VoxelLife::neighbour(key, 0, 1, 0));
+        _dirty.push_back(VoxelLife::neighbour(key, 0, -1, 0));
+        _dirty.push_back(VoxelLife::neighbour(key, 0, 0, 1));
+        _dirty.push_back(VoxelLife::neighbour(key, 0, 0, -1));
+    }
+    std::sort(_dirty.begin(), _dirty.end());
+    _dirty.erase(std::unique(_dirty.begin(), _dirty.end()), _dirty.end());
+
+    ++_revision;
+    uint32_t rebuilt = 0;
+    BrickMesh mesh;
+    for (VoxelLife::BrickKey key : _dirty)
+    {
+        const std::unordered_map<VoxelLife::BrickKey, BrickMesh>::iterator found = _meshes.find(key);
+        if (found != _meshes.end())
+            _faces -= found->second.indices.size() / 6;
+        if (!life.brick(key))
+        {
+            if (found != _meshes.end())
+                _meshes.erase(found);
+            continue;
+        }
+
+        meshBrick(life, key, mesh);
+        ++rebuilt;
+        _faces += mesh.indices.size() / 6;
+        if (mesh.indices.empty())
+        {
+            if (found != _meshes.end())
+                _meshes.erase(found);
+            continue;
+        }
+        mesh.revision = _revision;
+        if (found != _meshes.end())
+            std::swap(found->second, mesh);
+        else
+            _meshes.emplace(key, std::move(mesh));
+    }
+    return (rebuilt);
+}
@@ -0,0 +1,95 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: RMDLVoxelMesher.hpp             +++     +++   **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 19/10/2026 10:02:51      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef RMDLVOXELMESHER_HPP
+# define RMDLVOXELMESHER_HPP
+
+# include <cstddef>
+# include <cstdint>
+# include <unordered_map>
+# include <vector>
+
+# include "NonCopyable.h"
+# include "RMDLVoxelLife.hpp"
+
+/// One corner of a cell face, in cell units (world space is cells).
+struct VoxelVertex
+{
+    float   position[3];
+    float   normal[3];
+};
+
+/// Keeps a mesh per brick holding only the faces between a live cell and
+/// a dead one (4 vertices, 6 indices each, counter-clockwise seen from
+/// outside). update() only remeshes the bricks VoxelLife reports dirty and
+/// their six face neighbours, whose boundary faces may have appeared or
+/// gone, so meshing follows the edits and not the volume.
+/// Meshes carry the mesher revision they were built at, so the renderer
+/// only re-uploads what moved, and bricks can be culled against
+/// RMDLCameraUniforms::frustumPlanes before drawing.
+class VoxelMesher : public NonCopyable
+{
+public:
+    struct BrickMesh
+    {
+        std::vector<VoxelVertex>    vertices;
+        std::vector<uint32_t>       indices;
+        uint64_t                    revision;
+    };
+
+    VoxelMesher();
+
+    /// Remeshes what changed since the last call; returns how many bricks were rebuilt.
+    uint32_t            update(VoxelLife& life);
+    /// Bumped by every update() that rebuilt something.
+    uint64_t            revision() const    { return _revision; }
+    size_t              faces() const       { return _faces; }
+    const std::unordered_map<VoxelLife::BrickKey, BrickMesh>& meshes() const { return _meshes; }
+
+    /// Faces of one brick, as update() would build them.
+    static void         meshBrick(const VoxelLife& life, VoxelLife::BrickKey key, BrickMesh& mesh);
+
+    /// False when the brick lies wholly outside one of the six planes (a, b, c, d),
+    /// inside where a * x + b * y + c * z + d >= 0: simd::float4 or float[4].
+    template <typename Plane4>
+    static bool         brickVisible(VoxelLife::BrickKey key, const Plane4* planes)
+    {
+        int32_t bx, by, bz;
+        VoxelLife::coordinates(key, bx, by, bz);
+        const float lo[3] = { (float)bx * VoxelLife::kBrickSize, (float)by * VoxelLife::kBrickSize, (float)bz * VoxelLife::kBrickSize };
+        for (uint32_t p = 0; p < 6; ++p)
+        {
+            // The box corner furthest along the plane normal.
+            float distance = planes[p][3];
+            for (uint32_t axis = 0; axis < 3; ++axis)
+                distance += planes[p][axis] * (lo[axis] + (planes[p][axis] > 0 ? VoxelLife::kBrickSize : 0));
+            if (distance < 0)
+                return (false);
+        }
+        return (true);
+    }
+
+    /// Keys of the non-empty meshes that pass brickVisible.
+    template <typename Plane4>
+    void                visibleMeshes(const Plane4* planes, std::vector<VoxelLife::BrickKey>& keys) const
+    {
+        for (const std::pair<const VoxelLife::BrickKey, BrickMesh>& entry : _meshes)
+            if (brickVisible(entry.first, planes))
+                keys.push_back(entry.first);
+    }
+
+private:
+    std::unordered_map<VoxelLife::BrickKey, BrickMesh>  _meshes;
+    std::vector<VoxelLife::BrickKey>                    _dirty;
+    uint64_t                                            _revision;
+    size_t                                              _faces;
+};
+
+#endif /* RMDLVOXELMESHER_HPP */
@@ -0,0 +1,146 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: RMDLWorkStealingPool.cpp        +++     +++   **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 17/10/2026 17:02:44      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#include <algorithm>
+#include <cassert>
+
+#include "RMDLWorkStealingPool.hpp"
+
+// The pool a worker belongs to travels with its index: pools may nest.
+static thread_local const WorkStealingPool* tWorkerPool = nullptr;
+static thread_local int tWorkerIndex = -1;
+
+WorkStealingPool::WorkStealingPool(unsigned threadCount)
+    : _pending(0)
+    , _nextQueue(0)
+    , _stop(false)
+{
+    if (threadCount == 0)
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+    for (unsigned i = 0; i < threadCount; ++i)
+        _queues.emplace_back(new Queue());
+    _workers.reserve(threadCount);
+    for (unsigned i = 0; i < threadCount; ++i)
+        _workers.emplace_back(&WorkStealingPool::workerLoop, this, i);
+}
+
+WorkStealingPool::~WorkStealingPool()
+{
+    {
+        std::lock_guard<std::mutex> guard(_sleepLock);
+        _stop = true;
+    }
+    _wake.notify_all();
+    for (std::thread& worker : _workers)
+        worker.join();
+}
+
+int WorkStealingPool::currentWorker() const
+{
+    return (tWorkerPool == this ? tWorkerIndex : -1);
+}
+
+void WorkStealingPool::submit(std::function<void()> task)
+{
+    const int self = currentWorker();
+    const unsigned target = self >= 0 ? (unsigned)self
+                                      : _nextQueue.fetch_add(1, std::memory_order_relaxed) % threadCount();
+    _pending.fetch_add(1, std::memory_order_seq_cst);
+    {
+        std::lock_guard<std::mutex> guard(_queues[target]->lock);
+        _queues[target]->tasks.push_back(std::move(task));
+    }
+    {
+        // Taking the sleep lock closes the window between a worker's last
+        // empty check and its wait.
+        std::lock_guard<std::mutex> guard(_sleepLock);
+    }
+    _wake.notify_one();
+}
+
+void WorkStealingPool::parallelFor(uint32_t count, const std::function<void(uint32_t, uint32_t)>& fn)
+{
+    assert(currentWorker() < 0);
+    if (count == 0)
+        return;
+    const uint32_t chunks = std::min<uint32_t>(count, threadCount() * 4);
+    const uint32_t chunk = (count + chunks - 1) / chunks;
+
+    // Shared with the tasks, so the last one can signal after the caller has returned.
+    struct Join
+    {
+        std::mutex              lock;
+        std::condition_variable done;
+        uint32_t                remaining;
+    };
+    std::shared_ptr<Join> join = std::make_shared<Join>();
+    join->remaining = (count + chunk - 1) / chunk;
+    for (uint32_t begin = 0; begin < count; begin += chunk)
+    {
+        const uint32_t end = std::min(count, begin + chunk);
+        submit([join, &fn, begin, end]
+        {
+            fn(begin, end);
+            std::lock_guard<std::mutex> guard(join->lock);
+            if (--join->remaining == 0)
+                join->done.notify_all();
+        });
+    }
+    std::unique_lock<std::mutex> guard(join->lock);
+    join->done.wait(guard, [&join] { return (join->remaining == 0); });
+}
+
+bool WorkStealingPool::pop(unsigned self, std::function<void()>& task)
+{
+    {
+        Queue& own = *_queues[self];
+        std::lock_guard<std::mutex> guard(own.lock);
+        if (!own.tasks.empty())
+        {
+            task = std::move(own.tasks.back());
+            own.tasks.pop_back();
+            return (true);
+        }
+    }
+    const unsigned n = threadCount();
+    for (unsigned i = 1; i < n; ++i)
+    {
+        Queue& victim = *_queues[(self + i) % n];
+        std::lock_guard<std::mutex> guard(victim.lock);
+        if (!victim.tasks.empty())
+        {
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+            return (true);
+        }
+    }
+    return (false);
+}
+
+void WorkStealingPool::workerLoop(unsigned self)
+{
+    tWorkerPool = this;
+    tWorkerIndex = (int)self;
+    std::function<void()> task;
+    for (;;)
+    {
+        if (pop(self, task))
+        {
+            _pending.fetch_sub(1, std::memory_order_seq_cst);
+            task();
+            task = nullptr;
+            continue;
+        }
+        std::unique_lock<std::mutex> guard(_sleepLock);
+        _wake.wait(guard, [this] { return (_stop || _pending.load(std::memory_order_seq_cst) > 0); });
+        if (_stop && _pending.load(std::memory_order_seq_cst) == 0)
+            return;
+    }
+}
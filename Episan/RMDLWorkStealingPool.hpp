@@ -0,0 +1,66 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: RMDLWorkStealingPool.hpp        +++     +++   **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 17/10/2026 17:02:40      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef RMDLWORKSTEALINGPOOL_HPP
+# define RMDLWORKSTEALINGPOOL_HPP
+
+# include <atomic>
+# include <condition_variable>
+# include <deque>
+# include <functional>
+# include <memory>
+# include <mutex>
+# include <thread>
+# include <vector>
+
+# include "NonCopyable.h"
+
+/// One deque per worker: owners push/pop at the back (LIFO, cache-warm),
+/// idle workers steal from the front of someone else's deque.
+class WorkStealingPool : public NonCopyable
+{
+public:
+    /// 0 threads means std::thread::hardware_concurrency().
+    explicit WorkStealingPool(unsigned threadCount = 0);
+    ~WorkStealingPool();
+
+    unsigned    threadCount() const { return (unsigned)_queues.size(); }
+
+    /// From one of this pool's workers the task lands on its own deque, otherwise round-robin.
+    void        submit(std::function<void()> task);
+
+    /// Runs fn(begin, end) over [0, count) cut into about four chunks per worker
+    /// and blocks until all are done. Not callable from a pool worker.
+    void        parallelFor(uint32_t count, const std::function<void(uint32_t, uint32_t)>& fn);
+
+    /// Index of the calling thread among this pool's workers, -1 for any other
+    /// thread, workers of other pools included.
+    int         currentWorker() const;
+
+private:
+    struct alignas(64) Queue
+    {
+        std::mutex                          lock;
+        std::deque<std::function<void()>>   tasks;
+    };
+
+    bool        pop(unsigned self, std::function<void()>& task);
+    void        workerLoop(unsigned self);
+
+    std::vector<std::unique_ptr<Queue>> _queues;
+    std::vector<std::thread>            _workers;
+    std::atomic<uint64_t>               _pending;
+    std::atomic<unsigned>               _nextQueue;
+    std::mutex                          _sleepLock;
+    std::condition_variable             _wake;
+    bool                                _stop;
+};
+
+#endif /* RMDLWORKSTEALINGPOOL_HPP */
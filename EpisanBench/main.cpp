@@ -0,0 +1,687 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: main.cpp                      +++     +++     **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 18/10/2026 10:48:37      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+// Headless benchmark of every CPU stepping path. Deterministic: fixed seeds,
+// fixed generation counts, and every final board is hashed and compared with
+// the scalar JDLVReference (or, for the unbounded engines, with each other).
+//
+//   EpisanBench [--sizes=256,1024,4096] [--patterns=gun,soup,gliders]
+//               [--threads=1,2,4] [--generations=N] [--repeat=N]
+//               [--topology=torus|plane|klein|padded] [--seed=N]
+//               [--reference-limit=CELLS] [--out=report.json] [--quick]
+//               [--census=SOUPS] [--batch=BOARDS] [--cluster=WORKERS]
+//
+// --census also runs an apgsearch-style soup census once per thread count;
+// every thread count must produce the same tally.
+// --batch steps that many 64x64 soups through LifeBatch, all on B3/S23 and
+// then on random rules, per kernel and thread count; every board is checked
+// against its own LifeEngine.
+// --cluster runs soups of every size through a LifeCluster of that many
+// worker processes on loopback (this binary again, with --cluster-worker),
+// at halo depths 1 and 8, checked against a LifeEngine. One timed run each:
+// the workers start from the board once.
+// The report is JSON on stdout (or --out). Exit status 1 on any hash mismatch.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "RMDLHashLife.hpp"
+#include "RMDLJDLVReference.hpp"
+#include "RMDLLifeBatch.hpp"
+#include "RMDLLifeCensus.hpp"
+#include "RMDLLifeCluster.hpp"
+#include "RMDLLifeEngine.hpp"
+#include "RMDLLifePatterns.hpp"
+#include "RMDLLifeTemporalStepper.hpp"
+#include "RMDLLifeThreadedStepper.hpp"
+#include "RMDLLifeUniverse.hpp"
+#include "RMDLWorkStealingPool.hpp"
+
+namespace
+{
+
+struct Config
+{
+    std::vector<uint32_t>       sizes = { 256, 1024, 4096 };
+    std::vector<std::string>    patterns = { "gun", "soup", "gliders" };
+    std::vector<uint32_t>       threads;
+    uint64_t                    generations = 0;        // 0: sized per board
+    uint64_t                    cellBudget = 1ull << 28; // cell updates per run when generations == 0
+    uint32_t                    repeat = 3;
+    JDLVTopology                topology = JDLVTopologyTorus;
+    uint64_t                    seed = 0x45504953414Eull;
+    uint64_t                    referenceLimit = 1ull << 30; // scalar reference skipped above this many cell updates
+    uint64_t                    census = 0;             // soups per census run, 0: no census
+    uint32_t                    batch = 0;              // boards per batch run, 0: no batch runs
+    uint32_t                    cluster = 0;            // worker processes per cluster run, 0: no cluster runs
+    std::string                 out;
+};
+
+struct Run
+{
+    std::string path;
+    std::string pattern;
+    uint32_t    size;
+    uint32_t    threads;
+    uint64_t    generations;
+    double      seconds;
+    double      bytesPerGeneration;
+    uint64_t    hash;
+    std::string check;          // what the hash was compared with
+    bool        match;
+    double      speedup;        // threaded paths, against the same path on one thread
+};
+
+struct CensusRun
+{
+    uint32_t                        threads;
+    uint64_t                        soups;
+    uint64_t                        unsettled;
+    double                          seconds;
+    uint64_t                        hash;       // over the whole tally
+    bool                            match;
+    std::vector<LifeCensus::Tally>  top;
+};
+
+struct BatchRun
+{
+    std::string path;
+    std::string rules;          // "conway" or "mixed"
+    uint32_t    boards;
+    uint32_t    threads;
+    uint64_t    generations;
+    double      seconds;
+    uint64_t    hash;           // over every board
+    bool        match;          // against one LifeEngine per board
+};
+
+struct ClusterRun
+{
+    uint32_t    size;
+    uint32_t    workers;
+    uint32_t    haloDepth;      // as the cluster capped it
+    uint64_t    generations;
+    double      seconds;
+    uint64_t    hash;
+    bool        match;          // against a LifeEngine
+};
+
+double now()
+{
+    return (std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+std::vector<uint32_t> parseList(const char* text)
+{
+    std::vector<uint32_t> values;
+    for (const char* p = text; *p; )
+    {
+        char* end = nullptr;
+        const unsigned long value = strtoul(p, &end, 10);
+        if (end == p)
+            break;
+        values.push_back((uint32_t)value);
+        p = *end == ',' ? end + 1 : end;
+    }
+    return (values);
+}
+
+std::vector<std::string> parseNames(const char* text)
+{
+    std::vector<std::string> names;
+    std::string current;
+    for (const char* p = text; ; ++p)
+    {
+        if (*p == ',' || *p == 0)
+        {
+            if (!current.empty())
+                names.push_back(current);
+            current.clear();
+            if (*p == 0)
+                break;
+        }
+        else
+            current += *p;
+    }
+    return (names);
+}
+
+bool parseArguments(int argc, const char* argv[], Config& config)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        const char* arg = argv[i];
+        const char* value = strchr(arg, '=');
+        value = value ? value + 1 : "";
+
+        if (!strncmp(arg, "--sizes=", 8))
+            config.sizes = parseList(value);
+        else if (!strncmp(arg, "--patterns=", 11))
+            config.patterns = parseNames(value);
+        else if (!strncmp(arg, "--threads=", 10))
+            config.threads = parseList(value);
+        else if (!strncmp(arg, "--generations=", 14))
+            config.generations = strtoull(value, nullptr, 10);
+        else if (!strncmp(arg, "--repeat=", 9))
+            config.repeat = std::max<uint32_t>(1, (uint32_t)strtoul(value, nullptr, 10));
+        else if (!strncmp(arg, "--seed=", 7))
+            config.seed = strtoull(value, nullptr, 0);
+        else if (!strncmp(arg, "--reference-limit=", 18))
+            config.referenceLimit = strtoull(value, nullptr, 10);
+        else if (!strncmp(arg, "--out=", 6))
+            config.out = value;
+        else if (!strncmp(arg, "--census=", 9))
+            config.census = strtoull(value, nullptr, 10);
+        else if (!strncmp(arg, "--batch=", 8))
+            config.batch = (uint32_t)strtoul(value, nullptr, 10);
+        else if (!strncmp(arg, "--cluster=", 10))
+            config.cluster = (uint32_t)strtoul(value, nullptr, 10);
+        else if (!strncmp(arg, "--topology=", 11))
+        {
+            if (!strcmp(value, "plane"))
+                config.topology = JDLVTopologyPlane;
+            else if (!strcmp(value, "torus"))
+                config.topology = JDLVTopologyTorus;
+            else if (!strcmp(value, "klein"))
+                config.topology = JDLVTopologyKleinBottle;
+            else if (!strcmp(value, "padded"))
+                config.topology = JDLVTopologyPadded;
+            else
+            {
+                printf("Unknown topology %s\n", value);
+                return (false);
+            }
+        }
+        else if (!strcmp(arg, "--quick"))
+        {
+            config.sizes = { 256, 1024 };
+            config.cellBudget = 1ull << 24;
+            config.repeat = 1;
+        }
+        else
+        {
+            printf("Unknown argument %s\n", arg);
+            return (false);
+        }
+    }
+
+    if (config.threads.empty())
+    {
+        const uint32_t hardware = std::max(1u, std::thread::hardware_concurrency());
+        for (uint32_t count = 1; count < hardware; count *= 2)
+            config.threads.push_back(count);
+        config.threads.push_back(hardware);
+    }
+    for (const std::string& pattern : config.patterns)
+    {
+        if (pattern != "gun" && pattern != "soup" && pattern != "gliders")
+        {
+            printf("Unknown pattern %s\n", pattern.c_str());
+            return (false);
+        }
+    }
+    return (!config.sizes.empty() && !config.patterns.empty());
+}
+
+void seed(const std::string& pattern, const JDLVState& state, uint64_t seed, std::vector<uint32_t>& grid)
+{
+    grid.assign((size_t)state.width * state.height, 0);
+    if (pattern == "gun")
+        life_patterns::seedGun(state, grid.data());
+    else if (pattern == "soup")
+        life_patterns::seedSoup(state, grid.data(), 0.30, seed);
+    else
+        life_patterns::seedGliders(state, grid.data(), 32, seed);
+}
+
+// FNV-1a over the board packed the LifeEngine way (64 cells per word, row by row),
+// so every path hashes the same bytes whatever its own layout.
+uint64_t hashGrid(const JDLVState& state, const uint32_t* grid)
+{
+    uint64_t hash = 0xCBF29CE484222325ull;
+    for (uint32_t y = 0; y < state.height; ++y)
+    {
+        const uint32_t* row = grid + (size_t)y * state.width;
+        for (uint32_t x0 = 0; x0 < state.width; x0 += 64)
+        {
+            uint64_t word = 0;
+            const uint32_t end = std::min(state.width, x0 + 64);
+            for (uint32_t x = x0; x < end; ++x)
+                word |= (uint64_t)(row[x] == 1) << (x - x0);
+            for (int b = 0; b < 8; ++b)
+            {
+                hash ^= (word >> (b * 8)) & 0xFF;
+                hash *= 0x100000001B3ull;
+            }
+        }
+    }
+    return (hash);
+}
+
+uint64_t hashEngine(const LifeEngine& engine)
+{
+    std::vector<uint32_t> grid((size_t)engine.width() * engine.height());
+    engine.exportGrid(grid.data());
+    return (hashGrid(engine.state(), grid.data()));
+}
+
+// Times `body` `repeat` times on a freshly seeded board and keeps the best run.
+template <typename Reset, typename Body>
+double bestOf(uint32_t repeat, Reset reset, Body body)
+{
+    double best = 1e300;
+    for (uint32_t i = 0; i < repeat; ++i)
+    {
+        reset();
+        const double start = now();
+        body();
+        best = std::min(best, now() - start);
+    }
+    return (best);
+}
+
+void writeReport(FILE* file, const Config& config, const std::vector<Run>& runs,
+                 const std::vector<CensusRun>& censuses, const std::vector<BatchRun>& batches,
+                 const std::vector<ClusterRun>& clusters, uint32_t mismatches)
+{
+    static const char* kTopologyNames[] = { "plane", "torus", "klein", "padded" };
+
+    fprintf(file, "{\n  \"machine\": { \"hardwareThreads\": %u, \"kernels\": [",
+            std::thread::hardware_concurrency());
+    bool first = true;
+    for (LifeKernel kernel : { LifeKernel::Scalar, LifeKernel::AVX2, LifeKernel::NEON })
+    {
+        if (!life_kernels::available(kernel))
+            continue;
+        fprintf(file, "%s\"%s\"", first ? "" : ", ", life_kernels::name(kernel));
+        first = false;
+    }
+    fprintf(file, "], \"bestKernel\": \"%s\" },\n", life_kernels::name(life_kernels::best()));
+    fprintf(file, "  \"config\": { \"topology\": \"%s\", \"seed\": %llu, \"repeat\": %u, \"cellBudget\": %llu },\n",
+            kTopologyNames[config.topology], (unsigned long long)config.seed, config.repeat,
+            (unsigned long long)config.cellBudget);
+    fprintf(file, "  \"runs\": [\n");
+    for (size_t i = 0; i < runs.size(); ++i)
+    {
+        const Run& run = runs[i];
+        const double cells = (double)run.size * run.size * run.generations;
+        fprintf(file, "    { \"path\": \"%s\", \"pattern\": \"%s\", \"size\": %u, \"threads\": %u, \"generations\": %llu, "
+                      "\"seconds\": %.6f, \"generationsPerSecond\": %.3f, \"cellsPerNanosecond\": %.4f, ",
+                run.path.c_str(), run.pattern.c_str(), run.size, run.threads, (unsigned long long)run.generations,
+                run.seconds, run.generations / run.seconds, cells / (run.seconds * 1e9));
+        // Modelled traffic: each generation reads and writes the whole buffer once. HashLife has no such model.
+        if (run.bytesPerGeneration > 0)
+            fprintf(file, "\"bandwidthGBs\": %.3f, ", run.bytesPerGeneration * run.generations / (run.seconds * 1e9));
+        if (run.speedup > 0)
+            fprintf(file, "\"speedup\": %.3f, \"efficiency\": %.3f, ", run.speedup, run.speedup / run.threads);
+        fprintf(file, "\"hash\": \"%016llx\", \"check\": \"%s\", \"match\": %s }%s\n",
+                (unsigned long long)run.hash, run.check.c_str(), run.match ? "true" : "false",
+                i + 1 < runs.size() ? "," : "");
+    }
+    fprintf(file, "  ],\n");
+    if (!censuses.empty())
+    {
+        fprintf(file, "  \"census\": [\n");
+        for (size_t i = 0; i < censuses.size(); ++i)
+        {
+            const CensusRun& census = censuses[i];
+            fprintf(file, "    { \"threads\": %u, \"soups\": %llu, \"unsettled\": %llu, \"seconds\": %.6f, "
+                          "\"soupsPerSecond\": %.3f, \"hash\": \"%016llx\", \"match\": %s, \"objects\": {",
+                    census.threads, (unsigned long long)census.soups, (unsigned long long)census.unsettled,
+                    census.seconds, census.soups / census.seconds, (unsigned long long)census.hash,
+                    census.match ? "true" : "false");
+            for (size_t j = 0; j < census.top.size(); ++j)
+                fprintf(file, "%s\"%s\": %llu", j ? ", " : " ", census.top[j].code.c_str(),
+                        (unsigned long long)census.top[j].count);
+            fprintf(file, " } }%s\n", i + 1 < censuses.size() ? "," : "");
+        }
+        fprintf(file, "  ],\n");
+    }
+    if (!batches.empty())
+    {
+        fprintf(file, "  \"batch\": [\n");
+        for (size_t i = 0; i < batches.size(); ++i)
+        {
+            const BatchRun& batch = batches[i];
+            const double cells = (double)LifeBatch::kMaxSize * LifeBatch::kMaxSize * batch.boards * batch.generations;
+            fprintf(file, "    { \"path\": \"%s\", \"rules\": \"%s\", \"boards\": %u, \"threads\": %u, "
+                          "\"generations\": %llu, \"seconds\": %.6f, \"cellsPerNanosecond\": %.4f, "
+                          "\"hash\": \"%016llx\", \"match\": %s }%s\n",
+                    batch.path.c_str(), batch.rules.c_str(), batch.boards, batch.threads,
+                    (unsigned long long)batch.generations, batch.seconds, cells / (batch.seconds * 1e9),
+                    (unsigned long long)batch.hash, batch.match ? "true" : "false", i + 1 < batches.size() ? "," : "");
+        }
+        fprintf(file, "  ],\n");
+    }
+    if (!clusters.empty())
+    {
+        fprintf(file, "  \"cluster\": [\n");
+        for (size_t i = 0; i < clusters.size(); ++i)
+        {
+            const ClusterRun& cluster = clusters[i];
+            const double cells = (double)cluster.size * cluster.size * cluster.generations;
+            fprintf(file, "    { \"size\": %u, \"workers\": %u, \"haloDepth\": %u, \"generations\": %llu, "
+                          "\"seconds\": %.6f, \"cellsPerNanosecond\": %.4f, \"hash\": \"%016llx\", \"match\": %s }%s\n",
+                    cluster.size, cluster.workers, cluster.haloDepth, (unsigned long long)cluster.generations,
+                    cluster.seconds, cells / (cluster.seconds * 1e9), (unsigned long long)cluster.hash,
+                    cluster.match ? "true" : "false", i + 1 < clusters.size() ? "," : "");
+        }
+        fprintf(file, "  ],\n");
+    }
+    fprintf(file, "  \"mismatches\": %u\n}\n", mismatches);
+}
+
+}
+
+int main(int argc, const char* argv[])
+{
+    // Spawned by --cluster: serve one band, then exit.
+    if (argc == 2 && !strncmp(argv[1], "--cluster-worker=", 17))
+        return (LifeClusterWorker::run(argv[1] + 17) ? 0 : 1);
+
+    Config config;
+    if (!parseArguments(argc, argv, config))
+        return (2);
+
+    std::vector<Run> runs;
+    uint32_t mismatches = 0;
+    std::vector<uint32_t> grid;
+
+    // Pools are built once; spinning threads up is not what is being measured.
+    std::vector<std::unique_ptr<WorkStealingPool>> pools;
+    for (uint32_t count : config.threads)
+        pools.push_back(std::make_unique<WorkStealingPool>(count));
+
+    for (uint32_t size : config.sizes)
+    {
+        const JDLVState state = { size, size, (uint32_t)config.topology, 0 };
+        const uint64_t cells = (uint64_t)size * size;
+        const uint64_t generations = config.generations ? config.generations
+                                   : std::min<uint64_t>(4096, std::max<uint64_t>(4, config.cellBudget / cells));
+
+        for (const std::string& pattern : config.patterns)
+        {
+            seed(pattern, state, config.seed, grid);
+            fprintf(stderr, "%ux%u %s, %llu generations\n", size, size, pattern.c_str(), (unsigned long long)generations);
+
+            // Ground truth. Too slow for the biggest boards: there the scalar packed kernel stands in.
+            uint64_t expected = 0;
+            std::string expectedFrom;
+            if (cells * generations <= config.referenceLimit)
+            {
+                JDLVReference reference(state);
+                const double seconds = bestOf(1, [&] { reference.importGrid(grid.data()); },
+                                                 [&] { reference.step(generations); });
+                expected = hashGrid(state, reference.grid());
+                expectedFrom = "reference";
+                runs.push_back({ "reference", pattern, size, 1, generations, seconds,
+                                 2.0 * cells * sizeof(uint32_t), expected, "self", true, 0 });
+            }
+
+            // Packed single-threaded engine, one run per kernel the CPU has.
+            LifeEngine engine(state);
+            for (LifeKernel kernel : { LifeKernel::Scalar, LifeKernel::AVX2, LifeKernel::NEON })
+            {
+                if (!engine.setKernel(kernel))
+                    continue;
+                const double seconds = bestOf(config.repeat, [&] { engine.importGrid(grid.data()); },
+                                                             [&] { engine.step(generations); });
+                const uint64_t hash = hashEngine(engine);
+                if (expectedFrom.empty())
+                {
+                    expected = hash;
+                    expectedFrom = std::string("engine-") + life_kernels::name(kernel);
+                }
+                runs.push_back({ std::string("engine-") + life_kernels::name(kernel), pattern, size, 1, generations,
+                                 seconds, 2.0 * engine.cellWords() * sizeof(uint64_t), hash, expectedFrom,
+                                 hash == expected, 0 });
+            }
+
+            // Banded threaded stepper on the best kernel, once per thread count.
+            engine.setKernel(life_kernels::best());
+            double singleThread = 0;
+            for (size_t p = 0; p < pools.size(); ++p)
+            {
+                LifeThreadedStepper stepper(*pools[p]);
+                const double seconds = bestOf(config.repeat, [&] { engine.importGrid(grid.data()); },
+                                                             [&] { stepper.run(engine, generations); });
+                const uint64_t hash = hashEngine(engine);
+                if (config.threads[p] == 1)
+                    singleThread = seconds;
+                runs.push_back({ std::string("threaded-") + life_kernels::name(engine.kernel()), pattern, size,
+                                 config.threads[p], generations, seconds,
+                                 2.0 * engine.cellWords() * sizeof(uint64_t), hash, expectedFrom, hash == expected,
+                                 singleThread > 0 ? singleThread / seconds : 0 });
+            }
+
+            // Temporally blocked passes: modelled traffic is one read and one write per pass.
+            LifeTemporalStepper temporal;
+            double singleWorker = 0;
+            for (size_t p = 0; p <= pools.size(); ++p)
+            {
+                WorkStealingPool* pool = p ? pools[p - 1].get() : nullptr;
+                const double seconds = bestOf(config.repeat, [&] { engine.importGrid(grid.data()); },
+                                                             [&] { temporal.run(engine, generations, pool); });
+                const uint64_t hash = hashEngine(engine);
+                if (pool && config.threads[p - 1] == 1)
+                    singleWorker = seconds;
+                runs.push_back({ std::string(pool ? "temporal-threaded-" : "temporal-") + life_kernels::name(engine.kernel()),
+                                 pattern, size, pool ? config.threads[p - 1] : 1, generations, seconds,
+                                 2.0 * engine.cellWords() * sizeof(uint64_t) / std::max<uint32_t>(1, temporal.depth()),
+                                 hash, expectedFrom, hash == expected, pool && singleWorker > 0 ? singleWorker / seconds : 0 });
+            }
+
+            // The unbounded engines only agree with the bounded ones while nothing reaches an
+            // edge, so they are checked against each other over the board window.
+            if (config.topology == JDLVTopologyPlane || config.topology == JDLVTopologyTorus)
+            {
+                std::vector<uint32_t> window(cells);
+                LifeUniverse universe;
+                const double universeSeconds = bestOf(config.repeat, [&] { universe.clear(); universe.importGrid(state, grid.data()); },
+                                                                     [&] { universe.step(generations); });
+                universe.exportWindow(0, 0, state, window.data());
+                const uint64_t universeHash = hashGrid(state, window.data());
+                runs.push_back({ "universe", pattern, size, 1, generations, universeSeconds,
+                                 (double)universe.tileCount() * LifeUniverse::kTileSize * sizeof(uint64_t) * 2,
+                                 universeHash, "self", true, 0 });
+
+                HashLife hashLife;
+                const double hashLifeSeconds = bestOf(config.repeat, [&] { hashLife.clear(); hashLife.importGrid(state, grid.data()); },
+                                                                     [&] { hashLife.advance(generations); });
+                hashLife.exportWindow(0, 0, state, window.data());
+                const uint64_t hashLifeHash = hashGrid(state, window.data());
+                runs.push_back({ "hashlife", pattern, size, 1, generations, hashLifeSeconds, 0,
+                                 hashLifeHash, "universe", hashLifeHash == universeHash, 0 });
+            }
+        }
+    }
+
+    // Soups are seeded from their index alone, so every thread count must tally the same objects.
+    std::vector<CensusRun> censuses;
+    for (size_t p = 0; config.census && p < pools.size(); ++p)
+    {
+        fprintf(stderr, "census, %llu soups on %u threads\n", (unsigned long long)config.census, config.threads[p]);
+        LifeCensus census(config.seed);
+        census.run(config.census, pools[p].get());
+        const std::vector<LifeCensus::Tally> tallies = census.results();
+        uint64_t hash = 0xCBF29CE484222325ull;
+        for (const LifeCensus::Tally& tally : tallies)
+        {
+            for (char c : tally.code)
+                hash = (hash ^ (uint8_t)c) * 0x100000001B3ull;
+            hash = (hash ^ tally.count) * 0x100000001B3ull;
+        }
+        CensusRun run = { config.threads[p], census.soups(), census.unsettled(), census.seconds(), hash,
+                          censuses.empty() || hash == censuses[0].hash, {} };
+        run.top.assign(tallies.begin(), tallies.begin() + std::min<size_t>(tallies.size(), 16));
+        censuses.push_back(run);
+    }
+
+    // Small boards in bulk: each soup seeded from its index, each mixed rule drawn from it too.
+    std::vector<BatchRun> batches;
+    if (config.batch)
+    {
+        const uint32_t side = LifeBatch::kMaxSize;
+        const JDLVState state = { side, side, (uint32_t)config.topology, 0 };
+        const uint64_t generations = config.generations ? config.generations : 256;
+        for (const char* rules : { "conway", "mixed" })
+        {
+            std::vector<std::vector<uint32_t>> soups(config.batch);
+            std::vector<LifeRule> boardRules(config.batch, LifeRule::conway());
+            for (uint32_t i = 0; i < config.batch; ++i)
+            {
+                seed("soup", state, config.seed + i, soups[i]);
+                if (!strcmp(rules, "mixed"))
+                {
+                    const uint64_t bits = (config.seed + i) * 0x9E3779B97F4A7C15ull;
+                    boardRules[i] = { (uint16_t)((bits >> 20) & 0x1FF), (uint16_t)((bits >> 40) & 0x1FF), 2 };
+                }
+            }
+            fprintf(stderr, "batch, %u %ux%u boards of %s rules, %llu generations\n", config.batch, side, side, rules,
+                    (unsigned long long)generations);
+
+            uint64_t expected = 0xCBF29CE484222325ull;
+            std::vector<uint32_t> board((size_t)side * side);
+            for (uint32_t i = 0; i < config.batch; ++i)
+            {
+                LifeEngine engine(state);
+                engine.setRule(boardRules[i]);
+                engine.importGrid(soups[i].data());
+                engine.step(generations);
+                expected = (expected ^ hashEngine(engine)) * 0x100000001B3ull;
+            }
+
+            LifeBatch batch(state, config.batch);
+            for (uint32_t i = 0; i < config.batch; ++i)
+                batch.setRule(i, boardRules[i]);
+            auto reset = [&]
+            {
+                for (uint32_t i = 0; i < config.batch; ++i)
+                    batch.importGrid(i, soups[i].data());
+                batch.setGeneration(0);
+            };
+            auto check = [&]
+            {
+                uint64_t hash = 0xCBF29CE484222325ull;
+                for (uint32_t i = 0; i < config.batch; ++i)
+                {
+                    batch.exportGrid(i, board.data());
+                    hash = (hash ^ hashGrid(state, board.data())) * 0x100000001B3ull;
+                }
+                return (hash);
+            };
+            for (LifeKernel kernel : { LifeKernel::Scalar, LifeKernel::AVX2, LifeKernel::NEON })
+            {
+                if (!batch.setKernel(kernel))
+                    continue;
+                const double seconds = bestOf(config.repeat, reset, [&] { batch.step(generations); });
+                const uint64_t hash = check();
+                batches.push_back({ std::string("batch-") + life_kernels::name(kernel), rules, config.batch, 1,
+                                    generations, seconds, hash, hash == expected });
+            }
+            batch.setKernel(life_kernels::best());
+            for (size_t p = 0; p < pools.size(); ++p)
+            {
+                const double seconds = bestOf(config.repeat, reset, [&] { batch.step(generations, pools[p].get()); });
+                const uint64_t hash = check();
+                batches.push_back({ std::string("batch-threaded-") + life_kernels::name(batch.kernel()), rules,
+                                    config.batch, config.threads[p], generations, seconds, hash, hash == expected });
+            }
+        }
+    }
+
+    // Worker processes on loopback: the halo traffic is real, the network is not.
+    std::vector<ClusterRun> clusters;
+    for (uint32_t size : config.cluster ? config.sizes : std::vector<uint32_t>())
+    {
+        const JDLVState state = { size, size, (uint32_t)config.topology, 0 };
+        const uint64_t cells = (uint64_t)size * size;
+        const uint64_t generations = config.generations ? config.generations
+                                   : std::min<uint64_t>(4096, std::max<uint64_t>(4, config.cellBudget / cells));
+        seed("soup", state, config.seed, grid);
+        LifeEngine engine(state);
+        engine.importGrid(grid.data());
+        engine.step(generations);
+        const uint64_t expected = hashEngine(engine);
+
+        for (uint32_t depth : { 1u, 8u })
+        {
+            fprintf(stderr, "cluster, %ux%u soup on %u workers, halo depth %u, %llu generations\n", size, size,
+                    config.cluster, depth, (unsigned long long)generations);
+            LifeCluster cluster;
+            if (!cluster.listen("tcp:127.0.0.1:0"))
+                return (2);
+            std::vector<pid_t> workers;
+            const std::string address = "--cluster-worker=" + cluster.address();
+            for (uint32_t i = 0; i < config.cluster; ++i)
+            {
+                const pid_t pid = fork();
+                if (pid == 0)
+                {
+                    char* args[] = { const_cast<char*>(argv[0]), const_cast<char*>(address.c_str()), nullptr };
+                    execvp(argv[0], args);
+                    _exit(127);
+                }
+                if (pid > 0)
+                    workers.push_back(pid);
+            }
+            bool ok = workers.size() == config.cluster
+                   && cluster.start(config.cluster, state, LifeRule::conway(), depth, grid.data());
+            double seconds = 0;
+            if (ok)
+            {
+                const double start = now();
+                ok = cluster.step(generations);
+                seconds = now() - start;
+            }
+            std::vector<uint32_t> board(cells);
+            ok = ok && cluster.gather(board.data());
+            const uint64_t hash = ok ? hashGrid(state, board.data()) : 0;
+            const uint32_t haloDepth = cluster.haloDepth();
+            cluster.shutdown();
+            for (pid_t pid : workers)
+            {
+                int status = 0;
+                waitpid(pid, &status, 0);
+                ok = ok && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+            }
+            clusters.push_back({ size, config.cluster, haloDepth, generations, seconds, hash, ok && hash == expected });
+        }
+    }
+
+    for (const Run& run : runs)
+        mismatches += !run.match;
+    for (const CensusRun& census : censuses)
+        mismatches += !census.match;
+    for (const BatchRun& batch : batches)
+        mismatches += !batch.match;
+    for (const ClusterRun& cluster : clusters)
+        mismatches += !cluster.match;
+
+    FILE* file = stdout;
+    if (!config.out.empty() && !(file = fopen(config.out.c_str(), "w")))
+    {
+        printf("Cannot write %s\n", config.out.c_str());
+        return (2);
+    }
+    writeReport(file, config, runs, censuses, batches, clusters, mismatches);
+    if (file != stdout)
+        fclose(file);
+    return (mismatches ? 1 : 0);
+}
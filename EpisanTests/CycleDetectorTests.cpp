@@ -0,0 +1,120 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: CycleDetectorTests.cpp        +++     +++     **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 17/10/2026 23:10:18      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+// LifeCycleDetector on objects of known period: extinction, a still life,
+// oscillators of period 2, 3 and 15, a glider going round a torus, a
+// history too short for the cycle, and run()'s fast-forward against
+// stepping every generation.
+
+#include <cstdint>
+#include <cstring>
+
+#include "EpisanTest.hpp"
+#include "RMDLLifeCycleDetector.hpp"
+#include "RMDLLifeEngine.hpp"
+
+namespace
+{
+
+const char* const kBlock[] = { "OO", "OO", nullptr };
+const char* const kBlinker[] = { "OOO", nullptr };
+const char* const kPulsar[] =
+{
+    "..OOO...OOO..",
+    ".............",
+    "O....O.O....O",
+    "O....O.O....O",
+    "O....O.O....O",
+    "..OOO...OOO..",
+    ".............",
+    "..OOO...OOO..",
+    "O....O.O....O",
+    "O....O.O....O",
+    "O....O.O....O",
+    ".............",
+    "..OOO...OOO..",
+    nullptr
+};
+const char* const kPentadecathlon[] = { "..O....O..", "OO.OOOO.OO", "..O....O..", nullptr };
+const char* const kGlider[] = { ".O.", "..O", "OOO", nullptr };
+const char* const kLonelyCell[] = { "O", nullptr };
+
+void place(LifeEngine& engine, const char* const* rows, uint32_t x0, uint32_t y0)
+{
+    for (uint32_t y = 0; rows[y]; ++y)
+        for (uint32_t x = 0; rows[y][x]; ++x)
+            engine.setCell(x0 + x, y0 + y, rows[y][x] == 'O');
+}
+
+// Observes every generation until the detector settles or `limit` runs out.
+LifeCycleDetector::State settle(LifeEngine& engine, LifeCycleDetector& detector, uint32_t limit)
+{
+    detector.observe(engine);
+    for (uint32_t g = 0; g < limit && detector.state() == LifeCycleDetector::State::Running; ++g)
+    {
+        engine.step();
+        detector.observe(engine);
+    }
+    return (detector.state());
+}
+
+void testPeriod(const char* const* object, JDLVTopology topology, uint32_t size,
+                LifeCycleDetector::State expected, uint32_t period)
+{
+    LifeEngine engine({ size, size, (uint32_t)topology, 0 });
+    place(engine, object, size / 2 - 6, size / 2 - 6);
+    LifeCycleDetector detector(256);
+    EPISAN_CHECK(settle(engine, detector, 400) == expected);
+    EPISAN_CHECK(detector.period() == period);
+}
+
+// A history of 8 generations cannot see a period of 15.
+void testShortHistory()
+{
+    LifeEngine engine({ 64, 64, JDLVTopologyPlane, 0 });
+    place(engine, kPentadecathlon, 27, 30);
+    LifeCycleDetector detector(8);
+    EPISAN_CHECK(settle(engine, detector, 100) == LifeCycleDetector::State::Running);
+}
+
+// run() skips whole periods but ends on the same board as stepping through.
+void testFastForward()
+{
+    LifeEngine fast({ 64, 64, JDLVTopologyPlane, 0 }), slow({ 64, 64, JDLVTopologyPlane, 0 });
+    place(fast, kPulsar, 20, 20);
+    place(slow, kPulsar, 20, 20);
+    LifeCycleDetector detector;
+    const uint64_t stepped = detector.run(fast, 1001);
+    slow.step(1001);
+    EPISAN_CHECK(detector.state() == LifeCycleDetector::State::Oscillating && detector.period() == 3);
+    EPISAN_CHECK(stepped < 10);
+    EPISAN_CHECK(fast.generation() == 1001 && fast.population() == slow.population());
+    bool same = true;
+    for (uint32_t y = 0; y < 64; ++y)
+        same &= !memcmp(fast.row((int32_t)y), slow.row((int32_t)y), fast.wordsPerRow() * sizeof(uint64_t));
+    EPISAN_CHECK(same);
+}
+
+}
+
+int main()
+{
+    using State = LifeCycleDetector::State;
+    testPeriod(kLonelyCell, JDLVTopologyPlane, 64, State::Extinct, 1);
+    testPeriod(kBlock, JDLVTopologyPlane, 64, State::StillLife, 1);
+    testPeriod(kBlinker, JDLVTopologyPlane, 64, State::Oscillating, 2);
+    testPeriod(kPulsar, JDLVTopologyPlane, 64, State::Oscillating, 3);
+    testPeriod(kPentadecathlon, JDLVTopologyPlane, 64, State::Oscillating, 15);
+    // One cell diagonally every 4 generations: back home after 4 * 32.
+    testPeriod(kGlider, JDLVTopologyTorus, 32, State::Oscillating, 128);
+    testShortHistory();
+    testFastForward();
+    return (episan_test::result());
+}
@@ -0,0 +1,201 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: DirtyRangeTrackerTests.cpp    +++     +++     **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 21/10/2026 10:04:37      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+// DirtyRangeTracker against a mock UploadTarget standing in for a managed
+// MTL::Buffer: merging, the gap threshold, out-of-order adds and clipping
+// at the end of the buffer, then random writes checked byte by byte.
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "EpisanTest.hpp"
+#include "RMDLDirtyRangeTracker.hpp"
+
+namespace
+{
+
+typedef DirtyRangeTracker::Range Range;
+
+// Holds the bytes and records every didModifyRange call.
+class MockTarget : public UploadTarget
+{
+public:
+    explicit MockTarget(size_t length) : _bytes(length, 0) {}
+
+    uint8_t*    contents() override                 { return (_bytes.data()); }
+    size_t      length() const override             { return (_bytes.size()); }
+    void        didModifyRange(size_t offset, size_t length) override { calls.push_back({ offset, length }); }
+
+    const std::vector<uint8_t>& bytes() const       { return (_bytes); }
+
+    std::vector<Range>  calls;
+
+private:
+    std::vector<uint8_t>    _bytes;
+};
+
+bool same(const std::vector<Range>& ranges, const std::vector<Range>& expected)
+{
+    if (ranges.size() != expected.size())
+        return (false);
+    for (size_t i = 0; i < ranges.size(); ++i)
+        if (ranges[i].offset != expected[i].offset || ranges[i].length != expected[i].length)
+            return (false);
+    return (true);
+}
+
+std::vector<uint8_t> pattern(size_t length)
+{
+    std::vector<uint8_t> source(length);
+    for (size_t i = 0; i < length; ++i)
+        source[i] = (uint8_t)(i * 7 + 1);
+    return (source);
+}
+
+void testMerge()
+{
+    DirtyRangeTracker tracker(0);
+    tracker.add(0, 16);
+    tracker.add(16, 16);        // touching
+    tracker.add(24, 32);        // overlapping
+    tracker.add(40, 4);         // inside
+    tracker.add(100, 0);        // empty, ignored
+    EPISAN_CHECK(same(tracker.ranges(), { { 0, 56 } }));
+    EPISAN_CHECK(tracker.bytes() == 56);
+}
+
+void testGapThreshold()
+{
+    DirtyRangeTracker tracker(8);
+    tracker.add(0, 8);
+    tracker.add(16, 8);         // gap of 8: merged
+    tracker.add(33, 8);         // gap of 9: kept apart
+    EPISAN_CHECK(same(tracker.ranges(), { { 0, 24 }, { 33, 8 } }));
+
+    // A new threshold re-merges what is pending.
+    tracker.setGapThreshold(16);
+    EPISAN_CHECK(same(tracker.ranges(), { { 0, 41 } }));
+    tracker.clear();
+    EPISAN_CHECK(tracker.empty());
+
+    DirtyRangeTracker exact(0);
+    exact.add(0, 8);
+    exact.add(9, 8);
+    EPISAN_CHECK(same(exact.ranges(), { { 0, 8 }, { 9, 8 } }));
+}
+
+void testOutOfOrder()
+{
+    DirtyRangeTracker tracker(4);
+    tracker.add(300, 10);
+    tracker.add(100, 10);
+    tracker.add(200, 10);
+    tracker.add(112, 10);       // gap of 2 after [100, 110)
+    tracker.add(50, 300);       // swallows everything
+    tracker.add(400, 1);
+    EPISAN_CHECK(same(tracker.ranges(), { { 50, 300 }, { 400, 1 } }));
+
+    DirtyRangeTracker reversed(0);
+    for (size_t i = 10; i-- > 0; )
+        reversed.add(i * 20, 10);
+    std::vector<Range> expected;
+    for (size_t i = 0; i < 10; ++i)
+        expected.push_back({ i * 20, 10 });
+    EPISAN_CHECK(same(reversed.ranges(), expected));
+}
+
+void testClipping()
+{
+    const std::vector<uint8_t> source = pattern(256);
+    MockTarget target(100);
+    DirtyRangeTracker tracker(0);
+    tracker.add(10, 10);
+    tracker.add(90, 50);        // runs past the end: clipped to [90, 100)
+    tracker.add(150, 10);       // past the end: dropped
+    EPISAN_CHECK(tracker.flush(source.data(), target) == 20);
+    EPISAN_CHECK(same(target.calls, { { 10, 10 }, { 90, 10 } }));
+    EPISAN_CHECK(std::equal(source.begin() + 90, source.begin() + 100, target.bytes().begin() + 90));
+    EPISAN_CHECK(target.bytes()[20] == 0 && target.bytes()[89] == 0);
+    EPISAN_CHECK(tracker.empty());
+
+    // Nothing pending: nothing flagged.
+    target.calls.clear();
+    EPISAN_CHECK(tracker.flush(source.data(), target) == 0);
+    EPISAN_CHECK(target.calls.empty());
+}
+
+// Random writes: every dirty byte reaches the target, every flagged range
+// was copied, no flagged ranges overlap and nothing outside them changes.
+void testRandom()
+{
+    std::mt19937 rng(20);
+    for (int round = 0; round < 200; ++round)
+    {
+        const size_t length = 1 + rng() % 8192;
+        const size_t threshold = rng() % 3 == 0 ? 0 : rng() % 512;
+        std::vector<uint8_t> source(length, 0);
+        MockTarget target(length);
+        DirtyRangeTracker tracker(threshold);
+        std::vector<bool> dirty(length, false);
+
+        const int writes = (int)(rng() % 40);
+        for (int i = 0; i < writes; ++i)
+        {
+            const size_t offset = rng() % length;
+            const size_t count = 1 + rng() % std::min<size_t>(length - offset, 300);
+            for (size_t b = offset; b < offset + count; ++b)
+            {
+                source[b] = (uint8_t)(1 + rng() % 255);
+                dirty[b] = true;
+            }
+            tracker.add(offset, count);
+        }
+
+        const size_t uploaded = tracker.flush(source.data(), target);
+        std::vector<bool> flagged(length, false);
+        size_t flaggedBytes = 0;
+        bool overlaps = false;
+        for (const Range& call : target.calls)
+        {
+            for (size_t b = call.offset; b < call.offset + call.length; ++b)
+            {
+                overlaps |= flagged[b];
+                flagged[b] = true;
+            }
+            flaggedBytes += call.length;
+        }
+        EPISAN_CHECK(!overlaps);
+        EPISAN_CHECK(uploaded == flaggedBytes);
+        EPISAN_CHECK(target.calls.size() <= (size_t)writes);
+        for (size_t i = 1; i < target.calls.size(); ++i)
+            EPISAN_CHECK(target.calls[i].offset > target.calls[i - 1].offset + target.calls[i - 1].length + threshold);
+        bool exact = true;
+        for (size_t b = 0; b < length; ++b)
+        {
+            exact &= !dirty[b] || flagged[b];
+            exact &= target.bytes()[b] == (flagged[b] ? source[b] : 0);
+        }
+        EPISAN_CHECK(exact);
+    }
+}
+
+}
+
+int main()
+{
+    testMerge();
+    testGapThreshold();
+    testOutOfOrder();
+    testClipping();
+    testRandom();
+    return (episan_test::result());
+}
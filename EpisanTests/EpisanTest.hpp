@@ -0,0 +1,47 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: EpisanTest.hpp                +++     +++     **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 21/10/2026 10:02:11      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+#ifndef EPISANTEST_HPP
+# define EPISANTEST_HPP
+
+# include <cstdio>
+
+// Each test is a plain executable run by ctest: EPISAN_CHECK reports every
+// failed expectation, and main() returns episan_test::result().
+
+namespace episan_test
+{
+    inline int& failures()
+    {
+        static int count = 0;
+        return (count);
+    }
+
+    inline bool check(bool ok, const char* expression, const char* file, int line)
+    {
+        if (!ok)
+        {
+            printf("%s:%d: check failed: %s\n", file, line, expression);
+            ++failures();
+        }
+        return (ok);
+    }
+
+    inline int result()
+    {
+        if (failures())
+            printf("%d check(s) failed\n", failures());
+        return (failures() ? 1 : 0);
+    }
+}
+
+# define EPISAN_CHECK(expression) episan_test::check((expression), #expression, __FILE__, __LINE__)
+
+#endif /* EPISANTEST_HPP */
@@ -0,0 +1,185 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: FrameTelemetryTests.cpp       +++     +++     **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 21/10/2026 10:41:05      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+// FrameTelemetry on a fake clock: what one frame records, snapshot() once
+// the ring has wrapped, the Chrome trace it writes, and a reader racing
+// the writer, which must never see a torn record.
+
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "EpisanTest.hpp"
+#include "RMDLFrameTelemetry.hpp"
+
+namespace
+{
+
+// Every reading advances by 1000 ns, so each timestamp is predictable.
+std::atomic<uint64_t> gTicks(0);
+
+uint64_t fakeClock()
+{
+    return (gTicks.fetch_add(1000) + 1000);
+}
+
+void recordFrame(FrameTelemetry& telemetry, uint64_t frameIndex)
+{
+    telemetry.beginFrame(frameIndex);
+    telemetry.beginWait();
+    telemetry.endWait();
+    for (uint32_t s = 0; s < (uint32_t)FrameStage::Count; ++s)
+    {
+        FrameStageScope scope(telemetry, (FrameStage)s);
+        telemetry.countAllocation(frameIndex * 3 + s);
+    }
+    telemetry.endFrame();
+}
+
+void testOneFrame()
+{
+    gTicks = 0;
+    FrameTelemetry telemetry(4, fakeClock);
+    recordFrame(telemetry, 42);
+
+    std::vector<FrameRecord> frames;
+    telemetry.snapshot(frames);
+    EPISAN_CHECK(frames.size() == 1);
+    if (frames.size() != 1)
+        return;
+    const FrameRecord& frame = frames[0];
+    EPISAN_CHECK(frame.serial == 0 && frame.frameIndex == 42);
+    EPISAN_CHECK(frame.frameBegin == 1000 && frame.waitBegin == 2000 && frame.waitEnd == 3000);
+    EPISAN_CHECK(frame.waitTime() == 1000);
+    for (uint32_t s = 0; s < (uint32_t)FrameStage::Count; ++s)
+    {
+        EPISAN_CHECK(frame.stageBegin[s] == 4000 + 2000 * s);
+        EPISAN_CHECK(frame.stageTime((FrameStage)s) == 1000);
+    }
+    EPISAN_CHECK(frame.frameEnd == 4000 + 2000 * (uint64_t)FrameStage::Count);
+    EPISAN_CHECK(frame.allocations == (uint64_t)FrameStage::Count);
+    EPISAN_CHECK(frame.allocatedBytes == 42 * 3 * 4 + 0 + 1 + 2 + 3);
+}
+
+void testWrapAround()
+{
+    FrameTelemetry telemetry(5, fakeClock);
+    EPISAN_CHECK(telemetry.capacity() == 8);
+
+    std::vector<FrameRecord> frames;
+    telemetry.snapshot(frames);
+    EPISAN_CHECK(frames.empty());
+
+    for (uint64_t i = 0; i < 21; ++i)
+        recordFrame(telemetry, 100 + i);
+    EPISAN_CHECK(telemetry.framesRecorded() == 21);
+
+    // Only the last capacity() frames survive, oldest first.
+    telemetry.snapshot(frames);
+    EPISAN_CHECK(frames.size() == 8);
+    for (size_t i = 0; i < frames.size(); ++i)
+        EPISAN_CHECK(frames[i].serial == 13 + i && frames[i].frameIndex == 113 + i);
+
+    telemetry.snapshot(frames, 3);
+    EPISAN_CHECK(frames.size() == 3 && frames[0].serial == 18 && frames[2].serial == 20);
+    telemetry.snapshot(frames, 0);
+    EPISAN_CHECK(frames.empty());
+}
+
+size_t count(const std::string& text, const std::string& needle)
+{
+    size_t found = 0;
+    for (size_t at = text.find(needle); at != std::string::npos; at = text.find(needle, at + 1))
+        ++found;
+    return (found);
+}
+
+void testChromeTrace()
+{
+    gTicks = 0;
+    FrameTelemetry telemetry(4, fakeClock);
+    recordFrame(telemetry, 7);
+    recordFrame(telemetry, 8);
+
+    FILE* file = tmpfile();
+    EPISAN_CHECK(file != nullptr);
+    if (!file)
+        return;
+    EPISAN_CHECK(telemetry.writeChromeTrace(file));
+    std::string trace(ftell(file), '\0');
+    rewind(file);
+    EPISAN_CHECK(fread(&trace[0], 1, trace.size(), file) == trace.size());
+    fclose(file);
+
+    // Per frame: the frame, the wait and every stage as complete events, then a counter.
+    const size_t stages = (size_t)FrameStage::Count;
+    EPISAN_CHECK(trace.compare(0, 17, "{\"displayTimeUnit") == 0);
+    EPISAN_CHECK(trace.size() >= 4 && trace.compare(trace.size() - 4, 4, "\n]}\n") == 0);
+    EPISAN_CHECK(count(trace, "\"ph\":\"M\"") == 2);
+    EPISAN_CHECK(count(trace, "\"ph\":\"X\"") == 2 * (2 + stages));
+    EPISAN_CHECK(count(trace, "\"ph\":\"C\"") == 2);
+    EPISAN_CHECK(count(trace, "\"name\":\"Frame 7\"") == 1 && count(trace, "\"name\":\"Frame 8\"") == 1);
+    EPISAN_CHECK(count(trace, "\"name\":\"Grid Upload\"") == 2);
+    // The first frame starts at 1000 ns and lasts (3 + 2 * stages) readings: microseconds in the trace.
+    char first[96];
+    snprintf(first, sizeof(first), "\"ts\":1.000,\"dur\":%.3f,\"args\":{\"frame\":7}", (2.0 * stages + 3.0));
+    EPISAN_CHECK(trace.find(first) != std::string::npos);
+    EPISAN_CHECK(trace.find(",,") == std::string::npos && trace.find("[,") == std::string::npos);
+}
+
+// The writer fills every field from the frame index; a torn read would mix two frames.
+void testConcurrentReader()
+{
+    FrameTelemetry telemetry(8, fakeClock);
+    const uint64_t total = 200000;
+    std::atomic<bool> done(false);
+    std::atomic<uint64_t> torn(0), seen(0), disorder(0);
+
+    std::thread reader([&]
+    {
+        std::vector<FrameRecord> frames;
+        while (!done.load())
+        {
+            telemetry.snapshot(frames);
+            for (size_t i = 0; i < frames.size(); ++i)
+            {
+                const FrameRecord& frame = frames[i];
+                torn += frame.frameIndex != frame.serial * 2
+                     || frame.allocatedBytes != frame.frameIndex * 3 * 4 + 6
+                     || frame.frameEnd < frame.frameBegin;
+                disorder += i && frame.serial <= frames[i - 1].serial;
+            }
+            seen += frames.size();
+        }
+    });
+    for (uint64_t i = 0; i < total; ++i)
+        recordFrame(telemetry, i * 2);
+    done = true;
+    reader.join();
+
+    EPISAN_CHECK(torn.load() == 0);
+    EPISAN_CHECK(disorder.load() == 0);
+    EPISAN_CHECK(telemetry.framesRecorded() == total);
+    printf("FrameTelemetry: reader checked %llu records\n", (unsigned long long)seen.load());
+}
+
+}
+
+int main()
+{
+    testOneFrame();
+    testWrapAround();
+    testChromeTrace();
+    testConcurrentReader();
+    return (episan_test::result());
+}
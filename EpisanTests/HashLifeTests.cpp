@@ -0,0 +1,78 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: HashLifeTests.cpp             +++     +++     **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 17/10/2026 22:06:51      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+// HashLife against LifeEngine on a plane board wide enough that nothing
+// reaches its edge: a soup advanced by odd counts and by powers of two,
+// under B3/S23 and B36/S23, once with garbage collection forced.
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "EpisanTest.hpp"
+#include "RMDLHashLife.hpp"
+#include "RMDLLifeEngine.hpp"
+
+namespace
+{
+
+constexpr uint32_t kBoard = 512;
+constexpr uint32_t kSoup = 64;
+
+// The board's (0, 0) is HashLife's (-kBoard / 2, -kBoard / 2).
+bool sameCells(const LifeEngine& engine, const HashLife& hash)
+{
+    const JDLVState window = { kBoard, kBoard, JDLVTopologyPlane, 0 };
+    std::vector<uint32_t> expected((size_t)kBoard * kBoard), actual(expected.size());
+    engine.exportGrid(expected.data());
+    hash.exportWindow(-(int64_t)kBoard / 2, -(int64_t)kBoard / 2, window, actual.data());
+    return (expected == actual && engine.population() == hash.population() && engine.generation() == hash.generation());
+}
+
+void testSoup(const char* ruleString, uint32_t seed, size_t maxNodes)
+{
+    LifeRule rule;
+    EPISAN_CHECK(LifeRule::parse(ruleString, rule));
+    const JDLVState state = { kBoard, kBoard, JDLVTopologyPlane, 0 };
+    LifeEngine engine(state);
+    HashLife hash;
+    EPISAN_CHECK(engine.setRule(rule) && hash.setRule(rule));
+    if (maxNodes)
+        hash.setMaxNodes(maxNodes);
+
+    std::mt19937 rng(seed);
+    for (uint32_t y = (kBoard - kSoup) / 2; y < (kBoard + kSoup) / 2; ++y)
+        for (uint32_t x = (kBoard - kSoup) / 2; x < (kBoard + kSoup) / 2; ++x)
+            engine.setCell(x, y, rng() % 2 != 0);
+    std::vector<uint32_t> grid((size_t)kBoard * kBoard);
+    engine.exportGrid(grid.data());
+    hash.importGrid(state, grid.data(), -(int64_t)kBoard / 2, -(int64_t)kBoard / 2);
+    EPISAN_CHECK(sameCells(engine, hash));
+
+    // Ends at generation 300: gliders from the soup cover at most 75 of the 224 cells of margin.
+    static const uint64_t kSteps[] = { 1, 2, 37, 64, 100, 96 };
+    for (uint64_t steps : kSteps)
+    {
+        engine.step(steps);
+        hash.advance(steps);
+        EPISAN_CHECK(sameCells(engine, hash));
+    }
+}
+
+}
+
+int main()
+{
+    testSoup("B3/S23", 1, 0);
+    testSoup("B36/S23", 2, 0);
+    // A few thousand nodes: collection runs between most powers of two.
+    testSoup("B3/S23", 3, 4096);
+    return (episan_test::result());
+}
@@ -0,0 +1,109 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: LifeCensusTests.cpp           +++     +++     **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 17/10/2026 23:27:55      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+// LifeCensus::classify against the apgcodes Catagolue gives well-known
+// objects, in any orientation and phase; an R-pentomino has none.
+// separate() must cut an ash of several objects into the same codes.
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "EpisanTest.hpp"
+#include "RMDLLifeCensus.hpp"
+
+namespace
+{
+
+struct Known
+{
+    const char*     code;
+    const char*     rows[14];
+};
+
+const Known kKnown[] =
+{
+    { "xs4_33",     { "OO", "OO" } },
+    { "xs4_252",    { ".O.", "O.O", ".O." } },
+    { "xs5_253",    { "OO.", "O.O", ".O." } },
+    { "xs6_356",    { "OO.", "O.O", ".OO" } },
+    { "xs6_696",    { ".OO.", "O..O", ".OO." } },
+    { "xs7_2596",   { ".OO.", "O..O", ".O.O", "..O." } },
+    { "xs8_6996",   { ".OO.", "O..O", "O..O", ".OO." } },
+    { "xp2_7",      { "OOO" } },
+    { "xp2_7e",     { ".OOO", "OOO." } },
+    { "xp2_318c",   { "OO..", "O...", "...O", "..OO" } },
+    { "xp15_4r4z4r4", { "..O....O..", "OO.OOOO.OO", "..O....O.." } },
+    { "xq4_153",    { ".O.", "..O", "OOO" } },
+    { "xq4_6frc",   { ".O..O", "O....", "O...O", "OOOO." } },
+    { "xp3_co9nas0san9oczgoldlo0oldlogz1047210127401",
+      { "..OOO...OOO..", ".............", "O....O.O....O", "O....O.O....O", "O....O.O....O", "..OOO...OOO..",
+        ".............", "..OOO...OOO..", "O....O.O....O", "O....O.O....O", "O....O.O....O", ".............",
+        "..OOO...OOO.." } },
+};
+
+// The object turned by `symmetry` (bit 0: mirror x, bit 1: mirror y, bit 2: swap axes) and moved to (dx, dy).
+std::vector<LifeCensus::Cell> cells(const Known& known, uint32_t symmetry, int64_t dx, int64_t dy)
+{
+    std::vector<LifeCensus::Cell> out;
+    for (int64_t y = 0; y < 14 && known.rows[y]; ++y)
+        for (int64_t x = 0; known.rows[y][x]; ++x)
+            if (known.rows[y][x] == 'O')
+            {
+                int64_t u = symmetry & 1 ? -x : x, v = symmetry & 2 ? -y : y;
+                if (symmetry & 4)
+                    std::swap(u, v);
+                out.push_back({ u + dx, v + dy });
+            }
+    return (out);
+}
+
+void testKnownObjects()
+{
+    for (const Known& known : kKnown)
+        for (uint32_t symmetry = 0; symmetry < 8; ++symmetry)
+            EPISAN_CHECK(LifeCensus::classify(cells(known, symmetry, -7 + symmetry, 3 * symmetry)) == known.code);
+}
+
+void testNotPeriodic()
+{
+    const Known rPentomino = { "", { ".OO", "OO.", ".O." } };
+    EPISAN_CHECK(LifeCensus::classify(cells(rPentomino, 0, 0, 0)).empty());
+}
+
+// A block, a blinker and a beehive far enough apart to stay separate.
+void testSeparate()
+{
+    std::vector<LifeCensus::Cell> ash;
+    for (const Known& known : kKnown)
+    {
+        const std::string code = known.code;
+        if (code == "xs4_33" || code == "xp2_7" || code == "xs6_696")
+        {
+            const std::vector<LifeCensus::Cell> object = cells(known, 5, (int64_t)ash.size() * 10, -(int64_t)ash.size() * 7);
+            ash.insert(ash.end(), object.begin(), object.end());
+        }
+    }
+    std::vector<std::string> codes;
+    EPISAN_CHECK(LifeCensus::separate(ash, codes));
+    std::sort(codes.begin(), codes.end());
+    EPISAN_CHECK((codes == std::vector<std::string>{ "xp2_7", "xs4_33", "xs6_696" }));
+}
+
+}
+
+int main()
+{
+    testKnownObjects();
+    testNotPeriodic();
+    testSeparate();
+    return (episan_test::result());
+}
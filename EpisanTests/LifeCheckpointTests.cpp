@@ -0,0 +1,86 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: LifeCheckpointTests.cpp       +++     +++     **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 17/10/2026 22:52:40      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+// LifeCheckpoint written, updated and reopened: the restored engine takes
+// the file's cells, rule, topology and generation and keeps stepping in
+// step; stepping it leaves the file alone (copy-on-write); an async update
+// is refused, header included, until committed; so is another board size.
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <random>
+
+#include "EpisanTest.hpp"
+#include "RMDLLifeCheckpoint.hpp"
+#include "RMDLLifeEngine.hpp"
+
+namespace
+{
+
+constexpr const char* kPath = "LifeCheckpointTests.ckpt";
+
+bool sameCells(const LifeEngine& a, const LifeEngine& b)
+{
+    for (uint32_t y = 0; y < a.height(); ++y)
+        if (memcmp(a.row((int32_t)y), b.row((int32_t)y), a.wordsPerRow() * sizeof(uint64_t)))
+            return (false);
+    return (a.generation() == b.generation() && a.population() == b.population());
+}
+
+}
+
+int main()
+{
+    LifeRule highLife;
+    EPISAN_CHECK(LifeRule::parse("B36/S23", highLife));
+    const JDLVState state = { 300, 200, JDLVTopologyTorus, 0 };
+    LifeEngine engine(state);
+    EPISAN_CHECK(engine.setRule(highLife));
+    std::mt19937 rng(1);
+    for (uint32_t y = 0; y < state.height; ++y)
+        for (uint32_t x = 0; x < state.width; ++x)
+            engine.setCell(x, y, rng() % 3 == 0);
+
+    LifeCheckpoint checkpoint;
+    EPISAN_CHECK(checkpoint.create(kPath, engine));
+    engine.step(10);
+    EPISAN_CHECK(checkpoint.update(engine));
+    EPISAN_CHECK(checkpoint.generation() == 10);
+
+    // Reopened into an engine of the same size but another rule and topology.
+    LifeEngine restored({ state.width, state.height, JDLVTopologyPlane, 0 });
+    EPISAN_CHECK(LifeCheckpoint::restore(kPath, restored));
+    EPISAN_CHECK(restored.rule() == highLife && restored.topology() == JDLVTopologyTorus);
+    EPISAN_CHECK(sameCells(engine, restored));
+    engine.step(20);
+    restored.step(20);
+    EPISAN_CHECK(sameCells(engine, restored));
+
+    // The restored engine stepped its private copy; the file is still at generation 10.
+    LifeEngine again(state);
+    EPISAN_CHECK(LifeCheckpoint::restore(kPath, again) && again.generation() == 10);
+
+    // An async update leaves the file uncommitted until commit().
+    EPISAN_CHECK(checkpoint.update(engine, true));
+    LifeCheckpointHeader header;
+    EPISAN_CHECK(!LifeCheckpoint::readHeader(kPath, header));
+    EPISAN_CHECK(!LifeCheckpoint::restore(kPath, again));
+    EPISAN_CHECK(checkpoint.commit());
+    EPISAN_CHECK(LifeCheckpoint::readHeader(kPath, header) && header.generation == 30);
+    EPISAN_CHECK(LifeCheckpoint::restore(kPath, again) && sameCells(engine, again));
+    checkpoint.close();
+
+    LifeEngine wider({ state.width + 64, state.height, JDLVTopologyTorus, 0 });
+    EPISAN_CHECK(!LifeCheckpoint::restore(kPath, wider));
+
+    remove(kPath);
+    return (episan_test::result());
+}
@@ -0,0 +1,129 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: LifeHistoryTests.cpp          +++     +++     **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 17/10/2026 23:45:32      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+// LifeHistory against a copy of the board kept for every generation:
+// seeks back and forth across keyframes (edits included), seeks outside
+// the history refused, recording after a seek cutting the old future, and
+// the byte budget dropping the oldest segments.
+
+#include <cstdint>
+#include <map>
+#include <random>
+#include <vector>
+
+#include "EpisanTest.hpp"
+#include "RMDLLifeEngine.hpp"
+#include "RMDLLifeHistory.hpp"
+
+namespace
+{
+
+typedef std::map<uint64_t, std::vector<uint64_t>> Snapshots;
+
+std::vector<uint64_t> snapshot(const LifeEngine& engine)
+{
+    std::vector<uint64_t> board;
+    for (uint32_t y = 0; y < engine.height(); ++y)
+        board.insert(board.end(), engine.row((int32_t)y), engine.row((int32_t)y) + engine.wordsPerRow());
+    return (board);
+}
+
+bool seekMatches(LifeHistory& history, LifeEngine& engine, const Snapshots& snapshots, uint64_t generation)
+{
+    return (history.seek(generation, engine) && engine.generation() == generation &&
+            snapshot(engine) == snapshots.at(generation));
+}
+
+// Steps and records up to `generation`, with an edit recorded at every 25th.
+void recordTo(LifeHistory& history, LifeEngine& engine, Snapshots& snapshots, uint64_t generation, std::mt19937& rng)
+{
+    while (engine.generation() < generation)
+    {
+        engine.step();
+        history.record(engine);
+        if (engine.generation() % 25 == 0)
+        {
+            engine.fillSpan((uint32_t)(rng() % engine.height()), 10, 60, true);
+            history.record(engine);
+        }
+        snapshots[engine.generation()] = snapshot(engine);
+    }
+}
+
+void testSeekAndTruncate()
+{
+    LifeEngine engine({ 200, 100, JDLVTopologyTorus, 0 });
+    std::mt19937 rng(1);
+    for (uint32_t y = 0; y < 100; ++y)
+        for (uint32_t x = 0; x < 200; ++x)
+            engine.setCell(x, y, rng() % 3 == 0);
+    LifeHistory history(16);
+    Snapshots snapshots;
+    history.record(engine);
+    snapshots[0] = snapshot(engine);
+    recordTo(history, engine, snapshots, 300, rng);
+    EPISAN_CHECK(history.oldestGeneration() == 0 && history.newestGeneration() == 300);
+
+    // Backwards, forwards, onto and either side of keyframes, onto edits.
+    static const uint64_t kTargets[] = { 0, 300, 17, 16, 15, 250, 100, 299, 1, 64, 175 };
+    for (uint64_t generation : kTargets)
+        EPISAN_CHECK(seekMatches(history, engine, snapshots, generation));
+
+    const std::vector<uint64_t> before = snapshot(engine);
+    EPISAN_CHECK(!history.seek(301, engine));
+    EPISAN_CHECK(engine.generation() == 175 && snapshot(engine) == before);
+
+    // Seeking alone keeps the future; an edit recorded after the seek cuts it.
+    EPISAN_CHECK(seekMatches(history, engine, snapshots, 120));
+    history.record(engine);
+    EPISAN_CHECK(history.newestGeneration() == 300);
+    engine.fillSpan(50, 0, 200, true);
+    history.record(engine);
+    EPISAN_CHECK(history.newestGeneration() == 120);
+    snapshots.erase(snapshots.upper_bound(119), snapshots.end());
+    snapshots[120] = snapshot(engine);
+    recordTo(history, engine, snapshots, 140, rng);
+    EPISAN_CHECK(history.newestGeneration() == 140 && !history.seek(200, engine));
+    EPISAN_CHECK(seekMatches(history, engine, snapshots, 130));
+    EPISAN_CHECK(seekMatches(history, engine, snapshots, 119));
+    EPISAN_CHECK(seekMatches(history, engine, snapshots, 120));
+}
+
+// A soup changes most tiles each generation: 24 keyframes of budget hold only the last few segments.
+void testBudget()
+{
+    LifeEngine engine({ 256, 128, JDLVTopologyTorus, 0 });
+    std::mt19937 rng(2);
+    for (uint32_t y = 0; y < 128; ++y)
+        for (uint32_t x = 0; x < 256; ++x)
+            engine.setCell(x, y, rng() % 2 != 0);
+    const size_t keyframe = engine.wordsPerRow() * engine.height() * sizeof(uint64_t);
+    LifeHistory history(8, 24 * keyframe);
+    Snapshots snapshots;
+    history.record(engine);
+    snapshots[0] = snapshot(engine);
+    recordTo(history, engine, snapshots, 200, rng);
+
+    EPISAN_CHECK(history.bytes() <= history.budgetBytes());
+    EPISAN_CHECK(history.oldestGeneration() > 0 && history.oldestGeneration() % 8 == 0);
+    EPISAN_CHECK(history.newestGeneration() == 200);
+    EPISAN_CHECK(!history.seek(history.oldestGeneration() - 1, engine));
+    EPISAN_CHECK(seekMatches(history, engine, snapshots, history.oldestGeneration()));
+    EPISAN_CHECK(seekMatches(history, engine, snapshots, 199));
+}
+
+}
+
+int main()
+{
+    testSeekAndTruncate();
+    testBudget();
+    return (episan_test::result());
+}
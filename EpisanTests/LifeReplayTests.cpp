@@ -0,0 +1,126 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: LifeReplayTests.cpp           +++     +++     **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 17/10/2026 20:58:40      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+// A live LifeSimulation session logged to disk, then played back headless:
+// strokes and stamps, a Generations rule, a rule table, a topology switch,
+// a board load and the way back to Conway, all stepped flat out. The
+// replay must land on the same generation with the same cells.
+
+#include <chrono>
+#include <cstdio>
+#include <future>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "EpisanTest.hpp"
+#include "RMDLLifeEventLog.hpp"
+#include "RMDLLifePatterns.hpp"
+#include "RMDLLifeSimulation.hpp"
+
+namespace
+{
+
+const char* const kLogPath = "LifeReplayTests.epev";
+
+// Lets the simulation thread run a while between two changes.
+void pause()
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(15));
+}
+
+// Two round trips through the task queue: the loop that ran the first has published since.
+void settle(LifeSimulation& simulation)
+{
+    for (int i = 0; i < 2; ++i)
+    {
+        std::promise<void> ran;
+        simulation.post([&ran] { ran.set_value(); });
+        ran.get_future().wait();
+    }
+}
+
+}
+
+int main()
+{
+    const JDLVState state = { 256, 192, JDLVTopologyPlane, 0 };
+    std::vector<uint32_t> grid((size_t)state.width * state.height);
+    life_patterns::seedSoup(state, grid.data(), 0.35, 11);
+
+    LifeSimulation simulation(state);
+    std::shared_ptr<LifeEventLog> log = std::make_shared<LifeEventLog>();
+    EPISAN_CHECK(log->open(kLogPath, state.width, state.height));
+    simulation.loadGrid(grid.data());
+    simulation.setEventLog(log);
+    simulation.setGenerationsPerSecond(0);
+    simulation.setPublishRate(0);
+    simulation.start();
+
+    LifeRule rule;
+    pause();
+    simulation.edit(LifeEdit::stroke(10, 10, 120, 90, 3));
+    pause();
+    EPISAN_CHECK(LifeRule::parse("B2/S345/C4", rule) && simulation.setRule(rule));
+    pause();
+    simulation.edit(LifeEdit::stroke(200, 20, 30, 170, 2, 2));
+    simulation.edit(LifeEdit::stamp(100, 100, 3, 3, { 0, 1, 0, 0, 0, 1, 1, 1, 1 }));
+    pause();
+    simulation.setTopology(JDLVTopologyTorus);
+    pause();
+    simulation.setRuleTable(RuleTable::wireWorld());
+    pause();
+    simulation.edit(LifeEdit::stroke(0, 50, 255, 50, 1, 3));
+    pause();
+    simulation.setRule(LifeRule::conway());
+    pause();
+    life_patterns::seedGliders(state, grid.data(), 24, 12);
+    simulation.loadGrid(grid.data(), simulation.generation());
+    pause();
+    simulation.setTopology(JDLVTopologyKleinBottle);
+    simulation.edit(LifeEdit::clear(64, 64, 64, 64));
+    pause();
+
+    simulation.setPaused(true);
+    settle(simulation);
+    simulation.acquireFrame();
+    const LifeFrame& frame = simulation.frame();
+    EPISAN_CHECK(frame.generation == simulation.generation() && frame.generation > 0);
+    simulation.setEventLog(nullptr);
+    settle(simulation);
+    simulation.stop();
+    log.reset();
+
+    // Every kind of board change made it into the file.
+    uint32_t kinds = 0;
+    LifeEventReader reader;
+    EPISAN_CHECK(reader.open(kLogPath));
+    LifeEvent event;
+    while (reader.next(event))
+        kinds |= 1u << (uint32_t)event.kind;
+    for (LifeEvent::Kind kind : { LifeEvent::Kind::Edit, LifeEvent::Kind::Rule, LifeEvent::Kind::RuleTable,
+                                  LifeEvent::Kind::Topology, LifeEvent::Kind::Grid, LifeEvent::Kind::End })
+        EPISAN_CHECK((kinds >> (uint32_t)kind) & 1);
+
+    std::unique_ptr<LifeReplay> replay;
+    EPISAN_CHECK(LifeReplay::play(kLogPath, replay));
+    if (replay)
+    {
+        std::vector<uint32_t> replayed((size_t)state.width * state.height);
+        replay->exportGrid(replayed.data());
+        EPISAN_CHECK(replay->generation() == frame.generation);
+        EPISAN_CHECK(replayed == frame.grid);
+        EPISAN_CHECK(replay->population() == frame.population);
+        printf("LifeReplay: %llu events, generation %llu\n",
+               (unsigned long long)replay->events(), (unsigned long long)replay->generation());
+    }
+    remove(kLogPath);
+    return (episan_test::result());
+}
@@ -0,0 +1,132 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: PatternIOTests.cpp            +++     +++     **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 17/10/2026 22:31:09      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+// pattern_io round trips: a LifeEngine and a LifeUniverse through RLE, a
+// HashLife through Macrocell (rule and generation included, and still in
+// step afterwards), and a hand-written Generations RLE into a grid.
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "EpisanTest.hpp"
+#include "RMDLHashLife.hpp"
+#include "RMDLLifeEngine.hpp"
+#include "RMDLLifeUniverse.hpp"
+#include "RMDLPatternIO.hpp"
+
+namespace
+{
+
+void testEngineRLE()
+{
+    LifeRule highLife;
+    EPISAN_CHECK(LifeRule::parse("B36/S23", highLife));
+    const JDLVState state = { 200, 150, JDLVTopologyTorus, 0 };
+    LifeEngine saved(state), loaded(state);
+    EPISAN_CHECK(saved.setRule(highLife));
+    std::mt19937 rng(1);
+    for (uint32_t y = 0; y < state.height; ++y)
+        for (uint32_t x = 0; x < state.width; ++x)
+            saved.setCell(x, y, rng() % 3 == 0);
+    saved.step(7);
+    EPISAN_CHECK(pattern_io::saveRLE("PatternIOTests.rle", saved));
+
+    pattern_io::LifeEngineSink sink(loaded);
+    pattern_io::PatternInfo info;
+    EPISAN_CHECK(pattern_io::loadPattern("PatternIOTests.rle", sink, info));
+    EPISAN_CHECK(info.hasRule && info.rule == highLife && info.generation == 7);
+    EPISAN_CHECK(info.width == 200 && info.height == 150);
+    EPISAN_CHECK(loaded.population() == saved.population());
+    for (uint32_t y = 0; y < state.height; ++y)
+        EPISAN_CHECK(!memcmp(loaded.row((int32_t)y), saved.row((int32_t)y), saved.wordsPerRow() * sizeof(uint64_t)));
+}
+
+void testUniverseRLE()
+{
+    LifeUniverse saved, loaded;
+    std::mt19937 rng(2);
+    for (uint32_t i = 0; i < 2000; ++i)
+        saved.setCell((int64_t)(rng() % 300) - 150, (int64_t)(rng() % 200) - 180, true);
+    EPISAN_CHECK(pattern_io::saveRLE("PatternIOTests.rle", saved));
+
+    pattern_io::LifeUniverseSink sink(loaded);
+    pattern_io::PatternInfo info;
+    EPISAN_CHECK(pattern_io::loadPattern("PatternIOTests.rle", sink, info));
+    EPISAN_CHECK(loaded.population() == saved.population());
+    bool same = true;
+    for (int64_t y = -180; y < 20; ++y)
+        for (int64_t x = -150; x < 150; ++x)
+            same &= loaded.cell(x, y) == saved.cell(x, y);
+    EPISAN_CHECK(same);
+}
+
+bool sameWindow(const HashLife& a, const HashLife& b)
+{
+    const JDLVState window = { 256, 256, JDLVTopologyPlane, 0 };
+    std::vector<uint32_t> cellsA((size_t)window.width * window.height), cellsB(cellsA.size());
+    a.exportWindow(-128, -128, window, cellsA.data());
+    b.exportWindow(-128, -128, window, cellsB.data());
+    return (cellsA == cellsB && a.population() == b.population() && a.generation() == b.generation());
+}
+
+void testMacrocell()
+{
+    LifeRule rule;
+    EPISAN_CHECK(LifeRule::parse("B36/S23", rule));
+    HashLife saved, loaded;
+    EPISAN_CHECK(saved.setRule(rule));
+    std::mt19937 rng(3);
+    for (int64_t y = -20; y < 20; ++y)
+        for (int64_t x = -20; x < 20; ++x)
+            saved.setCell(x, y, rng() % 2 != 0);
+    saved.advance(50);
+    EPISAN_CHECK(pattern_io::saveMacrocell("PatternIOTests.mc", saved));
+
+    pattern_io::PatternInfo info;
+    EPISAN_CHECK(pattern_io::loadPattern("PatternIOTests.mc", loaded, info));
+    EPISAN_CHECK(loaded.rule() == rule && info.generation == 50);
+    EPISAN_CHECK(sameWindow(saved, loaded));
+
+    saved.advance(30);
+    loaded.advance(30);
+    EPISAN_CHECK(sameWindow(saved, loaded));
+}
+
+// Generations states are letters: A is state 1, B state 2.
+void testGenerationsRLE()
+{
+    const char text[] = "#C dying cells\nx = 3, y = 2, rule = B2/S/C3\nA.B$3A!\n";
+    const JDLVState state = { 4, 3, JDLVTopologyPlane, 0 };
+    std::vector<uint32_t> grid((size_t)state.width * state.height, 0);
+    pattern_io::GridSink sink(state, grid.data(), false);
+    pattern_io::PatternInfo info;
+    EPISAN_CHECK(pattern_io::readRLE(text, sizeof(text) - 1, sink, info));
+    EPISAN_CHECK(info.hasRule && info.rule.states == 3 && info.width == 3 && info.height == 2);
+    const std::vector<uint32_t> expected = { 1, 0, 2, 0,
+                                             1, 1, 1, 0,
+                                             0, 0, 0, 0 };
+    EPISAN_CHECK(grid == expected);
+}
+
+}
+
+int main()
+{
+    testEngineRLE();
+    testUniverseRLE();
+    testMacrocell();
+    testGenerationsRLE();
+    remove("PatternIOTests.rle");
+    remove("PatternIOTests.mc");
+    return (episan_test::result());
+}
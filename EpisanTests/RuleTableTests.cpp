@@ -0,0 +1,162 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: RuleTableTests.cpp            +++     +++     **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 17/10/2026 19:40:12      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+// RuleTable's @TABLE compiler on rules with more states than a
+// states^(k+1) table could hold, each checked against the rule written out
+// by hand: a Generations rule, a tied variable, rotate4 on 40 states and
+// WireWorld. A rule that needs too many classes must fail cleanly.
+
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <string>
+
+#include "EpisanTest.hpp"
+#include "RMDLRuleTable.hpp"
+
+namespace
+{
+
+typedef std::function<uint8_t(uint8_t, const uint8_t*)> Reference;
+
+std::string variables(const char* prefix, uint32_t count, const std::string& values)
+{
+    std::string text;
+    for (uint32_t i = 0; i < count; ++i)
+        text += "var " + std::string(prefix) + std::to_string(i) + "=" + values + "\n";
+    return (text);
+}
+
+std::string stateList(uint32_t first, uint32_t last)
+{
+    std::string text = "{";
+    for (uint32_t s = first; s <= last; ++s)
+        text += std::to_string(s) + (s == last ? "}" : ",");
+    return (text);
+}
+
+// Random neighbourhoods, state 1 drawn often enough to hit every birth count.
+bool matches(const RuleTable& table, const Reference& reference, uint32_t samples, uint32_t seed)
+{
+    std::mt19937 rng(seed);
+    uint8_t neighbours[8];
+    for (uint32_t centre = 0; centre < table.states(); ++centre)
+        for (uint32_t i = 0; i < samples; ++i)
+        {
+            for (uint32_t p = 0; p < table.neighbours(); ++p)
+                neighbours[p] = rng() % 5 < 2 ? 1 : (uint8_t)(rng() % table.states());
+            if (table.next((uint8_t)centre, neighbours) != reference((uint8_t)centre, neighbours))
+                return (false);
+        }
+    return (true);
+}
+
+// A ten-state Generations rule spelled out as a permute table.
+void testGenerations()
+{
+    LifeRule rule;
+    EPISAN_CHECK(LifeRule::parse("B2/S345/C10", rule));
+    std::string text = "@RULE B2S345C10\n@TABLE\nn_states:10\nneighborhood:Moore\nsymmetries:permute\n";
+    text += variables("d", 8, "{0," + stateList(2, 9).substr(1));
+    text += variables("a", 8, stateList(0, 9));
+    for (uint32_t centre = 0; centre <= 1; ++centre)
+        for (uint32_t live = 0; live <= 8; ++live)
+            if ((((centre ? rule.survive : rule.birth) >> live) & 1) != 0)
+            {
+                text += std::to_string(centre);
+                for (uint32_t i = 0; i < 8; ++i)
+                    text += i < live ? ",1" : ",d" + std::to_string(i);
+                text += ",1\n";
+            }
+    for (uint32_t centre = 1; centre < 10; ++centre)
+        text += std::to_string(centre) + ",a0,a1,a2,a3,a4,a5,a6,a7," + std::to_string((centre + 1) % 10) + "\n";
+
+    RuleTable table, expected;
+    EPISAN_CHECK(RuleTable::parse(text, table));
+    EPISAN_CHECK(RuleTable::fromLifeRule(rule, expected));
+    EPISAN_CHECK(table.states() == 10 && table.classes() == 2 && table.name() == "B2S345C10");
+    EPISAN_CHECK(matches(table, [&](uint8_t centre, const uint8_t* n) { return (expected.next(centre, n)); }, 4000, 1));
+}
+
+// Twelve states, N and S tied by one variable: every live state is its own class.
+void testTiedVariable()
+{
+    std::string text = "@TABLE\nn_states:12\nneighborhood:vonNeumann\nsymmetries:none\n";
+    text += "var x=" + stateList(1, 11) + "\n" + variables("a", 4, stateList(0, 11));
+    text += "0,x,a0,x,a1,x\n";
+    text += "x,a0,a1,a2,a3,0\n";
+
+    RuleTable table;
+    EPISAN_CHECK(RuleTable::parse(text, table));
+    EPISAN_CHECK(table.classes() == 12);
+    EPISAN_CHECK(matches(table, [](uint8_t centre, const uint8_t* n)
+    {
+        return ((uint8_t)(centre == 0 && n[0] != 0 && n[0] == n[2] ? n[0] : 0));
+    }, 4000, 2));
+}
+
+// Forty states on rotate4: a 1 on any side lights a cell, which then ages out.
+void testRotate4()
+{
+    std::string text = "@TABLE\nn_states:40\nneighborhood:vonNeumann\nsymmetries:rotate4\n";
+    text += variables("a", 4, stateList(0, 39));
+    text += "0,1,a0,a1,a2,1\n";
+    for (uint32_t centre = 1; centre < 40; ++centre)
+        text += std::to_string(centre) + ",a0,a1,a2,a3," + std::to_string((centre + 1) % 40) + "\n";
+
+    RuleTable table;
+    EPISAN_CHECK(RuleTable::parse(text, table));
+    EPISAN_CHECK(table.states() == 40 && table.classes() == 2);
+    EPISAN_CHECK(matches(table, [](uint8_t centre, const uint8_t* n)
+    {
+        if (centre != 0)
+            return ((uint8_t)((centre + 1) % 40));
+        return ((uint8_t)(n[0] == 1 || n[1] == 1 || n[2] == 1 || n[3] == 1));
+    }, 2000, 3));
+}
+
+void testWireWorld()
+{
+    const RuleTable table = RuleTable::wireWorld();
+    EPISAN_CHECK(table.states() == 4 && table.classes() == 2);
+    EPISAN_CHECK(matches(table, [](uint8_t centre, const uint8_t* n)
+    {
+        uint32_t heads = 0;
+        for (uint32_t p = 0; p < 8; ++p)
+            heads += n[p] == 1;
+        if (centre == 3)
+            return ((uint8_t)(heads == 1 || heads == 2 ? 1 : 3));
+        return ((uint8_t)(centre == 0 ? 0 : centre + 1));
+    }, 4000, 4));
+}
+
+// Sixteen tied Moore states would need 16 * 16^8 bytes.
+void testTooManyClasses()
+{
+    std::string text = "@TABLE\nn_states:16\nneighborhood:Moore\nsymmetries:none\n";
+    text += "var x=" + stateList(1, 15) + "\n" + variables("a", 6, stateList(0, 15));
+    text += "0,x,a0,a1,a2,x,a3,a4,a5,x\n";
+
+    RuleTable table = RuleTable::wireWorld();
+    EPISAN_CHECK(!RuleTable::parse(text, table));
+    EPISAN_CHECK(table.name() == "WireWorld");
+}
+
+}
+
+int main()
+{
+    testGenerations();
+    testTiedVariable();
+    testRotate4();
+    testWireWorld();
+    testTooManyClasses();
+    return (episan_test::result());
+}
@@ -0,0 +1,86 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: TemporalStepperTests.cpp      +++     +++     **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 17/10/2026 21:14:37      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+// LifeTemporalStepper against LifeEngine::step on every topology, boards
+// narrow enough for whole-row blocks and wide enough (with a small cache)
+// to be cut into column tiles, alone and on a pool.
+
+#include <cstdint>
+#include <memory>
+#include <random>
+
+#include "EpisanTest.hpp"
+#include "RMDLLifeEngine.hpp"
+#include "RMDLLifeTemporalStepper.hpp"
+#include "RMDLWorkStealingPool.hpp"
+
+namespace
+{
+
+void randomFill(LifeEngine& engine, uint32_t seed)
+{
+    std::mt19937 rng(seed);
+    for (uint32_t y = 0; y < engine.height(); ++y)
+        for (uint32_t x = 0; x < engine.width(); ++x)
+            engine.setCell(x, y, rng() % 10 < 3);
+}
+
+bool sameCells(const LifeEngine& a, const LifeEngine& b)
+{
+    for (uint32_t y = 0; y < a.height(); ++y)
+        for (uint32_t w = 0; w < a.tilesX(); ++w)
+            if (a.row((int32_t)y)[w] != b.row((int32_t)y)[w])
+                return (false);
+    return (a.generation() == b.generation() && a.population() == b.population());
+}
+
+void testBoard(uint32_t width, uint32_t height, size_t cacheBytes, bool tiled, WorkStealingPool* pool)
+{
+    static const JDLVTopology kTopologies[] = { JDLVTopologyPlane, JDLVTopologyTorus, JDLVTopologyKleinBottle, JDLVTopologyPadded };
+    LifeRule highLife;
+    EPISAN_CHECK(LifeRule::parse("B36/S23", highLife));
+    uint32_t seed = width ^ height;
+    for (JDLVTopology topology : kTopologies)
+        for (uint32_t padding = 0; padding <= (topology == JDLVTopologyPadded ? 1u : 0u); ++padding)
+        {
+            const JDLVState state = { width, height, (uint32_t)topology, padding };
+            LifeEngine reference(state), blocked(state);
+            EPISAN_CHECK(reference.setRule(highLife) && blocked.setRule(highLife));
+            randomFill(reference, ++seed);
+            randomFill(blocked, seed);
+
+            // 37 is not a multiple of any depth, so the last pass is a short one.
+            LifeTemporalStepper temporal(0, cacheBytes);
+            reference.step(37);
+            temporal.run(blocked, 37, pool);
+            EPISAN_CHECK(sameCells(reference, blocked));
+            EPISAN_CHECK(tiled == (temporal.tileWords() < blocked.tilesX()));
+
+            reference.step(5);
+            temporal.run(blocked, 5, pool);
+            EPISAN_CHECK(sameCells(reference, blocked));
+        }
+}
+
+}
+
+int main()
+{
+    std::unique_ptr<WorkStealingPool> pool(new WorkStealingPool(3));
+    for (WorkStealingPool* p : { (WorkStealingPool*)nullptr, pool.get() })
+    {
+        testBoard(200, 90, 0, false, p);
+        // 32 KB leaves 8-word tiles: 3000 cells are 47 words, the last one partial.
+        testBoard(3000, 200, 32 * 1024, true, p);
+        testBoard(4096, 70, 32 * 1024, true, p);
+        testBoard(1000, 33, 16 * 1024, true, p);
+    }
+    return (episan_test::result());
+}
@@ -0,0 +1,206 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: VoxelLifeTests.cpp            +++     +++     **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 21/10/2026 11:58:23      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+// VoxelLife and VoxelMesher against a brute-force dense reference: cells
+// and populations after each step, face counts after incremental updates
+// (edits included) against a full remesh, and brick culling on a box.
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "EpisanTest.hpp"
+#include "RMDLVoxelLife.hpp"
+#include "RMDLVoxelMesher.hpp"
+
+namespace
+{
+
+// A dense cube wide enough that nothing reaches its faces during the test.
+class DenseLife
+{
+public:
+    DenseLife(int32_t origin, int32_t size, const VoxelRule& rule)
+        : _origin(origin), _size(size), _rule(rule), _cells((size_t)size * size * size, 0) {}
+
+    bool    inside(int32_t x, int32_t y, int32_t z) const
+    {
+        return (x >= _origin && y >= _origin && z >= _origin &&
+                x < _origin + _size && y < _origin + _size && z < _origin + _size);
+    }
+    bool    cell(int32_t x, int32_t y, int32_t z) const { return (inside(x, y, z) && _cells[index(x, y, z)]); }
+    void    setCell(int32_t x, int32_t y, int32_t z, bool alive) { _cells[index(x, y, z)] = alive; }
+
+    void    step()
+    {
+        std::vector<uint8_t> next(_cells.size(), 0);
+        for (int32_t z = _origin; z < _origin + _size; ++z)
+            for (int32_t y = _origin; y < _origin + _size; ++y)
+                for (int32_t x = _origin; x < _origin + _size; ++x)
+                {
+                    uint32_t n = 0;
+                    for (int32_t dz = -1; dz <= 1; ++dz)
+                        for (int32_t dy = -1; dy <= 1; ++dy)
+                            for (int32_t dx = -1; dx <= 1; ++dx)
+                                n += (dx || dy || dz) && cell(x + dx, y + dy, z + dz);
+                    const bool alive = cell(x, y, z);
+                    next[index(x, y, z)] = alive ? (n >= _rule.surviveMin && n <= _rule.surviveMax)
+                                                 : (n >= _rule.birthMin && n <= _rule.birthMax);
+                }
+        _cells.swap(next);
+    }
+
+    uint64_t population() const
+    {
+        uint64_t count = 0;
+        for (uint8_t c : _cells)
+            count += c;
+        return (count);
+    }
+
+    // Live cells times their dead face neighbours: what the mesher must emit.
+    uint64_t faces() const
+    {
+        static const int32_t kFaces[6][3] = { { 1, 0, 0 }, { -1, 0, 0 }, { 0, 1, 0 }, { 0, -1, 0 }, { 0, 0, 1 }, { 0, 0, -1 } };
+        uint64_t count = 0;
+        for (int32_t z = _origin; z < _origin + _size; ++z)
+            for (int32_t y = _origin; y < _origin + _size; ++y)
+                for (int32_t x = _origin; x < _origin + _size; ++x)
+                    if (cell(x, y, z))
+                        for (const int32_t* f : kFaces)
+                            count += !cell(x + f[0], y + f[1], z + f[2]);
+        return (count);
+    }
+
+    bool    matches(const VoxelLife& life) const
+    {
+        if (life.population() != population())
+            return (false);
+        for (int32_t z = _origin; z < _origin + _size; ++z)
+            for (int32_t y = _origin; y < _origin + _size; ++y)
+                for (int32_t x = _origin; x < _origin + _size; ++x)
+                    if (life.cell(x, y, z) != cell(x, y, z))
+                        return (false);
+        return (true);
+    }
+
+private:
+    size_t  index(int32_t x, int32_t y, int32_t z) const
+    {
+        return (((size_t)(z - _origin) * _size + (y - _origin)) * _size + (x - _origin));
+    }
+
+    int32_t                 _origin;
+    int32_t                 _size;
+    VoxelRule               _rule;
+    std::vector<uint8_t>    _cells;
+};
+
+size_t meshedFaces(const VoxelMesher& mesher, bool& consistent)
+{
+    size_t faces = 0;
+    consistent = true;
+    for (const auto& entry : mesher.meshes())
+    {
+        const VoxelMesher::BrickMesh& mesh = entry.second;
+        consistent &= mesh.vertices.size() * 6 == mesh.indices.size() * 4;
+        for (uint32_t index : mesh.indices)
+            consistent &= index < mesh.vertices.size();
+        faces += mesh.indices.size() / 6;
+    }
+    return (faces);
+}
+
+// A random blob straddling brick boundaries, including negative coordinates.
+void testAgainstReference(const VoxelRule& rule, uint32_t seed, double density, uint32_t generations)
+{
+    std::mt19937 rng(seed);
+    const int32_t margin = (int32_t)generations + 2;
+    const int32_t blob = 14;
+    DenseLife dense(-blob / 2 - margin, blob + 2 * margin, rule);
+    VoxelLife life(rule);
+    VoxelMesher mesher;
+    for (int32_t z = -blob / 2; z < blob / 2; ++z)
+        for (int32_t y = -blob / 2; y < blob / 2; ++y)
+            for (int32_t x = -blob / 2; x < blob / 2; ++x)
+                if (std::uniform_real_distribution<double>(0, 1)(rng) < density)
+                {
+                    life.setCell(x, y, z, true);
+                    dense.setCell(x, y, z, true);
+                }
+
+    bool consistent = true;
+    for (uint32_t g = 0; g < generations; ++g)
+    {
+        EPISAN_CHECK(dense.matches(life));
+        mesher.update(life);
+        EPISAN_CHECK(meshedFaces(mesher, consistent) == dense.faces() && mesher.faces() == dense.faces());
+        EPISAN_CHECK(consistent);
+
+        // An edit between steps, which the mesher must pick up like a step.
+        if (g % 3 == 1)
+        {
+            const int32_t x = (int32_t)(rng() % blob) - blob / 2, y = (int32_t)(rng() % blob) - blob / 2, z = (int32_t)(rng() % blob) - blob / 2;
+            const bool alive = !dense.cell(x, y, z);
+            life.setCell(x, y, z, alive);
+            dense.setCell(x, y, z, alive);
+        }
+        life.step();
+        dense.step();
+    }
+    EPISAN_CHECK(dense.matches(life));
+    EPISAN_CHECK(life.generation() == generations);
+
+    // Incremental meshing ends where meshing every brick from scratch does.
+    mesher.update(life);
+    size_t scratch = 0;
+    life.forEachBrick([&](const VoxelLife::Brick& brick)
+    {
+        VoxelMesher::BrickMesh mesh;
+        VoxelMesher::meshBrick(life, brick.key, mesh);
+        scratch += mesh.indices.size() / 6;
+    });
+    EPISAN_CHECK(mesher.faces() == scratch && scratch == dense.faces());
+}
+
+void testCulling()
+{
+    // The box 0 <= x, y, z <= 8: it holds brick (0, 0, 0) and touches the corner of (1, 1, 1).
+    const float planes[6][4] = { { 1, 0, 0, 0 }, { -1, 0, 0, 8 }, { 0, 1, 0, 0 }, { 0, -1, 0, 8 },
+                                 { 0, 0, 1, 0 }, { 0, 0, -1, 8 } };
+    EPISAN_CHECK(VoxelMesher::brickVisible(VoxelLife::key(0, 0, 0), planes));
+    EPISAN_CHECK(VoxelMesher::brickVisible(VoxelLife::key(-1, 0, 0), planes));     // touches x = 0
+    EPISAN_CHECK(!VoxelMesher::brickVisible(VoxelLife::key(-2, 0, 0), planes));
+    EPISAN_CHECK(!VoxelMesher::brickVisible(VoxelLife::key(0, 2, 0), planes));
+    EPISAN_CHECK(!VoxelMesher::brickVisible(VoxelLife::key(0, 0, -3), planes));
+
+    VoxelLife life;
+    VoxelMesher mesher;
+    life.setCell(3, 3, 3, true);
+    life.setCell(-20, 3, 3, true);
+    mesher.update(life);
+    std::vector<VoxelLife::BrickKey> keys;
+    mesher.visibleMeshes(planes, keys);
+    EPISAN_CHECK(keys.size() == 1 && keys[0] == VoxelLife::key(0, 0, 0));
+}
+
+}
+
+int main()
+{
+    testAgainstReference(VoxelRule::bays4555(), 1, 0.35, 12);
+    VoxelRule rule;
+    EPISAN_CHECK(VoxelRule::parse("5766", rule));
+    testAgainstReference(rule, 2, 0.30, 10);
+    EPISAN_CHECK(VoxelRule::parse("2/6/4/5", rule));
+    testAgainstReference(rule, 3, 0.15, 8);
+    testCulling();
+    return (episan_test::result());
+}
@@ -0,0 +1,64 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                        +       +          */
+/*      File: WorkStealingPoolTests.cpp     +++     +++     **/
+/*                                        +       +          */
+/*      By: Laboitederemdal      **        +       +        **/
+/*                                       +           +       */
+/*      Created: 21/10/2026 11:26:50      + + + + + +   * ****/
+/*                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+// Two pools of different sizes feeding each other: worker indices belong to
+// the pool that owns the thread, so a wide pool submitting to a narrow one
+// must neither index past its queues nor hand out its own indices.
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+
+#include "EpisanTest.hpp"
+#include "RMDLWorkStealingPool.hpp"
+
+int main()
+{
+    WorkStealingPool wide(4);
+    WorkStealingPool narrow(1);
+    EPISAN_CHECK(wide.currentWorker() == -1 && narrow.currentWorker() == -1);
+
+    std::atomic<uint32_t> badIndex(0), ran(0);
+    std::mutex lock;
+    std::condition_variable done;
+    auto finish = [&](uint32_t count)
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        ran += count;
+        done.notify_all();
+    };
+    wide.parallelFor(64, [&](uint32_t begin, uint32_t end)
+    {
+        const int index = wide.currentWorker();
+        badIndex += index < 0 || index >= 4 || narrow.currentWorker() != -1;
+        for (uint32_t i = begin; i < end; ++i)
+        {
+            // From a worker of `wide`, `narrow` must fall back to round-robin.
+            narrow.submit([&]
+            {
+                badIndex += narrow.currentWorker() != 0 || wide.currentWorker() != -1;
+                finish(1);
+            });
+        }
+    });
+
+    narrow.submit([&]
+    {
+        // And back: a worker of `narrow` blocking on `wide` is allowed.
+        wide.parallelFor(16, [&](uint32_t, uint32_t) { badIndex += wide.currentWorker() < 0; });
+        finish(1000);
+    });
+    std::unique_lock<std::mutex> guard(lock);
+    done.wait(guard, [&] { return (ran.load() == 64 + 1000); });
+
+    EPISAN_CHECK(badIndex.load() == 0);
+    EPISAN_CHECK(ran.load() == 64 + 1000);
+    return (episan_test::result());
+}